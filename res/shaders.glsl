@@ -4,13 +4,14 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #version 100
-attribute vec3 a_pos;
-uniform mat4 u_proj;
-uniform mat4 u_model;
+attribute vec2 a_pos;
+attribute vec4 a_color;
+uniform vec4 u_proj; // scale xy, offset zw
+varying vec4 v_color;
 void main()
 {
-    vec4 pos = vec4( a_pos, 1.0 );
-    gl_Position = u_proj * u_model * pos;
+    v_color = a_color;
+    gl_Position = vec4( a_pos * u_proj.xy + u_proj.zw, 0.0, 1.0 );
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -19,10 +20,10 @@ void main()
 
 #version 100
 precision lowp float;
-uniform vec4 u_color;
+varying vec4 v_color;
 void main()
 {
-    gl_FragColor = u_color;
+    gl_FragColor = v_color;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -63,16 +64,17 @@ void main()
 ////////////////////////////////////////////////////////////////////////////////
 
 #version 100
-attribute vec3 a_pos;
+attribute vec2 a_pos;
 attribute vec2 a_uv;
-uniform mat4 u_proj;
-uniform mat4 u_model;
+attribute vec4 a_color;
+uniform vec4 u_proj; // scale xy, offset zw
 varying vec2 v_uv;
+varying vec4 v_color;
 void main()
 {
     v_uv = a_uv;
-    vec4 pos = vec4( a_pos, 1.0 );
-    gl_Position = u_proj * u_model * pos;
+    v_color = a_color;
+    gl_Position = vec4( a_pos * u_proj.xy + u_proj.zw, 0.0, 1.0 );
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -82,9 +84,94 @@ void main()
 #version 100
 precision lowp float;
 uniform sampler2D u_texture;
-uniform vec4 u_color;
 varying vec2 v_uv;
+varying vec4 v_color;
 void main()
 {
-    gl_FragColor = u_color * texture2D( u_texture, v_uv );
+    gl_FragColor = v_color * texture2D( u_texture, v_uv );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#shader shader4_vertex
+////////////////////////////////////////////////////////////////////////////////
+
+#version 100
+attribute vec3 a_corner;
+attribute vec4 a_ends;
+uniform vec4 u_proj; // scale xy, offset zw
+uniform float u_width;
+void main()
+{
+    vec2 delta = a_ends.zw - a_ends.xy;
+    float len = length( delta );
+    vec2 dir = len > 0.0 ? delta / len : vec2( 1.0, 0.0 );
+    vec2 normal = vec2( -dir.y, dir.x );
+
+    vec2 pos = mix( a_ends.xy, a_ends.zw, a_corner.x );
+    pos += ( dir * a_corner.y + normal * a_corner.z ) * u_width;
+    gl_Position = vec4( pos * u_proj.xy + u_proj.zw, 0.0, 1.0 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#shader shader4_fragment
+////////////////////////////////////////////////////////////////////////////////
+
+#version 100
+precision lowp float;
+uniform vec4 u_color;
+void main()
+{
+    gl_FragColor = u_color;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#shader shader5_vertex
+////////////////////////////////////////////////////////////////////////////////
+
+#version 100
+attribute vec2 a_pos;
+attribute vec2 a_local;
+attribute vec3 a_shape;
+attribute vec4 a_color;
+uniform vec4 u_proj; // scale xy, offset zw
+varying vec2 v_local;
+varying vec3 v_shape;
+varying vec4 v_color;
+void main()
+{
+    v_local = a_local;
+    v_shape = a_shape;
+    v_color = a_color;
+    gl_Position = vec4( a_pos * u_proj.xy + u_proj.zw, 0.0, 1.0 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#shader shader5_fragment
+////////////////////////////////////////////////////////////////////////////////
+
+#version 100
+precision mediump float;
+varying vec2 v_local; // radius units, corners on the unit circle
+varying vec3 v_shape; // sides (0 for a circle), ring width, pixel size
+varying vec4 v_color;
+void main()
+{
+    float len = length( v_local );
+    float d = len - 1.0;
+
+    // distance to the edge facing the fragment, edges centered at odd
+    // multiples of pi / sides
+    if ( v_shape.x > 0.0 ) {
+        float half_angle = 3.14159265 / v_shape.x;
+        float a = atan( v_local.y, v_local.x );
+        float phi = mod( a, 2.0 * half_angle ) - half_angle;
+        d = len * cos( phi ) - cos( half_angle );
+    }
+
+    if ( v_shape.y > 0.0 ) {
+        d = abs( d + v_shape.y * 0.5 ) - v_shape.y * 0.5;
+    }
+
+    float coverage = clamp( 0.5 - d / v_shape.z, 0.0, 1.0 );
+    gl_FragColor = vec4( v_color.rgb, v_color.a * coverage );
 }
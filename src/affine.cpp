@@ -0,0 +1,99 @@
+#include "affine.hpp"
+
+#include <math.h>
+
+#if defined( __SSE2__ ) || defined( _M_X64 )
+#include <emmintrin.h>
+#define AFFINE_SSE 1
+#else
+#define AFFINE_SSE 0
+#endif
+
+affine_t affine_identity()
+{
+    return { 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f };
+}
+
+affine_t affine_trs( float x, float y, float rotation, float scale )
+{
+    float c = cosf( rotation ) * scale;
+    float s = sinf( rotation ) * scale;
+    return { c, s, -s, c, x, y };
+}
+
+affine_t affine_rect_to_rect( rect_t from, rect_t to )
+{
+    float sx = to.w / from.w;
+    float sy = to.h / from.h;
+    return { sx, 0.0f, 0.0f, sy, to.x - from.x * sx, to.y - from.y * sy };
+}
+
+affine_t affine_ortho( rect_t view )
+{
+    return affine_rect_to_rect( view, { -1.0f, 1.0f, 2.0f, -2.0f } );
+}
+
+affine_t affine_mul( const affine_t & second, const affine_t & first )
+{
+    affine_t m;
+    m.a = second.a * first.a + second.c * first.b;
+    m.b = second.b * first.a + second.d * first.b;
+    m.c = second.a * first.c + second.c * first.d;
+    m.d = second.b * first.c + second.d * first.d;
+    m.tx = second.a * first.tx + second.c * first.ty + second.tx;
+    m.ty = second.b * first.tx + second.d * first.ty + second.ty;
+    return m;
+}
+
+void affine_apply(
+    const affine_t & m,
+    const float * in,
+    float * out,
+    int count
+)
+{
+    int i = 0;
+
+#if AFFINE_SSE
+    // two points per register, x y x y. the swapped copy y x y x picks up
+    // the cross terms
+    __m128 diagonal = _mm_setr_ps( m.a, m.d, m.a, m.d );
+    __m128 cross = _mm_setr_ps( m.c, m.b, m.c, m.b );
+    __m128 offset = _mm_setr_ps( m.tx, m.ty, m.tx, m.ty );
+
+    for ( ; i + 4 <= count; i += 4 ) {
+        __m128 p0 = _mm_loadu_ps( in + i * 2 );
+        __m128 p1 = _mm_loadu_ps( in + i * 2 + 4 );
+        __m128 s0 = _mm_shuffle_ps( p0, p0, _MM_SHUFFLE( 2, 3, 0, 1 ) );
+        __m128 s1 = _mm_shuffle_ps( p1, p1, _MM_SHUFFLE( 2, 3, 0, 1 ) );
+
+        __m128 r0 = _mm_add_ps(
+            _mm_add_ps( _mm_mul_ps( p0, diagonal ), _mm_mul_ps( s0, cross ) ),
+            offset
+        );
+        __m128 r1 = _mm_add_ps(
+            _mm_add_ps( _mm_mul_ps( p1, diagonal ), _mm_mul_ps( s1, cross ) ),
+            offset
+        );
+
+        _mm_storeu_ps( out + i * 2, r0 );
+        _mm_storeu_ps( out + i * 2 + 4, r1 );
+    }
+#endif
+
+    // same operation order as above, so the tail matches the simd part
+    for ( ; i < count; i++ ) {
+        float x = in[ i * 2 + 0 ];
+        float y = in[ i * 2 + 1 ];
+        out[ i * 2 + 0 ] = ( x * m.a + y * m.c ) + m.tx;
+        out[ i * 2 + 1 ] = ( y * m.d + x * m.b ) + m.ty;
+    }
+}
+
+void affine_uniform( const affine_t & m, float ( &out )[ 4 ] )
+{
+    out[ 0 ] = m.a;
+    out[ 1 ] = m.d;
+    out[ 2 ] = m.tx;
+    out[ 3 ] = m.ty;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "shape.hpp"
+
+/// 2d affine transform, a 3x2 matrix
+/// x' = a * x + c * y + tx
+/// y' = b * x + d * y + ty
+struct affine_t {
+    float a;
+    float b;
+    float c;
+    float d;
+    float tx;
+    float ty;
+};
+
+affine_t affine_identity();
+
+/// scales, then rotates, then moves to x, y
+affine_t affine_trs( float x, float y, float rotation, float scale );
+
+/// maps the corners of from onto the corners of to, a negative size flips
+affine_t affine_rect_to_rect( rect_t from, rect_t to );
+
+/// camera projection, view onto clip space with y pointing down
+affine_t affine_ortho( rect_t view );
+
+/// first applied, then second
+affine_t affine_mul( const affine_t & second, const affine_t & first );
+
+/// transforms count xy pairs, in and out may be the same list
+void affine_apply(
+    const affine_t & m,
+    const float * in,
+    float * out,
+    int count
+);
+
+/// scale xy and offset zw, for shaders. only valid without rotation
+void affine_uniform( const affine_t & m, float ( &out )[ 4 ] );
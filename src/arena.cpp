@@ -0,0 +1,28 @@
+#include "arena.hpp"
+
+#include "logging.hpp"
+
+void arena_t::init( int new_size )
+{
+    data = new char[ new_size ];
+    size = new_size;
+    used = 0;
+}
+
+void arena_t::reset()
+{
+    used = 0;
+}
+
+void * arena_t::alloc( int bytes )
+{
+    int start = ( used + 15 ) & ~15;
+
+    if ( bytes < 0 || start + bytes > size ) {
+        ERROR_LOG( "arena overflow (%d + %d > %d)", start, bytes, size );
+        return nullptr;
+    }
+
+    used = start + bytes;
+    return data + start;
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+/// bump allocator, everything in it is released at once by reset()
+struct arena_t {
+    char * data;
+    int size;
+    int used;
+
+    void init( int new_size );
+    void reset();
+
+    /// 16 byte aligned, nullptr when the arena is full
+    void * alloc( int bytes );
+
+    template < typename T > T * alloc_list( int count )
+    {
+        return (T *) alloc( count * (int) sizeof( T ) );
+    }
+};
@@ -1,39 +1,190 @@
 #include "audio.hpp"
 
+#include "loader.hpp"
 #include "logging.hpp"
+#include "mixer.hpp"
+#include "profiler.hpp"
 #include "res.hpp"
 #include "state.hpp"
 #include "wav.hpp"
 
 #include <AL/al.h>
 #include <AL/alc.h>
+#include <atomic>
+#include <mutex>
+#include <stdint.h>
 
-struct {
-    ALCdevice * device;
+// the output is fed from its own thread, so long frames and scenes that do
+// not tick can not starve it. the web build feeds it once a frame instead
+#ifndef AUDIO_THREAD
+#ifdef __EMSCRIPTEN__
+#define AUDIO_THREAD 0
+#else
+#define AUDIO_THREAD 1
+#endif
+#endif
+
+#if AUDIO_THREAD
+#include <chrono>
+#include <condition_variable>
+#include <thread>
+#endif
+
+#define VOICE_COUNT MIXER_VOICE_COUNT
+
+// the mix goes out through one source with a ring of queued buffers, the
+// latency is at most the whole ring. fed once a frame the ring has to
+// outlast a hitch, about 140ms, the thread only has to outlast its own wake
+// ups
+#define STREAM_FRAMES 512
+#if AUDIO_THREAD
+#define STREAM_BUFFER_COUNT 4
+#else
+#define STREAM_BUFFER_COUNT 12
+#endif
+
+// how often the audio thread looks for buffers to refill
+static const int k_feed_interval_ms = 4;
+
+struct sound_info_t {
+    res_name_t name;
+    float gain;
+    int priority;   // voices of higher priority sounds are never stolen
+    int max_voices; // playing at once, one more steals the oldest of them
+};
+
+static const sound_info_t k_sound_list[ SOUND_COUNT ] = {
+    { "click.wav", 1.0f, 1, 2 },
+    { "hurt.wav", 1.0f, 2, 4 },
+};
+
+struct voice_t {
+    int sound; // -1 while free
+    uint64_t start_tick;
+};
+
+static struct {
+    ALCdevice * device; // nullptr mixes into the null sink
     ALCcontext * context;
 
-    int click;
-    int hurt;
+    unsigned int stream;
+    unsigned int stream_buffer_list[ STREAM_BUFFER_COUNT ];
+    int16_t stream_data[ STREAM_FRAMES * 2 ];
+
+    // how far the null sink has consumed the mix, on profiler_clock()
+    double sink_time;
+
+    int mixer_sound_list[ SOUND_COUNT ]; // -1 when it failed to load
+
+    // the mixer voice of the same index plays the sound
+    voice_t voice_list[ VOICE_COUNT ];
+
+    // plays asked for since the last tick, errors log from other threads
+    std::atomic< int > request_list[ SOUND_COUNT ];
+
+    // sounds by descending priority, the order they pick voices in
+    int sound_order[ SOUND_COUNT ];
+
+    uint64_t tick_count;
 
+    // the mixer, the voices and every al call after init
+    std::mutex mutex;
+
+#if AUDIO_THREAD
+    std::thread thread;
+    std::condition_variable cond;
+    int quit;
+#endif
 } intern;
 
-int source_from_wav( res_t wav )
+////////////////////////////////////////////////////////////////////////////////
+// voices
+////////////////////////////////////////////////////////////////////////////////
+
+/// the voice to play the sound on, -1 when every voice has something more
+/// important. the oldest voice of the sound when it is at its limit, else a
+/// free voice, else the oldest voice of the lowest priority that is not
+/// above the sound's own
+static int find_voice( int sound )
 {
-    unsigned int source;
+    const sound_info_t & info = k_sound_list[ sound ];
+
+    int free_voice = -1;
+    int oldest_same = -1;
+    int victim = -1;
+    int same_count = 0;
+
+    for ( int i = 0; i < VOICE_COUNT; i++ ) {
+        const voice_t & voice = intern.voice_list[ i ];
 
-    alGenSources( 1, &source );
-    alSourcef( source, AL_PITCH, 1 );
-    alSourcef( source, AL_GAIN, 1 );
-    alSource3f( source, AL_POSITION, 0, 0, 0 );
-    alSource3f( source, AL_VELOCITY, 0, 0, 0 );
-    alSourcei( source, AL_LOOPING, AL_FALSE );
+        if ( voice.sound < 0 ) {
+            if ( free_voice < 0 ) free_voice = i;
+            continue;
+        }
 
-    alSourcei( source, AL_BUFFER, load_wav( wav.data, wav.size ) );
+        if ( voice.sound == sound ) {
+            same_count++;
+            if ( oldest_same < 0 ||
+                 voice.start_tick <
+                     intern.voice_list[ oldest_same ].start_tick ) {
+                oldest_same = i;
+            }
+        }
 
-    return (int) source;
+        int priority = k_sound_list[ voice.sound ].priority;
+        if ( priority > info.priority ) continue;
+
+        if ( victim < 0 ) {
+            victim = i;
+            continue;
+        }
+
+        const voice_t & other = intern.voice_list[ victim ];
+        int victim_priority = k_sound_list[ other.sound ].priority;
+        if ( priority < victim_priority ||
+             ( priority == victim_priority &&
+               voice.start_tick < other.start_tick ) ) {
+            victim = i;
+        }
+    }
+
+    if ( same_count >= info.max_voices ) return oldest_same;
+    if ( free_voice >= 0 ) return free_voice;
+    return victim;
 }
 
-int audio_init()
+static void start_voice( int sound )
+{
+    int i = find_voice( sound );
+    if ( i < 0 ) return;
+
+    mixer_play(
+        i,
+        intern.mixer_sound_list[ sound ],
+        k_sound_list[ sound ].gain,
+        0.0f,
+        1.0f
+    );
+
+    intern.voice_list[ i ].sound = sound;
+    intern.voice_list[ i ].start_tick = intern.tick_count;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// output
+////////////////////////////////////////////////////////////////////////////////
+
+static void close_device()
+{
+    alcMakeContextCurrent( nullptr );
+    if ( intern.context ) alcDestroyContext( intern.context );
+    alcCloseDevice( intern.device );
+
+    intern.context = nullptr;
+    intern.device = nullptr;
+}
+
+static int open_device()
 {
     intern.device = alcOpenDevice( nullptr );
     if ( !intern.device ) {
@@ -44,12 +195,14 @@ int audio_init()
     intern.context = alcCreateContext( intern.device, nullptr );
     if ( !intern.context ) {
         ERROR_LOG( "failed to create audio context" );
+        close_device();
         return 1;
     }
 
     ALCboolean is_current = alcMakeContextCurrent( intern.context );
     if ( is_current != ALC_TRUE ) {
         ERROR_LOG( "failed to make audio context current" );
+        close_device();
         return 1;
     }
 
@@ -64,35 +217,212 @@ int audio_init()
         alGetString( AL_RENDERER )
     );
 
-    float orientation[] = { 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f };
+    return 0;
+}
+
+static void fill_buffer( unsigned int buffer )
+{
+    mixer_mix( intern.stream_data, STREAM_FRAMES );
+    alBufferData(
+        buffer,
+        AL_FORMAT_STEREO16,
+        intern.stream_data,
+        sizeof( intern.stream_data ),
+        MIXER_RATE
+    );
+}
+
+static int start_stream()
+{
+    alGetError();
+
+    alGenSources( 1, &intern.stream );
+    alGenBuffers( STREAM_BUFFER_COUNT, intern.stream_buffer_list );
+    if ( alGetError() != AL_NO_ERROR ) {
+        ERROR_LOG( "failed to create the audio stream" );
+        return 1;
+    }
+
+    // stereo buffers are not positioned, the source only plays them back
+    alSourcei( intern.stream, AL_LOOPING, AL_FALSE );
+
+    for ( int i = 0; i < STREAM_BUFFER_COUNT; i++ ) {
+        fill_buffer( intern.stream_buffer_list[ i ] );
+    }
+    alSourceQueueBuffers(
+        intern.stream,
+        STREAM_BUFFER_COUNT,
+        intern.stream_buffer_list
+    );
+    alSourcePlay( intern.stream );
+
+    return 0;
+}
+
+/// refills the buffers the device is done with
+static void feed_stream()
+{
+    int processed = 0;
+    alGetSourcei( intern.stream, AL_BUFFERS_PROCESSED, &processed );
+
+    while ( processed-- > 0 ) {
+        unsigned int buffer;
+        alSourceUnqueueBuffers( intern.stream, 1, &buffer );
+        fill_buffer( buffer );
+        alSourceQueueBuffers( intern.stream, 1, &buffer );
+    }
+
+    // a stall long enough to drain the whole ring stops the source
+    int source_state;
+    alGetSourcei( intern.stream, AL_SOURCE_STATE, &source_state );
+    if ( source_state != AL_PLAYING ) alSourcePlay( intern.stream );
+}
+
+/// mixes and drops what a device would have played since the last feed, so
+/// voices end and the mixing costs the same without one. a long stall only
+/// catches up one ring's worth
+static void feed_null_sink()
+{
+    double now = profiler_clock();
+    double buffer_time = STREAM_FRAMES / (double) MIXER_RATE;
+    double ring_time = buffer_time * STREAM_BUFFER_COUNT;
 
-    alListener3f( AL_POSITION, 0, 0, 1.0f );
-    alListener3f( AL_VELOCITY, 0, 0, 0 );
-    alListenerfv( AL_ORIENTATION, orientation );
+    if ( now - intern.sink_time > ring_time ) {
+        intern.sink_time = now - ring_time;
+    }
 
-    intern.click = source_from_wav( find_res( "click.wav" ) );
-    intern.hurt = source_from_wav( find_res( "hurt.wav" ) );
+    while ( now - intern.sink_time >= buffer_time ) {
+        mixer_mix( intern.stream_data, STREAM_FRAMES );
+        intern.sink_time += buffer_time;
+    }
+}
+
+static void feed_output()
+{
+    if ( intern.device ) {
+        feed_stream();
+    } else {
+        feed_null_sink();
+    }
+}
+
+#if AUDIO_THREAD
+
+static void audio_thread_main()
+{
+    std::unique_lock< std::mutex > lock( intern.mutex );
+
+    while ( !intern.quit ) {
+        feed_output();
+        intern.cond.wait_for(
+            lock,
+            std::chrono::milliseconds( k_feed_interval_ms )
+        );
+    }
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// interface
+////////////////////////////////////////////////////////////////////////////////
+
+int audio_init()
+{
+    // parsed on workers since startup, the mixer reads them in place
+    for ( int i = 0; i < SOUND_COUNT; i++ ) {
+        wav_t wav = load_sound( k_sound_list[ i ].name ).get();
+        intern.mixer_sound_list[ i ] = mixer_add_sound( wav );
+    }
+
+    for ( int i = 0; i < SOUND_COUNT; i++ ) {
+        int j = i;
+        while ( j > 0 && k_sound_list[ intern.sound_order[ j - 1 ] ].priority <
+                             k_sound_list[ i ].priority ) {
+            intern.sound_order[ j ] = intern.sound_order[ j - 1 ];
+            j--;
+        }
+        intern.sound_order[ j ] = i;
+    }
+
+    for ( int i = 0; i < VOICE_COUNT; i++ ) {
+        intern.voice_list[ i ].sound = -1;
+    }
+
+    if ( open_device() == 0 && start_stream() != 0 ) close_device();
+
+    if ( !intern.device ) {
+        INFO_LOG( "no audio output, mixing into a null sink" );
+        intern.sink_time = profiler_clock();
+    }
+
+#if AUDIO_THREAD
+    intern.quit = 0;
+    intern.thread = std::thread( audio_thread_main );
+#endif
 
     return 0;
 }
 
 void audio_tick()
 {
+    std::lock_guard< std::mutex > lock( intern.mutex );
+
+    intern.tick_count++;
+
+    // voices free up when their sound ran out
+    for ( int i = 0; i < VOICE_COUNT; i++ ) {
+        if ( !mixer_playing( i ) ) intern.voice_list[ i ].sound = -1;
+    }
+
+    // however many requests a sound got, it starts at most one voice
+    for ( int i = 0; i < SOUND_COUNT; i++ ) {
+        int sound = intern.sound_order[ i ];
+        if ( intern.request_list[ sound ].exchange( 0 ) == 0 ) continue;
+        if ( intern.mixer_sound_list[ sound ] < 0 ) continue;
+
+        start_voice( sound );
+    }
+
+#if !AUDIO_THREAD
+    feed_output();
+#endif
 }
 
 void audio_destroy()
 {
-    alcMakeContextCurrent( nullptr );
-    alcDestroyContext( intern.context );
-    alcCloseDevice( intern.device );
+#if AUDIO_THREAD
+    if ( intern.thread.joinable() ) {
+        {
+            std::lock_guard< std::mutex > lock( intern.mutex );
+            intern.quit = 1;
+        }
+        intern.cond.notify_all();
+        intern.thread.join();
+    }
+#endif
+
+    if ( intern.device ) {
+        alSourceStop( intern.stream );
+        alDeleteSources( 1, &intern.stream );
+        alDeleteBuffers( STREAM_BUFFER_COUNT, intern.stream_buffer_list );
+        close_device();
+    }
+
+    mixer_reset();
+}
+
+void audio_play( sound_t sound )
+{
+    intern.request_list[ sound ].fetch_add( 1, std::memory_order_relaxed );
 }
 
 void audio_play_jump()
 {
-    alSourcePlay( intern.click );
+    audio_play( SOUND_CLICK );
 }
 
 void audio_play_damage()
 {
-    alSourcePlay( intern.hurt );
+    audio_play( SOUND_HURT );
 }
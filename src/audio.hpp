@@ -1,10 +1,22 @@
 #pragma once
 
+enum sound_t {
+    SOUND_CLICK,
+    SOUND_HURT,
+    SOUND_COUNT,
+};
+
 int audio_init();
 
+/// starts the sounds requested since the last tick, once per frame in every
+/// scene
 void audio_tick();
 
 void audio_destroy();
 
+/// queues the sound for the next audio_tick(), from any thread. requests for
+/// the same sound in one tick start a single voice
+void audio_play( sound_t sound );
+
 void audio_play_jump();
 void audio_play_damage();
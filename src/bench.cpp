@@ -0,0 +1,471 @@
+#include "hardware.hpp"
+#include "loader.hpp"
+#include "logging.hpp"
+#include "mixer.hpp"
+#include "null_gl.hpp"
+#include "profiler.hpp"
+#include "render.hpp"
+#include "render_cmd.hpp"
+#include "soft_render.hpp"
+#include "state.hpp"
+
+#include <stb_image.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// headless render benchmark, linked against the headless platform and the
+// null gl instead of a window
+//
+// usage: bench [bullet count] [frame count] [max draws per frame]
+//              [--soft] [--threads n] [--dump file.ppm] [--compare file]
+//              [--limit rate] [--mix voices]
+//
+// exits with 1 when max draws is given and a frame goes over it. --soft
+// draws the frames with the software rasterizer instead of the null gl, the
+// only place that backend is used. --dump writes the last frame out and
+// --compare fails when it differs from a reference image, the golden test
+// in CMakeLists.txt runs it against tests/soft_render.png. --limit paces
+// presents with the frame limiter, to check how closely it holds the rate.
+// --mix times the audio mixer instead, with the frames counted as game
+// ticks of sound
+
+static const float k_room_size = 4000.0f;
+
+// per channel, for compilers that round a float op differently
+static const int k_compare_tolerance = 2;
+
+/// one big room with the player in the middle and bullets scattered all over
+/// it, most of them outside the view
+static void setup_scene( int bullet_count )
+{
+    state.room_rect_list = new rect_t[ 1 ];
+    state.room_rect_list[ 0 ] = { 0.0f, 0.0f, k_room_size, k_room_size };
+    state.room_count = 1;
+    state.level_version = 1;
+
+    state.exit_pos[ 0 ] = k_room_size - 100.0f;
+    state.exit_pos[ 1 ] = k_room_size - 100.0f;
+
+    state.player_pos[ 0 ] = k_room_size * 0.5f;
+    state.player_pos[ 1 ] = k_room_size * 0.5f;
+
+    state.bullet_pos_list = new vec2[ bullet_count ];
+    state.bullet_old_pos_list = new vec2[ bullet_count ];
+    state.bullet_count = bullet_count;
+
+    srand( 1 );
+    for ( int i = 0; i < bullet_count; i++ ) {
+        float x = ( rand() % 10000 ) / 10000.0f * k_room_size;
+        float y = ( rand() % 10000 ) / 10000.0f * k_room_size;
+        state.bullet_pos_list[ i ][ 0 ] = x;
+        state.bullet_pos_list[ i ][ 1 ] = y;
+        state.bullet_old_pos_list[ i ][ 0 ] = x;
+        state.bullet_old_pos_list[ i ][ 1 ] = y;
+    }
+
+    state.bullet_grid.init(
+        state.room_rect_list[ 0 ],
+        100.0f,
+        bullet_count > 0 ? bullet_count : 1
+    );
+    state.bullet_grid.build( state.bullet_pos_list, bullet_count );
+
+    state.mob_pos_list = new vec2[ 10 ];
+    state.mob_count = 10;
+    for ( int i = 0; i < state.mob_count; i++ ) {
+        state.mob_pos_list[ i ][ 0 ] = state.player_pos[ 0 ] + i * 30.0f;
+        state.mob_pos_list[ i ][ 1 ] = state.player_pos[ 1 ] - 200.0f;
+    }
+
+    state.line_bullet_pos1_list = new vec2[ 1 ];
+    state.line_bullet_pos2_list = new vec2[ 1 ];
+    state.line_bullet_vel_list = new vec2[ 1 ];
+
+    state.scene = SCENE_GAME;
+}
+
+static int write_ppm( const char * path, const soft_target_t & target )
+{
+    FILE * file = fopen( path, "wb" );
+    if ( !file ) {
+        ERROR_LOG( "failed to open %s", path );
+        return 1;
+    }
+
+    fprintf( file, "P6\n%d %d\n255\n", target.width, target.height );
+    for ( int i = 0; i < target.width * target.height; i++ ) {
+        uint32_t p = target.pixels[ i ];
+        unsigned char rgb[ 3 ] = {
+            (unsigned char) ( p & 0xff ),
+            (unsigned char) ( ( p >> 8 ) & 0xff ),
+            (unsigned char) ( ( p >> 16 ) & 0xff ),
+        };
+        fwrite( rgb, 1, 3, file );
+    }
+
+    fclose( file );
+    return 0;
+}
+
+/// 1 when any pixel of target is further than k_compare_tolerance from the
+/// image at path
+static int compare_image( const char * path, const soft_target_t & target )
+{
+    int width;
+    int height;
+    int channels;
+    unsigned char * pixels = stbi_load( path, &width, &height, &channels, 4 );
+
+    if ( !pixels ) {
+        ERROR_LOG( "failed to load reference image %s", path );
+        return 1;
+    }
+
+    if ( width != target.width || height != target.height ) {
+        ERROR_LOG(
+            "reference image is %dx%d, the frame %dx%d",
+            width,
+            height,
+            target.width,
+            target.height
+        );
+        stbi_image_free( pixels );
+        return 1;
+    }
+
+    int bad_count = 0;
+    int max_diff = 0;
+
+    for ( int i = 0; i < width * height; i++ ) {
+        uint32_t p = target.pixels[ i ];
+        int bad = 0;
+
+        for ( int c = 0; c < 3; c++ ) {
+            int diff = abs( (int) ( ( p >> ( c * 8 ) ) & 0xff ) -
+                            pixels[ i * 4 + c ] );
+            if ( diff > max_diff ) max_diff = diff;
+            if ( diff > k_compare_tolerance ) bad = 1;
+        }
+
+        bad_count += bad;
+    }
+
+    stbi_image_free( pixels );
+
+    printf(
+        "reference:        %d pixels off, max difference %d\n",
+        bad_count,
+        max_diff
+    );
+
+    if ( bad_count > 0 ) {
+        ERROR_LOG( "frame does not match %s", path );
+        return 1;
+    }
+
+    return 0;
+}
+
+static int bench_soft(
+    int frame_count,
+    int thread_count,
+    const char * dump,
+    const char * reference
+)
+{
+    if ( soft_render_init( thread_count ) ) return 1;
+
+    soft_target_t target;
+    target.init( hardware_width(), hardware_height() );
+
+    double total_time = 0.0;
+    double min_time = 1e9;
+    double max_time = 0.0;
+
+    for ( int i = 0; i < frame_count; i++ ) {
+        state.render_step = 1.0f / 60.0f;
+        state.render_time += state.render_step;
+
+        double start = profiler_clock();
+        soft_render_submit( render_record(), &target );
+        double time = profiler_clock() - start;
+
+        total_time += time;
+        if ( time < min_time ) min_time = time;
+        if ( time > max_time ) max_time = time;
+    }
+
+    const soft_stats_t & stats = soft_render_stats();
+
+    printf( "frames:           %d\n", frame_count );
+    printf( "threads:          %d\n", thread_count );
+    printf(
+        "cpu ms/frame:     %.3f avg, %.3f min, %.3f max\n",
+        total_time / frame_count * 1000.0,
+        min_time * 1000.0,
+        max_time * 1000.0
+    );
+    printf( "fps:              %.1f\n", frame_count / total_time );
+    printf( "triangles/frame:  %d\n", stats.triangle_count );
+    printf(
+        "bins/frame:       %d over %d tiles\n",
+        stats.binned_count,
+        stats.tile_count
+    );
+
+    int result = 0;
+    if ( dump && write_ppm( dump, target ) ) result = 1;
+    if ( reference && compare_image( reference, target ) ) result = 1;
+
+    target.destroy();
+    soft_render_destroy();
+
+    return result;
+}
+
+/// keeps voice_count voices playing for frame_count ticks, a quarter of them
+/// pitched so the resampling path is in there too
+static int bench_mix( int voice_count, int frame_count )
+{
+    if ( voice_count > MIXER_VOICE_COUNT ) voice_count = MIXER_VOICE_COUNT;
+
+    int sound_list[ 2 ] = {
+        mixer_add_sound( load_sound( "hurt.wav" ).get() ),
+        mixer_add_sound( load_sound( "click.wav" ).get() ),
+    };
+    if ( sound_list[ 0 ] < 0 || sound_list[ 1 ] < 0 ) return 1;
+
+    const int tick_frames = MIXER_RATE / 60;
+    int16_t * out = new int16_t[ tick_frames * 2 ];
+
+    double total_time = 0.0;
+    double max_time = 0.0;
+
+    srand( 1 );
+    for ( int i = 0; i < frame_count; i++ ) {
+        // finished voices start over so the count holds
+        for ( int v = 0; v < voice_count; v++ ) {
+            if ( mixer_playing( v ) ) continue;
+
+            float pan = ( rand() % 200 ) / 100.0f - 1.0f;
+            float pitch = v % 4 == 3 ? 0.5f + ( rand() % 100 ) / 100.0f : 1.0f;
+            mixer_play( v, sound_list[ v % 2 ], 0.25f, pan, pitch );
+        }
+
+        double start = profiler_clock();
+        mixer_mix( out, tick_frames );
+        double time = profiler_clock() - start;
+
+        total_time += time;
+        if ( time > max_time ) max_time = time;
+    }
+
+    delete[] out;
+
+    printf( "voices:           %d\n", voice_count );
+    printf( "ticks:            %d of %d frames\n", frame_count, tick_frames );
+    printf(
+        "mix us/tick:      %.2f avg, %.2f max\n",
+        total_time / frame_count * 1e6,
+        max_time * 1e6
+    );
+    printf(
+        "mix us/voice:     %.3f per tick, %.2f ns per frame\n",
+        total_time / frame_count / voice_count * 1e6,
+        total_time / frame_count / voice_count / tick_frames * 1e9
+    );
+
+    return 0;
+}
+
+int main( int argc, char ** argv )
+{
+    double start_time = profiler_clock();
+
+    int soft = 0;
+    int thread_count = 1;
+    const char * dump = nullptr;
+    const char * reference = nullptr;
+    float limit_rate = 0.0f;
+    int mix_voices = 0;
+
+    // flags anywhere, the rest positional
+    const char * arg_list[ 3 ] = {};
+    int arg_count = 0;
+
+    for ( int i = 1; i < argc; i++ ) {
+        if ( strcmp( argv[ i ], "--soft" ) == 0 ) {
+            soft = 1;
+        } else if ( strcmp( argv[ i ], "--threads" ) == 0 && i + 1 < argc ) {
+            thread_count = atoi( argv[ ++i ] );
+        } else if ( strcmp( argv[ i ], "--dump" ) == 0 && i + 1 < argc ) {
+            dump = argv[ ++i ];
+        } else if ( strcmp( argv[ i ], "--compare" ) == 0 && i + 1 < argc ) {
+            reference = argv[ ++i ];
+        } else if ( strcmp( argv[ i ], "--limit" ) == 0 && i + 1 < argc ) {
+            limit_rate = atof( argv[ ++i ] );
+        } else if ( strcmp( argv[ i ], "--mix" ) == 0 && i + 1 < argc ) {
+            mix_voices = atoi( argv[ ++i ] );
+        } else if ( arg_count < 3 ) {
+            arg_list[ arg_count++ ] = argv[ i ];
+        }
+    }
+
+    int bullet_count = arg_count > 0 ? atoi( arg_list[ 0 ] ) : 4096;
+    int frame_count = arg_count > 1 ? atoi( arg_list[ 1 ] ) : 600;
+    int max_draws = arg_count > 2 ? atoi( arg_list[ 2 ] ) : 0;
+
+    if ( bullet_count < 0 || frame_count <= 0 || thread_count <= 0 ||
+         mix_voices < 0 ) {
+        ERROR_LOG(
+            "usage: bench [bullets] [frames] [max draws] [--soft] "
+            "[--threads n] [--dump file.ppm] [--compare file] [--limit rate] "
+            "[--mix voices]"
+        );
+        return 1;
+    }
+
+    if ( mix_voices > 0 ) return bench_mix( mix_voices, frame_count );
+
+    load_image( "atlas.tex" );
+
+    if ( hardware_init() ) return 1;
+
+    hardware_set_present_mode(
+        limit_rate > 0.0f ? PRESENT_LIMITED : PRESENT_UNCAPPED,
+        limit_rate
+    );
+
+    setup_scene( bullet_count );
+
+    render_init();
+
+    if ( soft ) {
+        printf( "bullets:          %d\n", bullet_count );
+        int result =
+            bench_soft( frame_count, thread_count, dump, reference );
+        render_destroy();
+        hardware_destroy();
+        return result;
+    }
+
+    // the first frame uploads the level and grows the batch buffers
+    render();
+    double first_frame_time = profiler_clock() - start_time;
+    null_gl_reset_stats();
+
+    // render() includes the limiter's wait in hardware_swap(), it is taken
+    // out so the cpu time is the frame's own work
+    double total_time = 0.0;
+    double min_time = 1e9;
+    double max_time = 0.0;
+    double total_wait = 0.0;
+    double max_wait = 0.0;
+    int worst_draws = 0;
+
+    for ( int i = 0; i < frame_count; i++ ) {
+        state.render_step = 1.0f / 60.0f;
+        state.render_time += state.render_step;
+
+        int draws_before = null_gl_stats().draw_count;
+        double wait_before = hardware_present_stats().wait_time;
+
+        double start = profiler_clock();
+        render();
+        double end = profiler_clock();
+
+        double wait = hardware_present_stats().wait_time - wait_before;
+        double time = end - start - wait;
+
+        total_time += time;
+        if ( time < min_time ) min_time = time;
+        if ( time > max_time ) max_time = time;
+
+        total_wait += wait;
+        if ( wait > max_wait ) max_wait = wait;
+
+        int draws = null_gl_stats().draw_count - draws_before;
+        if ( draws > worst_draws ) worst_draws = draws;
+    }
+
+    const null_gl_stats_t & gl = null_gl_stats();
+    const render_stats_t & stats = render_stats();
+    present_stats_t present = hardware_present_stats();
+
+    printf( "bullets:          %d\n", bullet_count );
+    printf( "frames:           %d\n", frame_count );
+    printf(
+        "first frame ms:   %.3f, %.3f decoding on workers\n",
+        first_frame_time * 1000.0,
+        loader_busy_time() * 1000.0f
+    );
+    printf(
+        "cpu ms/frame:     %.3f avg, %.3f min, %.3f max\n",
+        total_time / frame_count * 1000.0,
+        min_time * 1000.0,
+        max_time * 1000.0
+    );
+    printf(
+        "limit wait ms:    %.3f avg, %.3f max\n",
+        total_wait / frame_count * 1000.0,
+        max_wait * 1000.0
+    );
+    printf(
+        "present ms:       %.3f avg, %.3f min, %.3f p99, %d missed\n",
+        present.avg_frame_time * 1000.0,
+        present.min_frame_time * 1000.0,
+        present.p99_frame_time * 1000.0,
+        present.missed_count
+    );
+    printf(
+        "drawn / culled:   %d / %d\n",
+        stats.drawn_count,
+        stats.culled_count
+    );
+    printf( "commands/frame:   %d\n", stats.cmd_count );
+    printf( "layouts/frame:    %d\n", stats.layout_count );
+    printf(
+        "draws/frame:      %.1f (worst %d)\n",
+        (double) gl.draw_count / frame_count,
+        worst_draws
+    );
+    printf(
+        "vertices/frame:   %.1f\n",
+        (double) gl.vertex_count / frame_count
+    );
+    printf(
+        "gl calls/frame:   %.1f\n",
+        (double) gl.call_count / frame_count
+    );
+    printf(
+        "binds/frame:      %.1f program, %.1f texture, %.1f buffer, "
+        "%.1f framebuffer\n",
+        (double) gl.program_change_count / frame_count,
+        (double) gl.texture_change_count / frame_count,
+        (double) gl.buffer_change_count / frame_count,
+        (double) gl.framebuffer_change_count / frame_count
+    );
+    printf(
+        "uniforms/frame:   %.1f\n",
+        (double) gl.uniform_count / frame_count
+    );
+    printf(
+        "upload KB/frame:  %.2f\n",
+        gl.upload_bytes / 1024.0 / frame_count
+    );
+
+    render_destroy();
+    hardware_destroy();
+
+    if ( max_draws > 0 && worst_draws > max_draws ) {
+        ERROR_LOG(
+            "draws per frame over budget (%d > %d)",
+            worst_draws,
+            max_draws
+        );
+        return 1;
+    }
+
+    return 0;
+}
@@ -2,187 +2,98 @@
 
 #include "logging.hpp"
 
-#include <ctype.h>
-#include <stdio.h>
 #include <string.h>
 
-struct parse_stream_t {
-    const char * data;
-    int size;
-    int i;
-
-    char getc()
-    {
-        char c = data[ i ];
-        i++;
-        return c;
-    }
-
-    int eof()
-    {
-        return i >= size;
-    }
-};
-
-static int parse_token( parse_stream_t * stream, const char * token )
+static void print_font_info( const font_header_t * header )
 {
-    int i = 0;
-    int len = strlen( token );
-    while ( !stream->eof() ) {
-        if ( i >= len ) return 0;
-
-        char c = stream->getc();
-
-        if ( c == token[ i ] ) {
-            i++;
-        } else {
-            i = 0;
-        }
-    }
-
-    ERROR_LOG( "failed to parse token (%s)", token );
-
-    return 1;
+    INFO_LOG( "font description:" );
+    INFO_LOG( "  face:        %s", header->face );
+    INFO_LOG( "  file:        %s", header->file );
+    INFO_LOG( "  size:        %d", header->size );
+    INFO_LOG( "  line height: %d", header->line_height );
+    INFO_LOG( "  base:        %d", header->base );
+    INFO_LOG( "  scale w:     %d", header->scale_w );
+    INFO_LOG( "  scale h:     %d", header->scale_h );
+    INFO_LOG( "  char count:  %d", header->char_count );
+    INFO_LOG( "  kernings:    %d", header->kerning_count );
 }
 
-static int parse_number( int * out, parse_stream_t * stream )
+int font_t::init( res_t res )
 {
-    int value = 0;
+    header = nullptr;
+    chars = nullptr;
+    kernings = nullptr;
 
-    if ( stream->eof() ) return 1;
-
-    int i = 0;
+    if ( !res.data || res.size < (int) sizeof( font_header_t ) ) {
+        ERROR_LOG( "failed to load font, resource too small" );
+        return 1;
+    }
 
-    while ( !stream->eof() ) {
-        char c = stream->getc();
+    const font_header_t * data = (const font_header_t *) res.data;
 
-        if ( !isgraph( c ) ) {
-            if ( i == 0 ) return 1;
-            break;
-        }
+    if ( data->magic != FONT_MAGIC || data->version != FONT_VERSION ) {
+        ERROR_LOG( "failed to load font, not a version %d font", FONT_VERSION );
+        return 1;
+    }
 
-        if ( !isdigit( c ) ) return 1;
+    int size = sizeof( font_header_t ) +
+               sizeof( font_char_t ) * FONT_CHAR_COUNT +
+               sizeof( font_kerning_t ) * data->kerning_count;
+
+    if ( data->kerning_count < 0 || res.size != size ) {
+        ERROR_LOG(
+            "failed to load font, size %d instead of %d",
+            res.size,
+            size
+        );
+        return 1;
+    }
 
-        value *= 10;
-        value += c - '0';
+    header = data;
+    chars = (const font_char_t *) ( data + 1 );
+    kernings = (const font_kerning_t *) ( chars + FONT_CHAR_COUNT );
 
-        i++;
-    }
+    // print_font_info( header );
 
-    *out = value;
+    page_x = 0;
+    page_y = 0;
+    texture_w = header->scale_w;
+    texture_h = header->scale_h;
 
     return 0;
 }
 
-static int parse_string( char * out, parse_stream_t * stream )
+void font_t::place_in_atlas( atlas_region_t region )
 {
-    if ( stream->eof() ) return 1;
-
-    char c = stream->getc();
-
-    // expect quote
-    if ( c != '"' ) return 1;
-
-    for ( int i = 0; i < FONT_STR_LEN; i++ ) {
-        if ( stream->eof() ) return 1;
-
-        char c = stream->getc();
-
-        if ( c == '"' ) {
-            out[ i ] = '\0';
-            return 0;
-        } else {
-            out[ i ] = c;
-        }
-    }
-
-    return 1;
+    page_x = region.x - region.trim_x;
+    page_y = region.y - region.trim_y;
+    texture_w = region.atlas_w;
+    texture_h = region.atlas_h;
 }
 
-static void print_font_info( font_t * font )
+int font_t::kerning( int first, int second ) const
 {
-    INFO_LOG( "font description:" );
-    INFO_LOG( "  face:        %s", font->face );
-    INFO_LOG( "  file:        %s", font->file );
-    INFO_LOG( "  size:        %d", font->size );
-    INFO_LOG( "  line height: %d", font->line_height );
-    INFO_LOG( "  base:        %d", font->base );
-    INFO_LOG( "  scale w:     %d", font->scale_w );
-    INFO_LOG( "  scale h:     %d", font->scale_h );
-    INFO_LOG( "  char count:  %d", font->char_count );
-}
+    int lo = 0;
+    int hi = header->kerning_count;
 
-static int parse_font( font_t * font, parse_stream_t * stream )
-{
-    int error = 0;
-    error += parse_token( stream, "info face=" );
-    error += parse_string( font->face, stream );
-    error += parse_token( stream, "size=" );
-    error += parse_number( &font->size, stream );
-    error += parse_token( stream, "lineHeight=" );
-    error += parse_number( &font->line_height, stream );
-    error += parse_token( stream, "base=" );
-    error += parse_number( &font->base, stream );
-    error += parse_token( stream, "scaleW=" );
-    error += parse_number( &font->scale_w, stream );
-    error += parse_token( stream, "scaleH=" );
-    error += parse_number( &font->scale_h, stream );
-    error += parse_token( stream, "file=" );
-    error += parse_string( font->file, stream );
-    error += parse_token( stream, "chars count=" );
-    error += parse_number( &font->char_count, stream );
-
-    // if ( error == 0 ) {
-    //     print_font_info( font );
-    // }
-
-    if ( error == 0 ) {
-        for ( int i = 0; i < font->char_count; i++ ) {
-            int id;
-            error += parse_token( stream, "char id=" );
-            error += parse_number( &id, stream );
-
-            if ( id < 0 || id >= FONT_CHAR_COUNT ) continue;
-
-            font_char_t * c = font->chars + id;
-
-            error += parse_token( stream, "x=" );
-            error += parse_number( &c->x, stream );
-            error += parse_token( stream, "y=" );
-            error += parse_number( &c->y, stream );
-            error += parse_token( stream, "width=" );
-            error += parse_number( &c->width, stream );
-            error += parse_token( stream, "height=" );
-            error += parse_number( &c->height, stream );
-            error += parse_token( stream, "xoffset=" );
-            error += parse_number( &c->x_offset, stream );
-            error += parse_token( stream, "yoffset=" );
-            error += parse_number( &c->y_offset, stream );
-            error += parse_token( stream, "xadvance=" );
-            error += parse_number( &c->x_advance, stream );
-
-            if ( error ) break;
+    // binary search, the pairs are sorted at bake time
+    while ( lo < hi ) {
+        int mid = ( lo + hi ) / 2;
+        const font_kerning_t & k = kernings[ mid ];
+
+        if ( k.first < first || ( k.first == first && k.second < second ) ) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
         }
     }
 
-    return error;
-}
-
-/// the best font parser ever written :3
-int font_t::init( res_t res )
-{
-    parse_stream_t stream;
-    stream.data = (const char *) res.data;
-    stream.size = res.size;
-    stream.i = 0;
-
-    int error = parse_font( this, &stream );
-
-    if ( error ) {
-        ERROR_LOG( "failed to parse font" );
+    if ( lo < header->kerning_count && kernings[ lo ].first == first &&
+         kernings[ lo ].second == second ) {
+        return kernings[ lo ].amount;
     }
 
-    return error ? 1 : 0;
+    return 0;
 }
 
 int font_t::calc_glyphs(
@@ -199,35 +110,41 @@ int font_t::calc_glyphs(
     float text_width = 0.0f;
     float text_height = 0.0f;
 
-    const font_char_t * last_char_data = NULL;
+    int line_height = header->line_height;
+    int has_kerning = header->kerning_count > 0;
+    int last_c = -1;
 
     int text_len = strlen( text );
 
     int count = 0;
 
     for ( int i = 0; i < text_len; i++ ) {
-        char c = text[ i ];
+        // through unsigned char so bytes past ascii are too big, not negative
+        int c = (unsigned char) text[ i ];
 
         if ( c == '\n' ) {
             cursor_y += line_height;
             cursor_x = 0.0f;
+            last_c = -1;
             continue;
         }
 
-        if ( (int) c < 0 || (int) c >= FONT_CHAR_COUNT ) continue;
+        if ( c >= FONT_CHAR_COUNT ) continue;
 
         const font_char_t * char_data = chars + c;
 
         glyph_t glyph;
 
-        glyph.u1 = (float) ( char_data->x ) / scale_w;
-        glyph.u2 = (float) ( char_data->x + char_data->width ) / scale_w;
-        glyph.v1 = (float) ( char_data->y ) / scale_h;
-        glyph.v2 = (float) ( char_data->y + char_data->height ) / scale_h;
+        float x = page_x + char_data->x;
+        float y = page_y + char_data->y;
+        glyph.u1 = x / texture_w;
+        glyph.u2 = ( x + char_data->width ) / texture_w;
+        glyph.v1 = y / texture_h;
+        glyph.v2 = ( y + char_data->height ) / texture_h;
 
-        // if ( last_char_data ) {
-        //     cursor_x += last_char_data->kernings[ c ];
-        // }
+        if ( has_kerning && last_c >= 0 ) {
+            cursor_x += kerning( last_c, c );
+        }
 
         glyph.x = cursor_x + char_data->x_offset;
         glyph.y = cursor_y + char_data->y_offset;
@@ -239,7 +156,7 @@ int font_t::calc_glyphs(
 
         cursor_x += char_data->x_advance;
 
-        last_char_data = char_data;
+        last_c = c;
 
         if ( cursor_x > text_width ) {
             text_width = cursor_x;
@@ -2,6 +2,8 @@
 
 #define FONT_STR_LEN    64
 #define FONT_CHAR_COUNT 128
+#define FONT_MAGIC      0x544e4642 // "BFNT"
+#define FONT_VERSION    1
 
 #include "res.hpp"
 
@@ -15,6 +17,31 @@ typedef struct {
     int x_advance;
 } font_char_t;
 
+typedef struct {
+    int first;
+    int second;
+    int amount;
+} font_kerning_t;
+
+/// binary font the bake step converts every .fnt into, followed by
+/// FONT_CHAR_COUNT chars indexed by id and then kerning_count kernings sorted
+/// by first then second. tools/bake.c writes the same layout
+typedef struct {
+    int magic;
+    int version;
+
+    char face[ FONT_STR_LEN ];
+    char file[ FONT_STR_LEN ];
+
+    int size;
+    int line_height;
+    int base;
+    int scale_w;
+    int scale_h;
+    int char_count;
+    int kerning_count;
+} font_header_t;
+
 typedef struct {
     float u1;
     float u2;
@@ -28,21 +55,27 @@ typedef struct {
 
 } glyph_t;
 
+/// points into the baked resource, nothing is copied or parsed
 struct font_t {
-    char face[ FONT_STR_LEN ];
-    char file[ FONT_STR_LEN ];
+    const font_header_t * header;
+    const font_char_t * chars;
+    const font_kerning_t * kernings;
 
-    font_char_t chars[ FONT_CHAR_COUNT ];
-
-    int size;
-    int line_height;
-    int base;
-    int scale_w;
-    int scale_h;
-    int char_count;
+    // texture the char rects are looked up in, the font page by default
+    int page_x;
+    int page_y;
+    int texture_w;
+    int texture_h;
 
+    /// res is a .bfnt resource, fails when its layout does not match
     int init( res_t res );
 
+    /// maps the char rects of the page onto its baked atlas region
+    void place_in_atlas( atlas_region_t region );
+
+    /// extra advance between two chars, 0 for most pairs
+    int kerning( int first, int second ) const;
+
     int calc_glyphs(
         glyph_t * out,
         int * out_count,
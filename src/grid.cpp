@@ -0,0 +1,77 @@
+#include "grid.hpp"
+
+#include "logging.hpp"
+
+#include <math.h>
+#include <string.h>
+
+void grid_t::init( rect_t new_bounds, float new_cell_size, int new_item_cap )
+{
+    bounds = new_bounds;
+    cell_size = new_cell_size;
+    w = (int) ceilf( bounds.w / cell_size );
+    h = (int) ceilf( bounds.h / cell_size );
+    if ( w < 1 ) w = 1;
+    if ( h < 1 ) h = 1;
+
+    cell_start_list = new int[ w * h + 1 ];
+    item_cell_list = new int[ new_item_cap ];
+    item_list = new int[ new_item_cap ];
+    item_cap = new_item_cap;
+    item_count = 0;
+
+    memset( cell_start_list, 0, sizeof( int ) * ( w * h + 1 ) );
+}
+
+int grid_t::cell_x( float x ) const
+{
+    int cx = (int) floorf( ( x - bounds.x ) / cell_size );
+    if ( cx < 0 ) return 0;
+    if ( cx >= w ) return w - 1;
+    return cx;
+}
+
+int grid_t::cell_y( float y ) const
+{
+    int cy = (int) floorf( ( y - bounds.y ) / cell_size );
+    if ( cy < 0 ) return 0;
+    if ( cy >= h ) return h - 1;
+    return cy;
+}
+
+void grid_t::build( const vec2 * pos_list, int count )
+{
+    if ( count > item_cap ) {
+        ERROR_LOG( "grid overflow (%d > %d)", count, item_cap );
+        count = item_cap;
+    }
+
+    int cell_count = w * h;
+    memset( cell_start_list, 0, sizeof( int ) * ( cell_count + 1 ) );
+
+    // count items per cell
+    for ( int i = 0; i < count; i++ ) {
+        int c = cell_y( pos_list[ i ][ 1 ] ) * w + cell_x( pos_list[ i ][ 0 ] );
+        item_cell_list[ i ] = c;
+        cell_start_list[ c + 1 ]++;
+    }
+
+    // prefix sum into start offsets
+    for ( int c = 0; c < cell_count; c++ ) {
+        cell_start_list[ c + 1 ] += cell_start_list[ c ];
+    }
+
+    // scatter, using the start offsets as write cursors and restoring them
+    // afterwards by shifting the list down one cell
+    for ( int i = 0; i < count; i++ ) {
+        int c = item_cell_list[ i ];
+        item_list[ cell_start_list[ c ]++ ] = i;
+    }
+
+    for ( int c = cell_count; c > 0; c-- ) {
+        cell_start_list[ c ] = cell_start_list[ c - 1 ];
+    }
+    cell_start_list[ 0 ] = 0;
+
+    item_count = count;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "shape.hpp"
+
+#include <cglm/types.h>
+
+/// uniform bucket grid over a fixed world rect
+///
+/// built from a position list with a counting sort, so a build is two passes
+/// over the points and a query only walks the cells it overlaps. points
+/// outside the bounds are clamped into the border cells.
+struct grid_t {
+    rect_t bounds;
+    float cell_size;
+    int w;
+    int h;
+
+    int * cell_start_list; // w * h + 1 entries
+    int * item_cell_list;
+    int * item_list;
+    int item_cap;
+    int item_count;
+
+    void init( rect_t new_bounds, float new_cell_size, int new_item_cap );
+    void build( const vec2 * pos_list, int count );
+
+    int cell_x( float x ) const;
+    int cell_y( float y ) const;
+
+    /// calls f( index ) for every item in a cell overlapping r
+    /// this is a superset of the items inside r
+    template < typename F > void for_each( rect_t r, F f ) const
+    {
+        int x1 = cell_x( r.x );
+        int x2 = cell_x( r.x + r.w );
+        int y1 = cell_y( r.y );
+        int y2 = cell_y( r.y + r.h );
+
+        for ( int cy = y1; cy <= y2; cy++ ) {
+            for ( int cx = x1; cx <= x2; cx++ ) {
+                int c = cy * w + cx;
+                for ( int k = cell_start_list[ c ];
+                      k < cell_start_list[ c + 1 ];
+                      k++ ) {
+                    f( item_list[ k ] );
+                }
+            }
+        }
+    }
+};
@@ -9,12 +9,50 @@ enum event_t {
     EVENT_HAMMER_CCW,
     EVENT_FAST_HAMMER_CW,
     EVENT_FAST_HAMMER_CCW,
+    EVENT_TOGGLE_PROFILER,
+    EVENT_CYCLE_PRESENT_MODE,
+};
+
+enum present_mode_t {
+    PRESENT_VSYNC,    // wait for the display
+    PRESENT_UNCAPPED, // present as soon as a frame is done
+    PRESENT_LIMITED,  // pace frames to a target rate on the cpu
+    PRESENT_MODE_COUNT,
+};
+
+/// frame times between presents, in seconds, over the recent frames of the
+/// current mode
+struct present_stats_t {
+    int mode;
+    int frame_count;
+    float min_frame_time;
+    float avg_frame_time;
+    float p99_frame_time;
+    int missed_count; // frames that took longer than 1.5 deadlines
+    double wait_time; // total the limiter slept and spun, since the mode
+                      // changed
+    float deadline;   // seconds per frame the mode paces to, 0 unpaced
 };
 
 int hardware_init();
 void hardware_destroy();
 void hardware_set_loop( loop_function_t step );
 
+/// presents the back buffer, the calling thread must own the gl context
+void hardware_swap();
+
+/// takes effect at the next swap. rate is the target of PRESENT_LIMITED in
+/// frames per second
+void hardware_set_present_mode( int mode, float rate );
+
+present_stats_t hardware_present_stats();
+
+/// binds (1) or releases (0) the gl context on the calling thread
+void hardware_make_current( int current );
+
+/// gl entry points outside the loaded profile, nullptr when missing
+void * hardware_gl_proc( const char * name );
+
 int * hardware_events( int * out_count );
 
 int hardware_width();
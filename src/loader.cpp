@@ -0,0 +1,193 @@
+#include "loader.hpp"
+
+#include "logging.hpp"
+#include "profiler.hpp"
+
+#include <mutex>
+#include <stdio.h>
+#include <string.h>
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+// jobs run on their own threads, the web build has none so they are
+// deferred and run on the first wait instead
+#ifndef LOADER_THREADS
+#if defined( __EMSCRIPTEN__ )
+#define LOADER_THREADS 0
+#else
+#define LOADER_THREADS 1
+#endif
+#endif
+
+static const std::launch k_launch =
+    LOADER_THREADS ? std::launch::async : std::launch::deferred;
+
+static const int k_job_cap = 32;
+static const int k_job_name_len = 64;
+
+template < typename T > struct job_t {
+    char name[ k_job_name_len ];
+    std::shared_future< T > result;
+};
+
+static struct {
+    std::mutex mutex; // the job lists
+
+    job_t< image_t > image_list[ k_job_cap ];
+    int image_count;
+
+    job_t< wav_t > sound_list[ k_job_cap ];
+    int sound_count;
+
+    // jobs add to it while flush may be waiting on them under the other lock
+    std::mutex busy_mutex;
+    double busy_time;
+} intern;
+
+static void add_busy_time( double start )
+{
+    double time = profiler_clock() - start;
+
+    std::lock_guard< std::mutex > lock( intern.busy_mutex );
+    intern.busy_time += time;
+}
+
+static image_t decode_image( res_name_t name )
+{
+    double start = profiler_clock();
+
+    image_t image = {};
+    res_t res = find_res( name );
+
+    tex_header_t header = {};
+    if ( res.size >= (int) sizeof( tex_header_t ) ) {
+        memcpy( &header, res.data, sizeof( tex_header_t ) );
+    }
+
+    if ( header.magic == TEX_MAGIC ) {
+        int pixel_size = header.format == IMAGE_RGBA4444 ? 2 : 4;
+        int size = header.width * header.height * pixel_size;
+
+        if ( header.version == TEX_VERSION && header.width > 0 &&
+             header.height > 0 &&
+             res.size - (int) sizeof( tex_header_t ) >= size ) {
+            image.pixels = res.data + sizeof( tex_header_t );
+            image.width = header.width;
+            image.height = header.height;
+            image.format = header.format;
+        }
+    } else if ( res.data ) {
+        int channels;
+        image.pixels = stbi_load_from_memory(
+            res.data,
+            res.size,
+            &image.width,
+            &image.height,
+            &channels,
+            4
+        );
+        image.format = IMAGE_RGBA8;
+        image.owned = 1;
+    }
+
+    if ( !image.pixels ) {
+        ERROR_LOG( "failed to decode image: %s", name.name );
+    }
+
+    add_busy_time( start );
+    return image;
+}
+
+static wav_t decode_sound( res_name_t name )
+{
+    double start = profiler_clock();
+
+    wav_t wav = {};
+    res_t res = find_res( name );
+
+    if ( parse_wav( res.data, res.size, &wav ) ) {
+        ERROR_LOG( "failed to parse sound: %s", name.name );
+        wav = {};
+    }
+
+    add_busy_time( start );
+    return wav;
+}
+
+/// the running job for the name, or a new one. the job gets its own copy of
+/// the name since runtime names may not outlive the call
+template < typename T >
+static std::shared_future< T > find_job(
+    job_t< T > * job_list,
+    int * job_count,
+    res_name_t name,
+    T ( *decode )( res_name_t name )
+)
+{
+    std::lock_guard< std::mutex > lock( intern.mutex );
+
+    for ( int i = 0; i < *job_count; i++ ) {
+        if ( strcmp( job_list[ i ].name, name.name ) == 0 ) {
+            return job_list[ i ].result;
+        }
+    }
+
+    if ( *job_count >= k_job_cap ) {
+        ERROR_LOG( "too many loader jobs, %s is decoded in place", name.name );
+        std::promise< T > promise;
+        promise.set_value( decode( name ) );
+        return promise.get_future().share();
+    }
+
+    job_t< T > & job = job_list[ *job_count ];
+    snprintf( job.name, k_job_name_len, "%s", name.name );
+    job.result = std::async( k_launch, decode, res_name_t( job.name ) ).share();
+    ( *job_count )++;
+
+    return job.result;
+}
+
+std::shared_future< image_t > load_image( res_name_t name )
+{
+    return find_job(
+        intern.image_list,
+        &intern.image_count,
+        name,
+        decode_image
+    );
+}
+
+std::shared_future< wav_t > load_sound( res_name_t name )
+{
+    return find_job(
+        intern.sound_list,
+        &intern.sound_count,
+        name,
+        decode_sound
+    );
+}
+
+void loader_flush()
+{
+    std::lock_guard< std::mutex > lock( intern.mutex );
+
+    for ( int i = 0; i < intern.image_count; i++ ) {
+        const image_t & image = intern.image_list[ i ].result.get();
+        if ( image.owned ) stbi_image_free( (void *) image.pixels );
+        intern.image_list[ i ].result = {};
+    }
+    intern.image_count = 0;
+
+    for ( int i = 0; i < intern.sound_count; i++ ) {
+        intern.sound_list[ i ].result.wait();
+        intern.sound_list[ i ].result = {};
+    }
+    intern.sound_count = 0;
+}
+
+float loader_busy_time()
+{
+    std::lock_guard< std::mutex > lock( intern.busy_mutex );
+    return (float) intern.busy_time;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "res.hpp"
+#include "wav.hpp"
+
+#include <future>
+
+#include <stdint.h>
+
+#define TEX_MAGIC   0x58455442 // "BTEX"
+#define TEX_VERSION 1
+
+enum image_format_t {
+    IMAGE_RGBA8,
+    IMAGE_RGBA4444, // one native short per pixel, red in the top bits
+};
+
+/// texture bake writes for the atlas, followed by the pixels in format, rows
+/// top to bottom. tools/bake.c writes the same layout
+struct tex_header_t {
+    uint32_t magic;
+    uint32_t version;
+    int32_t width;
+    int32_t height;
+    int32_t format;
+    uint32_t reserved[ 3 ];
+};
+
+/// rows top to bottom. pixels is nullptr when decoding failed
+struct image_t {
+    const unsigned char * pixels;
+    int width;
+    int height;
+    int format;
+    int owned; // decoded from a png, freed by loader_flush()
+};
+
+/// decodes the image on a worker, baked textures are used in place with no
+/// decoding at all. asking for the same name again gives the
+/// same future until loader_flush(), so startup can request everything early
+/// and the owners just wait for it before uploading
+std::shared_future< image_t > load_image( res_name_t name );
+
+/// parses the wav on a worker, the samples point into the resource. the
+/// samples field is nullptr when parsing failed
+std::shared_future< wav_t > load_sound( res_name_t name );
+
+/// waits for every job and frees the decoded images, owners must have copied
+/// or uploaded what they need
+void loader_flush();
+
+/// seconds the jobs spent decoding so far, summed over workers
+float loader_busy_time();
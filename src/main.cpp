@@ -1,6 +1,9 @@
 #include "audio.hpp"
 #include "hardware.hpp"
+#include "loader.hpp"
 #include "logging.hpp"
+#include "pack.hpp"
+#include "profiler.hpp"
 #include "render.hpp"
 #include "state.hpp"
 #include "utils.hpp"
@@ -9,6 +12,13 @@
 
 #include <math.h>
 
+static const int k_bullet_cap = 4096;
+static const float k_frame_limit_rate = 120.0f; // PRESENT_LIMITED target
+
+// time to first frame, from the top of main()
+static double start_time;
+static bool first_frame_done;
+
 static float clamp( float x, float min, float max )
 {
     if ( x < min ) return min;
@@ -24,11 +34,29 @@ static void init_room_table()
 
 static void init_bullet_table()
 {
-    int cap = 4096;
+    int cap = k_bullet_cap;
     state.bullet_pos_list = new vec2[ cap ];
     state.bullet_old_pos_list = new vec2[ cap ];
 }
 
+/// bullets are always constrained to rooms, so the grid only has to cover
+/// the bounding box of the rooms
+static void init_bullet_grid()
+{
+    rect_t bounds = state.room_rect_list[ 0 ];
+    for ( int i = 1; i < state.room_count; i++ ) {
+        rect_t r = state.room_rect_list[ i ];
+        float x2 = fmaxf( bounds.x + bounds.w, r.x + r.w );
+        float y2 = fmaxf( bounds.y + bounds.h, r.y + r.h );
+        bounds.x = fminf( bounds.x, r.x );
+        bounds.y = fminf( bounds.y, r.y );
+        bounds.w = x2 - bounds.x;
+        bounds.h = y2 - bounds.y;
+    }
+
+    state.bullet_grid.init( bounds, 100.0f, k_bullet_cap );
+}
+
 static void init_line_bullet_table()
 {
     int cap = 4096;
@@ -287,6 +315,8 @@ static void do_funny()
 
 static void tick()
 {
+    profiler_begin( PROFILE_EVENTS );
+
     if ( state.funny_timer ) {
         state.funny_timer -= state.tick_step;
         if ( state.funny_timer <= 0.0f ) {
@@ -316,37 +346,85 @@ static void tick()
         }
     }
 
-    audio_tick();
+    profiler_end( PROFILE_EVENTS );
+    profiler_begin( PROFILE_BULLETS );
 
     for ( int i = state.bullet_count - 1; i >= 0; i-- ) {
         tick_bullet( i );
     }
 
+    profiler_end( PROFILE_BULLETS );
+    profiler_begin( PROFILE_LINE_BULLETS );
+
     for ( int i = 0; i < state.line_bullet_count; i++ ) {
         tick_line_bullet( i );
     }
 
+    profiler_end( PROFILE_LINE_BULLETS );
+    profiler_begin( PROFILE_PLAYER );
+
     tick_player();
     tick_hammer();
 
+    profiler_end( PROFILE_PLAYER );
+    profiler_begin( PROFILE_COLLISION );
+
+    state.bullet_grid.build( state.bullet_pos_list, state.bullet_count );
+
     if ( state.player_z == 0.0f ) { // only if player is on the ground
-        for ( int i = 0; i < state.bullet_count; i++ ) {
+        rect_t r;
+        r.x = state.player_pos[ 0 ];
+        r.y = state.player_pos[ 1 ];
+        r.w = 0.0f;
+        r.h = 0.0f;
+        r.margin( -5.0f );
+
+        state.bullet_grid.for_each( r, []( int i ) {
             if ( glm_vec2_distance(
                      state.player_pos,
                      state.bullet_pos_list[ i ]
                  ) < 5.0f ) {
                 state.scene = SCENE_LOSE;
             }
-        }
+        } );
     }
 
     if ( glm_vec2_distance( state.player_pos, state.exit_pos ) < 50.0f ) {
         state.scene = SCENE_WIN;
     }
+
+    profiler_end( PROFILE_COLLISION );
+}
+
+static void cycle_present_mode()
+{
+    static const char * k_name_list[ PRESENT_MODE_COUNT ] = {
+        "vsync",
+        "uncapped",
+        "limited",
+    };
+
+    int mode = ( hardware_present_stats().mode + 1 ) % PRESENT_MODE_COUNT;
+    hardware_set_present_mode( mode, k_frame_limit_rate );
+    INFO_LOG( "present mode: %s", k_name_list[ mode ] );
 }
 
 static void loop()
 {
+    profiler_begin_frame();
+
+    {
+        int event_count;
+        int * events = hardware_events( &event_count );
+
+        for ( int i = 0; i < event_count; i++ ) {
+            if ( events[ i ] == EVENT_TOGGLE_PROFILER ) profiler_toggle();
+            if ( events[ i ] == EVENT_CYCLE_PRESENT_MODE ) {
+                cycle_present_mode();
+            }
+        }
+    }
+
     float time = hardware_time();
 
     state.tick_step = fminf( time - state.tick_time, 1 / 60.0f );
@@ -371,7 +449,35 @@ static void loop()
         }
     }
 
+    // every scene, so sounds asked for outside gameplay start this frame too
+    audio_tick();
+
     render();
+
+    // the render thread presents after render() returned, the swap time of
+    // the first frame only comes back with the next one
+    double first_present = render_stats().first_present;
+
+    if ( !first_frame_done && first_present > 0.0 ) {
+        first_frame_done = true;
+        INFO_LOG(
+            "first frame after %.1fms, %.1fms of decoding on workers",
+            ( first_present - start_time ) * 1000.0,
+            loader_busy_time() * 1000.0f
+        );
+
+        // everything was uploaded by now
+        loader_flush();
+    }
+}
+
+/// decodes start on workers right away, render_init() and audio_init() only
+/// wait for them and upload
+static void start_loading()
+{
+    load_image( "atlas.tex" );
+    load_sound( "click.wav" );
+    load_sound( "hurt.wav" );
 }
 
 static void setup_rooms()
@@ -402,6 +508,8 @@ static void setup_rooms()
 
     state.exit_pos[ 0 ] = 1450;
     state.exit_pos[ 1 ] = -850;
+
+    state.level_version++;
 }
 
 static void setup_bullets()
@@ -432,6 +540,8 @@ static void init()
     setup_rooms();
     setup_bullets();
 
+    init_bullet_grid();
+
     state.player_pos[ 0 ] = 500;
     state.player_pos[ 1 ] = 500;
 
@@ -444,8 +554,19 @@ int WinMain()
 int main()
 #endif
 {
+    start_time = profiler_clock();
+
     INFO_LOG( "meow" );
 
+    // assets from the pack next to the binary when there is one, the
+    // embedded ones otherwise. the path is logged either way, so a stale
+    // pack winning over newer embedded assets shows up
+    char pack_path[ 1024 ];
+    pack_binary_path( "res.pack", pack_path, sizeof( pack_path ) );
+    pack_open( pack_path );
+
+    start_loading();
+
     hardware_init();
 
     init();
@@ -458,9 +579,13 @@ int main()
 
     hardware_set_loop( loop );
 
+    render_destroy();
+
     audio_destroy();
 
     hardware_destroy();
 
+    pack_close();
+
     return 0;
 }
@@ -0,0 +1,398 @@
+#include "mixer.hpp"
+
+#include "logging.hpp"
+
+#include <math.h>
+#include <string.h>
+
+#if defined( __SSE2__ ) || defined( _M_X64 )
+#include <emmintrin.h>
+#define MIXER_SSE 1
+#else
+#define MIXER_SSE 0
+#endif
+
+#define MIXER_SOUND_CAP 64
+
+// frames mixed per pass, the scratch buffers hold one pass
+static const int k_block_frames = 256;
+
+// source frames one resampled pass may read, more at high pitch just takes
+// more passes
+static const int k_span_frames = k_block_frames * 2 + 3;
+
+struct mixer_sound_t {
+    const unsigned char * samples;
+    int frame_count;
+    int channels;
+    int bits_per_sample; // 8 is unsigned, 16 signed
+    float rate_ratio;    // source frames per output frame at pitch 1
+};
+
+struct mixer_voice_t {
+    int playing;
+    int sound;
+    double position; // in source frames
+    float step;      // source frames per output frame
+    float gain_left;
+    float gain_right;
+};
+
+static struct {
+    mixer_sound_t sound_list[ MIXER_SOUND_CAP ];
+    int sound_count;
+
+    mixer_voice_t voice_list[ MIXER_VOICE_COUNT ];
+
+    // the stereo sum of a pass, one voice's share of it as floats and the
+    // source span a resampled voice reads from
+    alignas( 16 ) float mix[ k_block_frames * 2 ];
+    alignas( 16 ) float voice[ k_block_frames * 2 ];
+    alignas( 16 ) float span[ k_span_frames * 2 ];
+} intern;
+
+////////////////////////////////////////////////////////////////////////////////
+// passes
+////////////////////////////////////////////////////////////////////////////////
+
+/// count frames of the sound from first on as floats in [ -1, 1 ], in the
+/// sound's own channel layout
+static void convert(
+    const mixer_sound_t & sound,
+    int first,
+    int count,
+    float * out
+)
+{
+    int n = count * sound.channels;
+    int i = 0;
+
+    if ( sound.bits_per_sample == 8 ) {
+        const unsigned char * in = sound.samples + first * sound.channels;
+
+#if MIXER_SSE
+        // widen 16 bytes to four registers of 32 bit lanes
+        __m128i zero = _mm_setzero_si128();
+        __m128 bias = _mm_set1_ps( 128.0f );
+        __m128 scale = _mm_set1_ps( 1.0f / 128.0f );
+
+        for ( ; i + 16 <= n; i += 16 ) {
+            __m128i b = _mm_loadu_si128( (const __m128i *) ( in + i ) );
+            __m128i lo = _mm_unpacklo_epi8( b, zero );
+            __m128i hi = _mm_unpackhi_epi8( b, zero );
+            __m128i w[ 4 ] = {
+                _mm_unpacklo_epi16( lo, zero ),
+                _mm_unpackhi_epi16( lo, zero ),
+                _mm_unpacklo_epi16( hi, zero ),
+                _mm_unpackhi_epi16( hi, zero ),
+            };
+
+            for ( int k = 0; k < 4; k++ ) {
+                __m128 f = _mm_sub_ps( _mm_cvtepi32_ps( w[ k ] ), bias );
+                _mm_storeu_ps( out + i + k * 4, _mm_mul_ps( f, scale ) );
+            }
+        }
+#endif
+
+        for ( ; i < n; i++ ) {
+            out[ i ] = ( in[ i ] - 128.0f ) * ( 1.0f / 128.0f );
+        }
+    } else {
+        const unsigned char * in = sound.samples + first * sound.channels * 2;
+
+#if MIXER_SSE
+        // each short goes to the top of a 32 bit lane, the arithmetic shift
+        // back down sign extends it
+        __m128i zero = _mm_setzero_si128();
+        __m128 scale = _mm_set1_ps( 1.0f / 32768.0f );
+
+        for ( ; i + 8 <= n; i += 8 ) {
+            __m128i s = _mm_loadu_si128( (const __m128i *) ( in + i * 2 ) );
+            __m128i lo = _mm_srai_epi32( _mm_unpacklo_epi16( zero, s ), 16 );
+            __m128i hi = _mm_srai_epi32( _mm_unpackhi_epi16( zero, s ), 16 );
+            __m128 a = _mm_mul_ps( _mm_cvtepi32_ps( lo ), scale );
+            __m128 b = _mm_mul_ps( _mm_cvtepi32_ps( hi ), scale );
+            _mm_storeu_ps( out + i, a );
+            _mm_storeu_ps( out + i + 4, b );
+        }
+#endif
+
+        for ( ; i < n; i++ ) {
+            int16_t x;
+            memcpy( &x, in + i * 2, 2 );
+            out[ i ] = x * ( 1.0f / 32768.0f );
+        }
+    }
+}
+
+/// linear interpolation at position, position + step and so on, counted in
+/// frames from the start of in. the gathers keep this one scalar
+static void resample(
+    const float * in,
+    int channels,
+    double position,
+    float step,
+    int count,
+    float * out
+)
+{
+    for ( int i = 0; i < count; i++ ) {
+        double p = position + i * (double) step;
+        int j = (int) p;
+        float t = (float) ( p - j );
+
+        for ( int c = 0; c < channels; c++ ) {
+            float a = in[ j * channels + c ];
+            float b = in[ ( j + 1 ) * channels + c ];
+            out[ i * channels + c ] = a + ( b - a ) * t;
+        }
+    }
+}
+
+/// adds count frames of in, mono or stereo, to the stereo mix
+static void accumulate(
+    const float * in,
+    int count,
+    int channels,
+    float gain_left,
+    float gain_right,
+    float * mix
+)
+{
+    int i = 0;
+
+    if ( channels == 1 ) {
+#if MIXER_SSE
+        // four mono frames make two registers of l r l r
+        __m128 left = _mm_set1_ps( gain_left );
+        __m128 right = _mm_set1_ps( gain_right );
+
+        for ( ; i + 4 <= count; i += 4 ) {
+            __m128 m = _mm_loadu_ps( in + i );
+            __m128 l = _mm_mul_ps( m, left );
+            __m128 r = _mm_mul_ps( m, right );
+
+            float * out = mix + i * 2;
+            _mm_storeu_ps(
+                out,
+                _mm_add_ps( _mm_loadu_ps( out ), _mm_unpacklo_ps( l, r ) )
+            );
+            _mm_storeu_ps(
+                out + 4,
+                _mm_add_ps( _mm_loadu_ps( out + 4 ), _mm_unpackhi_ps( l, r ) )
+            );
+        }
+#endif
+
+        for ( ; i < count; i++ ) {
+            mix[ i * 2 + 0 ] += in[ i ] * gain_left;
+            mix[ i * 2 + 1 ] += in[ i ] * gain_right;
+        }
+    } else {
+#if MIXER_SSE
+        __m128 gain =
+            _mm_setr_ps( gain_left, gain_right, gain_left, gain_right );
+
+        for ( ; i + 2 <= count; i += 2 ) {
+            float * out = mix + i * 2;
+            __m128 s = _mm_mul_ps( _mm_loadu_ps( in + i * 2 ), gain );
+            _mm_storeu_ps( out, _mm_add_ps( _mm_loadu_ps( out ), s ) );
+        }
+#endif
+
+        for ( ; i < count; i++ ) {
+            mix[ i * 2 + 0 ] += in[ i * 2 + 0 ] * gain_left;
+            mix[ i * 2 + 1 ] += in[ i * 2 + 1 ] * gain_right;
+        }
+    }
+}
+
+/// clips the mix to 16 bit, count is in samples
+static void write_output( const float * mix, int count, int16_t * out )
+{
+    int i = 0;
+
+#if MIXER_SSE
+    // clamped first, out of range floats convert to the most negative int
+    __m128 lo = _mm_set1_ps( -1.0f );
+    __m128 hi = _mm_set1_ps( 1.0f );
+    __m128 scale = _mm_set1_ps( 32767.0f );
+
+    for ( ; i + 8 <= count; i += 8 ) {
+        __m128 a = _mm_min_ps( _mm_max_ps( _mm_loadu_ps( mix + i ), lo ), hi );
+        __m128 b =
+            _mm_min_ps( _mm_max_ps( _mm_loadu_ps( mix + i + 4 ), lo ), hi );
+        __m128i s = _mm_packs_epi32(
+            _mm_cvtps_epi32( _mm_mul_ps( a, scale ) ),
+            _mm_cvtps_epi32( _mm_mul_ps( b, scale ) )
+        );
+        _mm_storeu_si128( (__m128i *) ( out + i ), s );
+    }
+#endif
+
+    for ( ; i < count; i++ ) {
+        float x = mix[ i ];
+        if ( x < -1.0f ) x = -1.0f;
+        if ( x > 1.0f ) x = 1.0f;
+        out[ i ] = (int16_t) lrintf( x * 32767.0f );
+    }
+}
+
+/// adds up to count frames of the voice to the mix, it stops when the sound
+/// runs out
+static void mix_voice( mixer_voice_t & voice, int count )
+{
+    const mixer_sound_t & sound = intern.sound_list[ voice.sound ];
+
+    // without pitch or rate change the samples are read as they are,
+    // otherwise every frame needs the one after it to interpolate towards
+    int direct = voice.step == 1.0f;
+    int end = direct ? sound.frame_count : sound.frame_count - 1;
+
+    int done = 0;
+
+    while ( done < count && voice.position < end ) {
+        int n = count - done;
+        int first = (int) voice.position;
+
+        if ( direct ) {
+            if ( n > end - first ) n = end - first;
+            convert( sound, first, n, intern.voice );
+        } else {
+            double offset = voice.position - first;
+
+            double room = ( end - voice.position ) / voice.step;
+            if ( room < n ) n = (int) ceil( room );
+
+            int cap = (int) ( ( k_span_frames - 3 ) / voice.step ) + 1;
+            if ( n > cap ) n = cap;
+
+            // rounding can put the last frame right on the end
+            int span = (int) ( offset + ( n - 1 ) * (double) voice.step ) + 2;
+            while ( n > 1 && first + span > sound.frame_count ) {
+                n--;
+                span = (int) ( offset + ( n - 1 ) * (double) voice.step ) + 2;
+            }
+            if ( first + span > sound.frame_count ) break;
+
+            convert( sound, first, span, intern.span );
+            resample(
+                intern.span,
+                sound.channels,
+                offset,
+                voice.step,
+                n,
+                intern.voice
+            );
+        }
+
+        accumulate(
+            intern.voice,
+            n,
+            sound.channels,
+            voice.gain_left,
+            voice.gain_right,
+            intern.mix + done * 2
+        );
+
+        voice.position += n * (double) voice.step;
+        done += n;
+    }
+
+    if ( done < count || voice.position >= end ) voice.playing = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// interface
+////////////////////////////////////////////////////////////////////////////////
+
+int mixer_add_sound( const wav_t & wav )
+{
+    if ( intern.sound_count == MIXER_SOUND_CAP ) {
+        ERROR_LOG( "too many sounds, %d at most", MIXER_SOUND_CAP );
+        return -1;
+    }
+
+    if ( !wav.samples || wav.sample_rate <= 0 ||
+         ( wav.channels != 1 && wav.channels != 2 ) ||
+         ( wav.bits_per_sample != 8 && wav.bits_per_sample != 16 ) ) {
+        ERROR_LOG(
+            "can not mix %d channel %d bit sound",
+            wav.channels,
+            wav.bits_per_sample
+        );
+        return -1;
+    }
+
+    mixer_sound_t & sound = intern.sound_list[ intern.sound_count ];
+    sound.samples = wav.samples;
+    sound.channels = wav.channels;
+    sound.bits_per_sample = wav.bits_per_sample;
+    sound.frame_count =
+        wav.size / ( wav.channels * wav.bits_per_sample / 8 );
+    sound.rate_ratio = (float) wav.sample_rate / MIXER_RATE;
+
+    return intern.sound_count++;
+}
+
+void mixer_play( int voice, int sound, float gain, float pan, float pitch )
+{
+    if ( voice < 0 || voice >= MIXER_VOICE_COUNT ) return;
+    if ( sound < 0 || sound >= intern.sound_count ) return;
+
+    if ( pitch < 1.0f / MIXER_MAX_PITCH ) pitch = 1.0f / MIXER_MAX_PITCH;
+    if ( pitch > MIXER_MAX_PITCH ) pitch = MIXER_MAX_PITCH;
+    if ( pan < -1.0f ) pan = -1.0f;
+    if ( pan > 1.0f ) pan = 1.0f;
+
+    // the centre keeps the full gain on both sides
+    mixer_voice_t & v = intern.voice_list[ voice ];
+    v.playing = 1;
+    v.sound = sound;
+    v.position = 0.0;
+    v.step = pitch * intern.sound_list[ sound ].rate_ratio;
+    v.gain_left = gain * ( pan > 0.0f ? 1.0f - pan : 1.0f );
+    v.gain_right = gain * ( pan < 0.0f ? 1.0f + pan : 1.0f );
+}
+
+void mixer_stop( int voice )
+{
+    if ( voice < 0 || voice >= MIXER_VOICE_COUNT ) return;
+
+    intern.voice_list[ voice ].playing = 0;
+}
+
+int mixer_playing( int voice )
+{
+    if ( voice < 0 || voice >= MIXER_VOICE_COUNT ) return 0;
+
+    return intern.voice_list[ voice ].playing;
+}
+
+void mixer_mix( int16_t * out, int frame_count )
+{
+    while ( frame_count > 0 ) {
+        int n = frame_count < k_block_frames ? frame_count : k_block_frames;
+
+        memset( intern.mix, 0, n * 2 * sizeof( float ) );
+
+        for ( int i = 0; i < MIXER_VOICE_COUNT; i++ ) {
+            if ( intern.voice_list[ i ].playing ) {
+                mix_voice( intern.voice_list[ i ], n );
+            }
+        }
+
+        write_output( intern.mix, n * 2, out );
+
+        out += n * 2;
+        frame_count -= n;
+    }
+}
+
+void mixer_reset()
+{
+    for ( int i = 0; i < MIXER_VOICE_COUNT; i++ ) {
+        intern.voice_list[ i ].playing = 0;
+    }
+    intern.sound_count = 0;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "wav.hpp"
+
+#include <stdint.h>
+
+#define MIXER_RATE        44100
+#define MIXER_VOICE_COUNT 64
+#define MIXER_MAX_PITCH   4.0f
+
+/// registers the samples of a parsed wav, mixed in place from the resource
+/// so it has to outlive the mixer. -1 for formats the mixer can not read,
+/// anything but 8 or 16 bit mono or stereo
+int mixer_add_sound( const wav_t & wav );
+
+/// starts the sound from the beginning on the voice, replacing whatever it
+/// played. pan goes from -1 (left) to 1 (right), pitch scales the speed and
+/// is clamped to [ 1 / MIXER_MAX_PITCH, MIXER_MAX_PITCH ]
+void mixer_play( int voice, int sound, float gain, float pan, float pitch );
+
+void mixer_stop( int voice );
+
+/// 0 once the voice ran out of samples or was stopped
+int mixer_playing( int voice );
+
+/// mixes the next frame_count frames of every playing voice into out as
+/// interleaved 16 bit stereo at MIXER_RATE, clipping what goes over
+void mixer_mix( int16_t * out, int frame_count );
+
+/// forgets every sound and stops every voice
+void mixer_reset();
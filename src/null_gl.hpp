@@ -0,0 +1,25 @@
+#pragma once
+
+/// everything the null gl backend was asked to do since the last reset
+struct null_gl_stats_t {
+    int call_count;
+    int draw_count;
+    long long vertex_count;
+    long long upload_bytes; // buffer and texture data
+
+    // binds that changed the bound object
+    int program_change_count;
+    int texture_change_count;
+    int buffer_change_count;
+    int framebuffer_change_count;
+
+    int uniform_count;
+};
+
+/// gl entry point by name, for gladLoadGLLoader. nullptr for calls the
+/// renderer never makes
+void * null_gl_proc( const char * name );
+
+const null_gl_stats_t & null_gl_stats();
+
+void null_gl_reset_stats();
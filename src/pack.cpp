@@ -0,0 +1,420 @@
+#include "pack.hpp"
+
+#include "logging.hpp"
+
+#include <mutex>
+#include <stdio.h>
+#include <string.h>
+
+#if defined( _WIN32 )
+#include <windows.h>
+#elif !defined( __EMSCRIPTEN__ )
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static_assert( sizeof( pack_header_t ) == 32, "pack header layout" );
+static_assert( sizeof( pack_entry_t ) == 64, "pack entry layout" );
+static_assert( sizeof( pack_atlas_t ) == 64, "pack atlas layout" );
+
+static struct {
+    const unsigned char * data; // the whole file, nullptr while closed
+    int size;
+
+    const pack_header_t * header;
+    const pack_entry_t * entry_list;
+    const pack_atlas_t * atlas_list;
+
+    // decompressed entries by index, filled on first access
+    unsigned char ** cache_list;
+    std::mutex cache_mutex;
+
+#if defined( _WIN32 )
+    HANDLE file;
+    HANDLE mapping;
+#endif
+} intern;
+
+////////////////////////////////////////////////////////////////////////////////
+// mapping
+////////////////////////////////////////////////////////////////////////////////
+
+#if defined( _WIN32 )
+
+static const unsigned char * map_file( const char * path, int * out_size )
+{
+    intern.file = CreateFileA(
+        path,
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL,
+        nullptr
+    );
+    if ( intern.file == INVALID_HANDLE_VALUE ) return nullptr;
+
+    LARGE_INTEGER size;
+    if ( !GetFileSizeEx( intern.file, &size ) || size.QuadPart <= 0 ||
+         size.QuadPart > 0x7fffffff ) {
+        CloseHandle( intern.file );
+        return nullptr;
+    }
+
+    intern.mapping = CreateFileMappingA(
+        intern.file,
+        nullptr,
+        PAGE_READONLY,
+        0,
+        0,
+        nullptr
+    );
+    if ( !intern.mapping ) {
+        CloseHandle( intern.file );
+        return nullptr;
+    }
+
+    void * data = MapViewOfFile( intern.mapping, FILE_MAP_READ, 0, 0, 0 );
+    if ( !data ) {
+        CloseHandle( intern.mapping );
+        CloseHandle( intern.file );
+        return nullptr;
+    }
+
+    *out_size = (int) size.QuadPart;
+    return (const unsigned char *) data;
+}
+
+static void unmap_file()
+{
+    UnmapViewOfFile( intern.data );
+    CloseHandle( intern.mapping );
+    CloseHandle( intern.file );
+}
+
+static int binary_path( char * out, int out_size )
+{
+    DWORD len = GetModuleFileNameA( nullptr, out, out_size );
+    return len > 0 && (int) len < out_size ? (int) len : 0;
+}
+
+#elif !defined( __EMSCRIPTEN__ )
+
+static const unsigned char * map_file( const char * path, int * out_size )
+{
+    int fd = open( path, O_RDONLY );
+    if ( fd < 0 ) return nullptr;
+
+    struct stat st;
+    if ( fstat( fd, &st ) != 0 || st.st_size <= 0 ||
+         st.st_size > 0x7fffffff ) {
+        close( fd );
+        return nullptr;
+    }
+
+    // the mapping stays valid after the descriptor is closed
+    void * data = mmap( nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    close( fd );
+
+    if ( data == MAP_FAILED ) return nullptr;
+
+    *out_size = (int) st.st_size;
+    return (const unsigned char *) data;
+}
+
+static void unmap_file()
+{
+    munmap( (void *) intern.data, intern.size );
+}
+
+/// linux only, elsewhere the pack is looked for in the working directory
+static int binary_path( char * out, int out_size )
+{
+    // a path that filled the buffer may have been cut short
+    ssize_t len = readlink( "/proc/self/exe", out, out_size );
+    return len > 0 && len < out_size ? (int) len : 0;
+}
+
+#else
+
+// the web build only has the embedded resources
+static const unsigned char * map_file( const char *, int * )
+{
+    return nullptr;
+}
+
+static void unmap_file()
+{
+}
+
+static int binary_path( char *, int )
+{
+    return 0;
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// lz4
+////////////////////////////////////////////////////////////////////////////////
+
+/// lz4 length, the 4 bit field in the token continued by bytes while they
+/// are 255. -1 when it runs off the end
+static int read_length(
+    const unsigned char * src,
+    int src_len,
+    int * s,
+    int len
+)
+{
+    if ( len != 15 ) return len;
+
+    for ( ;; ) {
+        if ( *s >= src_len ) return -1;
+        int b = src[ ( *s )++ ];
+        len += b;
+        if ( b != 255 ) return len;
+    }
+}
+
+/// lz4 block format, every read and write is bounds checked since the pack
+/// comes from outside the binary
+static int lz4_decompress(
+    const unsigned char * src,
+    int src_len,
+    unsigned char * dst,
+    int dst_len
+)
+{
+    int s = 0;
+    int d = 0;
+
+    while ( s < src_len ) {
+        int token = src[ s++ ];
+
+        int literal_len = read_length( src, src_len, &s, token >> 4 );
+        if ( literal_len < 0 ) return 1;
+        if ( literal_len > src_len - s || literal_len > dst_len - d ) return 1;
+
+        memcpy( dst + d, src + s, literal_len );
+        s += literal_len;
+        d += literal_len;
+
+        // the last sequence has no match
+        if ( s == src_len ) break;
+
+        if ( src_len - s < 2 ) return 1;
+        int offset = src[ s ] | ( src[ s + 1 ] << 8 );
+        s += 2;
+        if ( offset == 0 || offset > d ) return 1;
+
+        int match_len = read_length( src, src_len, &s, token & 15 );
+        if ( match_len < 0 ) return 1;
+        match_len += 4;
+        if ( match_len > dst_len - d ) return 1;
+
+        // matches can overlap what they write
+        const unsigned char * from = dst + d - offset;
+        for ( int i = 0; i < match_len; i++ ) {
+            dst[ d + i ] = from[ i ];
+        }
+        d += match_len;
+    }
+
+    return d == dst_len ? 0 : 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// lookup
+////////////////////////////////////////////////////////////////////////////////
+
+/// first index in a hash sorted list with the hash, count when none has it
+template < typename T >
+static int lower_bound( const T * list, int count, uint32_t hash )
+{
+    int lo = 0;
+    int hi = count;
+
+    while ( lo < hi ) {
+        int mid = ( lo + hi ) / 2;
+        if ( list[ mid ].hash < hash ) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+/// names are compared too, the hash only narrows it down
+template < typename T >
+static int find_index( const T * list, int count, res_name_t name )
+{
+    for ( int i = lower_bound( list, count, name.hash );
+          i < count && list[ i ].hash == name.hash;
+          i++ ) {
+        if ( strncmp( list[ i ].name, name.name, sizeof( list[ i ].name ) ) ==
+             0 ) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+static int validate()
+{
+    const pack_header_t * header = intern.header;
+
+    if ( intern.size < (int) sizeof( pack_header_t ) ) return 1;
+    if ( header->magic != PACK_MAGIC || header->version != PACK_VERSION ) {
+        return 1;
+    }
+
+    uint64_t index_size =
+        sizeof( pack_header_t ) +
+        (uint64_t) header->entry_count * sizeof( pack_entry_t ) +
+        (uint64_t) header->atlas_count * sizeof( pack_atlas_t );
+    if ( index_size > (uint64_t) intern.size ) return 1;
+
+    intern.entry_list = (const pack_entry_t *) ( header + 1 );
+    intern.atlas_list =
+        (const pack_atlas_t *) ( intern.entry_list + header->entry_count );
+
+    for ( uint32_t i = 0; i < header->entry_count; i++ ) {
+        const pack_entry_t & entry = intern.entry_list[ i ];
+        if ( (uint64_t) entry.offset + entry.size > (uint64_t) intern.size ) {
+            return 1;
+        }
+        if ( entry.raw_size > 0x7fffffff ) return 1;
+        if ( !( entry.flags & PACK_LZ4 ) && entry.size != entry.raw_size ) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+void pack_binary_path( const char * name, char * out, int out_size )
+{
+    int len = binary_path( out, out_size );
+
+    while ( len > 0 && out[ len - 1 ] != '/' && out[ len - 1 ] != '\\' ) {
+        len--;
+    }
+
+    snprintf( out + len, out_size - len, "%s", name );
+}
+
+int pack_open( const char * path )
+{
+    pack_close();
+
+    int size = 0;
+    const unsigned char * data = map_file( path, &size );
+
+    if ( !data ) {
+        INFO_LOG( "no resource pack at %s, using embedded resources", path );
+        return 1;
+    }
+
+    intern.data = data;
+    intern.size = size;
+    intern.header = (const pack_header_t *) data;
+
+    if ( validate() ) {
+        ERROR_LOG( "not a version %d resource pack: %s", PACK_VERSION, path );
+        unmap_file();
+        intern.data = nullptr;
+        return 1;
+    }
+
+    intern.cache_list = new unsigned char *[ intern.header->entry_count ]();
+
+    INFO_LOG(
+        "mapped resource pack %s, %d entries",
+        path,
+        (int) intern.header->entry_count
+    );
+
+    return 0;
+}
+
+void pack_close()
+{
+    if ( !intern.data ) return;
+
+    for ( uint32_t i = 0; i < intern.header->entry_count; i++ ) {
+        delete[] intern.cache_list[ i ];
+    }
+    delete[] intern.cache_list;
+    intern.cache_list = nullptr;
+
+    unmap_file();
+    intern.data = nullptr;
+}
+
+int pack_find( res_name_t name, res_t * out )
+{
+    if ( !intern.data ) return 0;
+
+    int i =
+        find_index( intern.entry_list, intern.header->entry_count, name );
+    if ( i < 0 ) return 0;
+
+    const pack_entry_t & entry = intern.entry_list[ i ];
+
+    if ( !( entry.flags & PACK_LZ4 ) ) {
+        out->data = intern.data + entry.offset;
+        out->size = entry.size;
+        return 1;
+    }
+
+    // loads can come from more than one thread
+    std::lock_guard< std::mutex > lock( intern.cache_mutex );
+
+    if ( !intern.cache_list[ i ] ) {
+        unsigned char * raw = new unsigned char[ entry.raw_size ];
+
+        if ( lz4_decompress(
+                 intern.data + entry.offset,
+                 entry.size,
+                 raw,
+                 entry.raw_size
+             ) ) {
+            ERROR_LOG( "failed to decompress resource: %s", name.name );
+            delete[] raw;
+            return 0;
+        }
+
+        intern.cache_list[ i ] = raw;
+    }
+
+    out->data = intern.cache_list[ i ];
+    out->size = entry.raw_size;
+    return 1;
+}
+
+int pack_find_atlas_region( res_name_t name, atlas_region_t * out )
+{
+    if ( !intern.data ) return 0;
+
+    int i =
+        find_index( intern.atlas_list, intern.header->atlas_count, name );
+    if ( i < 0 ) return 0;
+
+    const pack_atlas_t & atlas = intern.atlas_list[ i ];
+
+    out->x = atlas.x;
+    out->y = atlas.y;
+    out->w = atlas.w;
+    out->h = atlas.h;
+    out->trim_x = atlas.trim_x;
+    out->trim_y = atlas.trim_y;
+    out->atlas_w = intern.header->atlas_w;
+    out->atlas_h = intern.header->atlas_h;
+    return 1;
+}
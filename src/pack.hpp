@@ -0,0 +1,65 @@
+#pragma once
+
+#include "res.hpp"
+
+#include <stdint.h>
+
+#define PACK_MAGIC    0x4b415042 // "BPAK"
+#define PACK_VERSION  1
+#define PACK_NAME_LEN 44
+#define PACK_ALIGN    16
+
+enum pack_flag_t {
+    PACK_LZ4 = 1, // lz4 block, raw_size bytes once decompressed
+};
+
+// file layout, bake -p writes the same: the header, entry_count entries and
+// atlas_count atlas regions, both sorted by hash, then the data of every
+// entry on a PACK_ALIGN boundary
+
+struct pack_header_t {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t entry_count;
+    uint32_t atlas_count;
+    int32_t atlas_w;
+    int32_t atlas_h;
+    uint32_t reserved[ 2 ];
+};
+
+struct pack_entry_t {
+    uint32_t hash; // res_hash() of the name
+    uint32_t flags;
+    uint32_t offset; // from the start of the file
+    uint32_t size;   // in the file
+    uint32_t raw_size;
+    char name[ PACK_NAME_LEN ];
+};
+
+struct pack_atlas_t {
+    uint32_t hash;
+    int32_t x;
+    int32_t y;
+    int32_t w;
+    int32_t h;
+    int32_t trim_x;
+    int32_t trim_y;
+    char name[ PACK_NAME_LEN - 8 ];
+};
+
+/// name in the directory of the running binary, or just name, so relative to
+/// the working directory, where that directory can not be found out
+void pack_binary_path( const char * name, char * out, int out_size );
+
+/// maps the pack read only, fails when there is no pack or it does not look
+/// like one. resources come from the embedded data while no pack is open
+int pack_open( const char * path );
+
+void pack_close();
+
+/// 1 when the open pack has the resource. uncompressed entries point into
+/// the mapping, compressed ones are decompressed on first access and cached
+/// until the pack is closed
+int pack_find( res_name_t name, res_t * out );
+
+int pack_find_atlas_region( res_name_t name, atlas_region_t * out );
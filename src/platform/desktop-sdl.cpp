@@ -5,6 +5,7 @@
 #include <glad/glad.h>
 
 #include "logging.hpp"
+#include "present.hpp"
 
 static struct {
     SDL_Window * window = nullptr;
@@ -63,7 +64,7 @@ int hardware_init()
     const char * gl_version = (const char *) glGetString( GL_VERSION );
     INFO_LOG( "OpenGL version: %s", gl_version );
 
-    SDL_GL_SetSwapInterval( 1 );
+    hardware_set_present_mode( PRESENT_VSYNC, 0.0f );
     glViewport( 0, 0, intern.width, intern.height );
 
     return 0;
@@ -87,10 +88,46 @@ void hardware_set_loop( loop_function_t step )
             if ( event.type == SDL_QUIT ) quit_loop = 1;
         }
         step();
-        SDL_GL_SwapWindow( intern.window );
     }
 }
 
+void hardware_swap()
+{
+    // the swap interval belongs to the context, so it is set here
+    int interval = present_take_swap_interval();
+    if ( interval >= 0 ) SDL_GL_SetSwapInterval( interval );
+
+    present_wait();
+    SDL_GL_SwapWindow( intern.window );
+    present_done();
+}
+
+void hardware_set_present_mode( int mode, float rate )
+{
+    SDL_DisplayMode display;
+    float refresh_rate = 0.0f;
+    if ( SDL_GetCurrentDisplayMode( 0, &display ) == 0 ) {
+        refresh_rate = display.refresh_rate;
+    }
+
+    present_set_mode( mode, rate, refresh_rate );
+}
+
+present_stats_t hardware_present_stats()
+{
+    return present_stats();
+}
+
+void hardware_make_current( int current )
+{
+    SDL_GL_MakeCurrent( intern.window, current ? intern.context : nullptr );
+}
+
+void * hardware_gl_proc( const char * name )
+{
+    return SDL_GL_GetProcAddress( name );
+}
+
 int hardware_width()
 {
     return intern.width;
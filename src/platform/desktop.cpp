@@ -5,6 +5,7 @@
 #include <glad/glad.h>
 
 #include "logging.hpp"
+#include "present.hpp"
 
 static struct {
     GLFWwindow * window = nullptr;
@@ -49,6 +50,12 @@ handle_key( GLFWwindow * window, int key, int scancode, int action, int mods )
     if ( key == GLFW_KEY_L && action == GLFW_PRESS ) {
         push_event( EVENT_FAST_HAMMER_CCW );
     }
+    if ( key == GLFW_KEY_F3 && action == GLFW_PRESS ) {
+        push_event( EVENT_TOGGLE_PROFILER );
+    }
+    if ( key == GLFW_KEY_F4 && action == GLFW_PRESS ) {
+        push_event( EVENT_CYCLE_PRESENT_MODE );
+    }
 }
 
 int hardware_init()
@@ -90,7 +97,7 @@ int hardware_init()
     const char * gl_version = (const char *) glGetString( GL_VERSION );
     INFO_LOG( "opengl version: %s", gl_version );
 
-    glfwSwapInterval( 1 );
+    hardware_set_present_mode( PRESENT_VSYNC, 0.0f );
     glViewport( 0, 0, intern.width, intern.height );
 
     glfwSetMouseButtonCallback( intern.window, handle_mouse_button );
@@ -121,10 +128,41 @@ void hardware_set_loop( loop_function_t step )
         }
 
         step();
-        glfwSwapBuffers( intern.window );
     }
 }
 
+void hardware_swap()
+{
+    // the swap interval belongs to the context, so it is set here
+    int interval = present_take_swap_interval();
+    if ( interval >= 0 ) glfwSwapInterval( interval );
+
+    present_wait();
+    glfwSwapBuffers( intern.window );
+    present_done();
+}
+
+void hardware_set_present_mode( int mode, float rate )
+{
+    const GLFWvidmode * video = glfwGetVideoMode( glfwGetPrimaryMonitor() );
+    present_set_mode( mode, rate, video ? video->refreshRate : 0.0f );
+}
+
+present_stats_t hardware_present_stats()
+{
+    return present_stats();
+}
+
+void hardware_make_current( int current )
+{
+    glfwMakeContextCurrent( current ? intern.window : nullptr );
+}
+
+void * hardware_gl_proc( const char * name )
+{
+    return (void *) glfwGetProcAddress( name );
+}
+
 int hardware_width()
 {
     return intern.width;
@@ -0,0 +1,107 @@
+#include "hardware.hpp"
+
+#include <glad/glad.h>
+
+#include "logging.hpp"
+#include "null_gl.hpp"
+#include "present.hpp"
+
+// no window, no input and a gl that only counts. time advances by one 60 hz
+// frame per swap, so frame time driven logic sees a steady frame rate no
+// matter how fast the host is
+
+static struct {
+    int width = 800;
+    int height = 800;
+
+    int frame_count = 600; // frames run by hardware_set_loop
+    double time = 0.0;
+} intern;
+
+int hardware_init()
+{
+    if ( !gladLoadGLLoader( (GLADloadproc) null_gl_proc ) ) {
+        ERROR_LOG( "failed to load the null gl" );
+        return 1;
+    }
+
+    const char * gl_version = (const char *) glGetString( GL_VERSION );
+    INFO_LOG( "opengl version: %s", gl_version );
+
+    return 0;
+}
+
+void hardware_destroy()
+{
+}
+
+void hardware_set_loop( loop_function_t step )
+{
+    for ( int i = 0; i < intern.frame_count; i++ ) {
+        step();
+    }
+}
+
+void hardware_swap()
+{
+    present_take_swap_interval();
+
+    present_wait();
+    intern.time += 1.0 / 60.0;
+    present_done();
+}
+
+// there is no display, vsync presents at once like uncapped
+void hardware_set_present_mode( int mode, float rate )
+{
+    present_set_mode( mode, rate, 0.0f );
+}
+
+present_stats_t hardware_present_stats()
+{
+    return present_stats();
+}
+
+void hardware_make_current( int current )
+{
+}
+
+void * hardware_gl_proc( const char * name )
+{
+    return null_gl_proc( name );
+}
+
+int hardware_width()
+{
+    return intern.width;
+}
+
+int hardware_height()
+{
+    return intern.height;
+}
+
+float hardware_time()
+{
+    return intern.time;
+}
+
+void hardware_rumble()
+{
+}
+
+int * hardware_events( int * out_count )
+{
+    *out_count = 0;
+    return nullptr;
+}
+
+float hardware_x_axis()
+{
+    return 0.0f;
+}
+
+float hardware_y_axis()
+{
+    return 0.0f;
+}
@@ -0,0 +1,481 @@
+#include "null_gl.hpp"
+
+#include <glad/glad.h>
+
+#include <string.h>
+
+// a gl that draws nothing. it hands out object names, answers the queries
+// render_init() makes with success and counts the rest
+
+static struct {
+    null_gl_stats_t stats;
+
+    unsigned int next_name;
+    int next_location;
+
+    unsigned int program;
+    unsigned int texture;
+    unsigned int array_buffer;
+    unsigned int framebuffer;
+} intern;
+
+static void count_call()
+{
+    intern.stats.call_count++;
+}
+
+static void gen_names( GLsizei n, GLuint * out )
+{
+    count_call();
+    for ( int i = 0; i < n; i++ ) {
+        intern.next_name++;
+        out[ i ] = intern.next_name;
+    }
+}
+
+static unsigned int create_name()
+{
+    count_call();
+    intern.next_name++;
+    return intern.next_name;
+}
+
+static int pixel_size( GLenum format, GLenum type = GL_UNSIGNED_BYTE )
+{
+    // packed types hold the whole pixel
+    switch ( type ) {
+    case GL_UNSIGNED_SHORT_4_4_4_4:
+    case GL_UNSIGNED_SHORT_5_5_5_1:
+    case GL_UNSIGNED_SHORT_5_6_5:
+        return 2;
+    }
+
+    switch ( format ) {
+    case GL_RED:
+        return 1;
+    case GL_RG:
+        return 2;
+    case GL_RGB:
+        return 3;
+    default:
+        return 4;
+    }
+}
+
+// strings
+
+static const GLubyte * APIENTRY null_get_string( GLenum name )
+{
+    count_call();
+    switch ( name ) {
+    case GL_VERSION:
+        return (const GLubyte *) "3.0 null";
+    case GL_VENDOR:
+        return (const GLubyte *) "null";
+    case GL_RENDERER:
+        return (const GLubyte *) "recording";
+    case GL_SHADING_LANGUAGE_VERSION:
+        return (const GLubyte *) "1.30";
+    case GL_EXTENSIONS:
+        return (const GLubyte *) "GL_null_recording";
+    default:
+        return (const GLubyte *) "";
+    }
+}
+
+// glad refuses a 3.x context without at least one extension
+static const GLubyte * APIENTRY null_get_stringi( GLenum name, GLuint index )
+{
+    count_call();
+    return (const GLubyte *) "GL_null_recording";
+}
+
+static void APIENTRY null_get_integerv( GLenum pname, GLint * data )
+{
+    count_call();
+    switch ( pname ) {
+    case GL_NUM_EXTENSIONS:
+        *data = 1;
+        break;
+    case GL_MAX_TEXTURE_SIZE:
+        *data = 16384;
+        break;
+    default:
+        *data = 0;
+        break;
+    }
+}
+
+// state
+
+static void APIENTRY null_enable( GLenum cap )
+{
+    count_call();
+}
+
+static void APIENTRY null_disable( GLenum cap )
+{
+    count_call();
+}
+
+static void APIENTRY null_blend_func( GLenum src, GLenum dst )
+{
+    count_call();
+}
+
+static void APIENTRY null_viewport( GLint x, GLint y, GLsizei w, GLsizei h )
+{
+    count_call();
+}
+
+static void APIENTRY null_scissor( GLint x, GLint y, GLsizei w, GLsizei h )
+{
+    count_call();
+}
+
+static void APIENTRY
+null_clear_color( GLfloat r, GLfloat g, GLfloat b, GLfloat a )
+{
+    count_call();
+}
+
+static void APIENTRY null_clear( GLbitfield mask )
+{
+    count_call();
+}
+
+static void APIENTRY null_pixel_storei( GLenum pname, GLint param )
+{
+    count_call();
+}
+
+// buffers
+
+static void APIENTRY null_gen_buffers( GLsizei n, GLuint * buffers )
+{
+    gen_names( n, buffers );
+}
+
+static void APIENTRY null_bind_buffer( GLenum target, GLuint buffer )
+{
+    count_call();
+    if ( target == GL_ARRAY_BUFFER && buffer != intern.array_buffer ) {
+        intern.array_buffer = buffer;
+        intern.stats.buffer_change_count++;
+    }
+}
+
+static void APIENTRY null_buffer_data(
+    GLenum target,
+    GLsizeiptr size,
+    const void * data,
+    GLenum usage
+)
+{
+    count_call();
+    if ( data ) intern.stats.upload_bytes += size;
+}
+
+static void APIENTRY null_enable_vertex_attrib_array( GLuint index )
+{
+    count_call();
+}
+
+static void APIENTRY null_vertex_attrib_pointer(
+    GLuint index,
+    GLint size,
+    GLenum type,
+    GLboolean normalized,
+    GLsizei stride,
+    const void * pointer
+)
+{
+    count_call();
+}
+
+static void APIENTRY null_draw_arrays( GLenum mode, GLint first, GLsizei count )
+{
+    count_call();
+    intern.stats.draw_count++;
+    intern.stats.vertex_count += count;
+}
+
+// textures and framebuffers
+
+static void APIENTRY null_gen_textures( GLsizei n, GLuint * textures )
+{
+    gen_names( n, textures );
+}
+
+static void APIENTRY null_bind_texture( GLenum target, GLuint texture )
+{
+    count_call();
+    if ( texture != intern.texture ) {
+        intern.texture = texture;
+        intern.stats.texture_change_count++;
+    }
+}
+
+static void APIENTRY null_tex_parameteri( GLenum target, GLenum pname, GLint p )
+{
+    count_call();
+}
+
+static void APIENTRY null_tex_image_2d(
+    GLenum target,
+    GLint level,
+    GLint internal_format,
+    GLsizei width,
+    GLsizei height,
+    GLint border,
+    GLenum format,
+    GLenum type,
+    const void * pixels
+)
+{
+    count_call();
+    if ( pixels ) {
+        intern.stats.upload_bytes +=
+            (long long) width * height * pixel_size( format, type );
+    }
+}
+
+static void APIENTRY null_generate_mipmap( GLenum target )
+{
+    count_call();
+}
+
+static void APIENTRY null_gen_framebuffers( GLsizei n, GLuint * framebuffers )
+{
+    gen_names( n, framebuffers );
+}
+
+static void APIENTRY null_bind_framebuffer( GLenum target, GLuint framebuffer )
+{
+    count_call();
+    if ( framebuffer != intern.framebuffer ) {
+        intern.framebuffer = framebuffer;
+        intern.stats.framebuffer_change_count++;
+    }
+}
+
+static void APIENTRY null_framebuffer_texture_2d(
+    GLenum target,
+    GLenum attachment,
+    GLenum textarget,
+    GLuint texture,
+    GLint level
+)
+{
+    count_call();
+}
+
+// shaders
+
+static GLuint APIENTRY null_create_shader( GLenum type )
+{
+    return create_name();
+}
+
+static void APIENTRY null_shader_source(
+    GLuint shader,
+    GLsizei count,
+    const GLchar * const * string,
+    const GLint * length
+)
+{
+    count_call();
+}
+
+static void APIENTRY null_compile_shader( GLuint shader )
+{
+    count_call();
+}
+
+static void APIENTRY null_get_shaderiv( GLuint shader, GLenum pname, GLint * p )
+{
+    count_call();
+    *p = pname == GL_COMPILE_STATUS ? 1 : 0;
+}
+
+static void APIENTRY null_get_shader_info_log(
+    GLuint shader,
+    GLsizei size,
+    GLsizei * length,
+    GLchar * log
+)
+{
+    count_call();
+    if ( length ) *length = 0;
+    if ( size > 0 ) log[ 0 ] = '\0';
+}
+
+static void APIENTRY null_delete_shader( GLuint shader )
+{
+    count_call();
+}
+
+static GLuint APIENTRY null_create_program()
+{
+    return create_name();
+}
+
+static void APIENTRY null_attach_shader( GLuint program, GLuint shader )
+{
+    count_call();
+}
+
+static void APIENTRY null_link_program( GLuint program )
+{
+    count_call();
+}
+
+static void APIENTRY
+null_get_programiv( GLuint program, GLenum pname, GLint * p )
+{
+    count_call();
+    *p = pname == GL_LINK_STATUS ? 1 : 0;
+}
+
+static void APIENTRY null_get_program_info_log(
+    GLuint program,
+    GLsizei size,
+    GLsizei * length,
+    GLchar * log
+)
+{
+    count_call();
+    if ( length ) *length = 0;
+    if ( size > 0 ) log[ 0 ] = '\0';
+}
+
+static void APIENTRY null_delete_program( GLuint program )
+{
+    count_call();
+}
+
+static void APIENTRY null_use_program( GLuint program )
+{
+    count_call();
+    if ( program != intern.program ) {
+        intern.program = program;
+        intern.stats.program_change_count++;
+    }
+}
+
+// every name gets its own location, they only have to be valid
+static GLint APIENTRY
+null_get_uniform_location( GLuint program, const GLchar * name )
+{
+    count_call();
+    return intern.next_location++;
+}
+
+static GLint APIENTRY
+null_get_attrib_location( GLuint program, const GLchar * name )
+{
+    count_call();
+    return intern.next_location++ % 16;
+}
+
+static void APIENTRY null_uniform1i( GLint location, GLint v )
+{
+    count_call();
+    intern.stats.uniform_count++;
+}
+
+static void APIENTRY null_uniform1f( GLint location, GLfloat v )
+{
+    count_call();
+    intern.stats.uniform_count++;
+}
+
+static void APIENTRY
+null_uniformfv( GLint location, GLsizei count, const GLfloat * v )
+{
+    count_call();
+    intern.stats.uniform_count++;
+}
+
+static void APIENTRY null_uniform_matrix4fv(
+    GLint location,
+    GLsizei count,
+    GLboolean transpose,
+    const GLfloat * v
+)
+{
+    count_call();
+    intern.stats.uniform_count++;
+}
+
+struct null_proc_t {
+    const char * name;
+    void * proc;
+};
+
+static const null_proc_t k_proc_list[] = {
+    { "glGetString", (void *) null_get_string },
+    { "glGetStringi", (void *) null_get_stringi },
+    { "glGetIntegerv", (void *) null_get_integerv },
+    { "glEnable", (void *) null_enable },
+    { "glDisable", (void *) null_disable },
+    { "glBlendFunc", (void *) null_blend_func },
+    { "glViewport", (void *) null_viewport },
+    { "glScissor", (void *) null_scissor },
+    { "glClearColor", (void *) null_clear_color },
+    { "glClear", (void *) null_clear },
+    { "glPixelStorei", (void *) null_pixel_storei },
+    { "glGenBuffers", (void *) null_gen_buffers },
+    { "glBindBuffer", (void *) null_bind_buffer },
+    { "glBufferData", (void *) null_buffer_data },
+    { "glEnableVertexAttribArray", (void *) null_enable_vertex_attrib_array },
+    { "glVertexAttribPointer", (void *) null_vertex_attrib_pointer },
+    { "glDrawArrays", (void *) null_draw_arrays },
+    { "glGenTextures", (void *) null_gen_textures },
+    { "glBindTexture", (void *) null_bind_texture },
+    { "glTexParameteri", (void *) null_tex_parameteri },
+    { "glTexImage2D", (void *) null_tex_image_2d },
+    { "glGenerateMipmap", (void *) null_generate_mipmap },
+    { "glGenFramebuffers", (void *) null_gen_framebuffers },
+    { "glBindFramebuffer", (void *) null_bind_framebuffer },
+    { "glFramebufferTexture2D", (void *) null_framebuffer_texture_2d },
+    { "glCreateShader", (void *) null_create_shader },
+    { "glShaderSource", (void *) null_shader_source },
+    { "glCompileShader", (void *) null_compile_shader },
+    { "glGetShaderiv", (void *) null_get_shaderiv },
+    { "glGetShaderInfoLog", (void *) null_get_shader_info_log },
+    { "glDeleteShader", (void *) null_delete_shader },
+    { "glCreateProgram", (void *) null_create_program },
+    { "glAttachShader", (void *) null_attach_shader },
+    { "glLinkProgram", (void *) null_link_program },
+    { "glGetProgramiv", (void *) null_get_programiv },
+    { "glGetProgramInfoLog", (void *) null_get_program_info_log },
+    { "glDeleteProgram", (void *) null_delete_program },
+    { "glUseProgram", (void *) null_use_program },
+    { "glGetUniformLocation", (void *) null_get_uniform_location },
+    { "glGetAttribLocation", (void *) null_get_attrib_location },
+    { "glUniform1i", (void *) null_uniform1i },
+    { "glUniform1f", (void *) null_uniform1f },
+    { "glUniform3fv", (void *) null_uniformfv },
+    { "glUniform4fv", (void *) null_uniformfv },
+    { "glUniformMatrix4fv", (void *) null_uniform_matrix4fv },
+};
+
+void * null_gl_proc( const char * name )
+{
+    for ( const null_proc_t & p : k_proc_list ) {
+        if ( strcmp( p.name, name ) == 0 ) return p.proc;
+    }
+
+    return nullptr;
+}
+
+const null_gl_stats_t & null_gl_stats()
+{
+    return intern.stats;
+}
+
+void null_gl_reset_stats()
+{
+    memset( &intern.stats, 0, sizeof( intern.stats ) );
+}
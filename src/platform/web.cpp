@@ -7,6 +7,7 @@
 #include <emscripten/html5.h>
 
 #include "logging.hpp"
+#include "present.hpp"
 
 using loop_function_t = void ( * )();
 
@@ -19,6 +20,9 @@ static struct {
     int pending_event_count = 0;
 
     loop_function_t step;
+
+    int present_mode;
+    float present_rate;
 } intern;
 
 static void push_event( int e )
@@ -92,6 +96,8 @@ int hardware_init()
     glfwSetWindowSize( intern.window, intern.width, intern.height );
     glViewport( 0, 0, intern.width, intern.height );
 
+    hardware_set_present_mode( PRESENT_VSYNC, 0.0f );
+
     return 0;
 }
 
@@ -102,7 +108,26 @@ void hardware_destroy()
 }
 
 
+// the browser runs the loop, so present modes map to its loop timing
+// instead of a swap interval and the cpu limiter
+static void apply_present_mode()
+{
+    if ( present_take_swap_interval() < 0 ) return;
+
+    if ( intern.present_mode == PRESENT_UNCAPPED ) {
+        emscripten_set_main_loop_timing( EM_TIMING_SETIMMEDIATE, 0 );
+    } else if ( intern.present_mode == PRESENT_LIMITED &&
+                intern.present_rate > 0.0f ) {
+        int ms = (int) ( 1000.0f / intern.present_rate );
+        emscripten_set_main_loop_timing( EM_TIMING_SETTIMEOUT, ms );
+    } else {
+        emscripten_set_main_loop_timing( EM_TIMING_RAF, 1 );
+    }
+}
+
 static void loop() {
+        apply_present_mode();
+
         intern.pending_event_count = 0;
         glfwPollEvents();
 
@@ -116,6 +141,8 @@ static void loop() {
         static int last1 = 0;
         static int last2 = 0;
         static int last3 = 0;
+        static int last4 = 0;
+        static int last5 = 0;
 
         if ( glfwGetKey( intern.window, GLFW_KEY_SPACE ) == GLFW_PRESS ) {
             if (!last1) {
@@ -138,6 +165,20 @@ static void loop() {
             last3 = 1;
         } else last3 = 0;
 
+        if ( glfwGetKey( intern.window, GLFW_KEY_F3 ) == GLFW_PRESS ) {
+            if (!last4) {
+            push_event( EVENT_TOGGLE_PROFILER );
+            }
+            last4 = 1;
+        } else last4 = 0;
+
+        if ( glfwGetKey( intern.window, GLFW_KEY_F4 ) == GLFW_PRESS ) {
+            if (!last5) {
+            push_event( EVENT_CYCLE_PRESENT_MODE );
+            }
+            last5 = 1;
+        } else last5 = 0;
+
         intern.step();
 }
 
@@ -147,6 +188,35 @@ void hardware_set_loop( loop_function_t step )
     emscripten_set_main_loop( loop, 0, 1 );
 }
 
+// the browser presents when the loop callback returns
+void hardware_swap()
+{
+    present_done();
+}
+
+void hardware_set_present_mode( int mode, float rate )
+{
+    intern.present_mode = mode;
+    intern.present_rate = rate;
+    present_set_mode( mode, rate, 0.0f );
+}
+
+present_stats_t hardware_present_stats()
+{
+    return present_stats();
+}
+
+// there is only one thread
+void hardware_make_current( int current )
+{
+}
+
+// webgl exposes no program binaries
+void * hardware_gl_proc( const char * name )
+{
+    return nullptr;
+}
+
 int hardware_width()
 {
     return intern.width;
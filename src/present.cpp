@@ -0,0 +1,152 @@
+#include "present.hpp"
+
+#include "profiler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+static const int k_present_history = 256;
+
+// a skipped refresh shows up as a frame of two deadlines
+static const float k_missed_factor = 1.5f;
+
+// sleeps overshoot by up to a scheduler tick, the limiter sleeps until this
+// close to the deadline and spins the rest
+static const double k_spin_time = 0.002;
+
+static struct {
+    std::mutex mutex;
+
+    int mode;
+    float rate;
+    float refresh_rate;
+    int pending_interval = -1;
+
+    // presenting thread only
+    double deadline; // of the last limited present
+    double last_present;
+
+    // ring of recent frames
+    float frame_time_list[ k_present_history ];
+    float deadline_list[ k_present_history ]; // 0 when there is none
+    int frame_count;                           // since the mode changed
+    double wait_time;                          // likewise
+} intern;
+
+void present_set_mode( int mode, float rate, float refresh_rate )
+{
+    std::lock_guard< std::mutex > lock( intern.mutex );
+
+    intern.mode = mode;
+    intern.rate = rate;
+    intern.refresh_rate = refresh_rate;
+    intern.pending_interval = mode == PRESENT_VSYNC ? 1 : 0;
+    intern.frame_count = 0;
+    intern.wait_time = 0.0;
+}
+
+int present_take_swap_interval()
+{
+    std::lock_guard< std::mutex > lock( intern.mutex );
+
+    int interval = intern.pending_interval;
+    intern.pending_interval = -1;
+    return interval;
+}
+
+void present_wait()
+{
+    double interval;
+    {
+        std::lock_guard< std::mutex > lock( intern.mutex );
+        if ( intern.mode != PRESENT_LIMITED || intern.rate <= 0.0f ) return;
+        interval = 1.0 / intern.rate;
+    }
+
+    double now = profiler_clock();
+    double target = intern.deadline + interval;
+
+    // more than a frame behind, start over from now rather than rushing
+    // frames out to catch up
+    if ( target < now - interval ) target = now;
+
+    double remaining = target - now;
+    if ( remaining > k_spin_time ) {
+        std::this_thread::sleep_for(
+            std::chrono::duration< double >( remaining - k_spin_time )
+        );
+    }
+
+    while ( profiler_clock() < target ) {
+    }
+
+    intern.deadline = target;
+
+    std::lock_guard< std::mutex > lock( intern.mutex );
+    intern.wait_time += profiler_clock() - now;
+}
+
+static float current_deadline()
+{
+    if ( intern.mode == PRESENT_LIMITED && intern.rate > 0.0f ) {
+        return 1.0f / intern.rate;
+    }
+
+    if ( intern.mode == PRESENT_VSYNC && intern.refresh_rate > 0.0f ) {
+        return 1.0f / intern.refresh_rate;
+    }
+
+    return 0.0f;
+}
+
+void present_done()
+{
+    double now = profiler_clock();
+    std::lock_guard< std::mutex > lock( intern.mutex );
+
+    if ( intern.last_present > 0.0 ) {
+        int i = intern.frame_count % k_present_history;
+        intern.frame_time_list[ i ] = now - intern.last_present;
+        intern.deadline_list[ i ] = current_deadline();
+        intern.frame_count++;
+    }
+
+    intern.last_present = now;
+}
+
+present_stats_t present_stats()
+{
+    std::lock_guard< std::mutex > lock( intern.mutex );
+
+    present_stats_t stats = {};
+    stats.mode = intern.mode;
+    stats.wait_time = intern.wait_time;
+    stats.deadline = current_deadline();
+
+    int count = std::min( intern.frame_count, k_present_history );
+    if ( count == 0 ) return stats;
+
+    float sorted[ k_present_history ];
+    float total = 0.0f;
+
+    for ( int i = 0; i < count; i++ ) {
+        float t = intern.frame_time_list[ i ];
+        float deadline = intern.deadline_list[ i ];
+
+        sorted[ i ] = t;
+        total += t;
+        if ( deadline > 0.0f && t > deadline * k_missed_factor ) {
+            stats.missed_count++;
+        }
+    }
+
+    std::sort( sorted, sorted + count );
+
+    stats.frame_count = count;
+    stats.min_frame_time = sorted[ 0 ];
+    stats.avg_frame_time = total / count;
+    stats.p99_frame_time = sorted[ ( count - 1 ) * 99 / 100 ];
+    return stats;
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "hardware.hpp"
+
+// frame pacing and present statistics shared by the platform layers. wait
+// and done bracket the swap on whichever thread presents, the rest may be
+// called from any thread
+
+/// refresh_rate is the display's, 0 when unknown, and sets the deadline of
+/// PRESENT_VSYNC
+void present_set_mode( int mode, float rate, float refresh_rate );
+
+/// swap interval to apply before the next swap, -1 when unchanged
+int present_take_swap_interval();
+
+/// PRESENT_LIMITED: sleeps, then spins until the next deadline
+void present_wait();
+
+/// records the time since the previous present
+void present_done();
+
+present_stats_t present_stats();
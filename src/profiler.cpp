@@ -0,0 +1,116 @@
+#include "profiler.hpp"
+
+#include <chrono>
+#include <string.h>
+
+static struct {
+    float time_list[ k_profile_frame_count ][ PROFILE_STAGE_COUNT ];
+    double start_list[ PROFILE_STAGE_COUNT ];
+
+    int frame;       // row being recorded
+    int frame_count; // complete rows, up to k_profile_frame_count - 1
+    double frame_start;
+
+    int visible;
+} intern;
+
+double profiler_clock()
+{
+    auto time = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration< double >( time ).count();
+}
+
+void profiler_begin_frame()
+{
+    double time = profiler_clock();
+
+    if ( intern.frame_start != 0.0 ) {
+        profiler_record( PROFILE_FRAME, time - intern.frame_start );
+
+        intern.frame = ( intern.frame + 1 ) % k_profile_frame_count;
+        if ( intern.frame_count < k_profile_frame_count - 1 ) {
+            intern.frame_count++;
+        }
+    }
+
+    intern.frame_start = time;
+    float * row = intern.time_list[ intern.frame ];
+    memset( row, 0, sizeof( float ) * PROFILE_STAGE_COUNT );
+}
+
+void profiler_begin( profile_stage_t stage )
+{
+    intern.start_list[ stage ] = profiler_clock();
+}
+
+void profiler_end( profile_stage_t stage )
+{
+    profiler_record( stage, profiler_clock() - intern.start_list[ stage ] );
+}
+
+void profiler_record( profile_stage_t stage, float seconds )
+{
+    intern.time_list[ intern.frame ][ stage ] += seconds;
+}
+
+float profiler_time( profile_stage_t stage, int frames_ago )
+{
+    if ( frames_ago < 0 || frames_ago >= intern.frame_count ) return 0.0f;
+
+    int row = intern.frame - 1 - frames_ago;
+    if ( row < 0 ) row += k_profile_frame_count;
+
+    return intern.time_list[ row ][ stage ];
+}
+
+float profiler_average( profile_stage_t stage )
+{
+    if ( intern.frame_count == 0 ) return 0.0f;
+
+    float sum = 0.0f;
+    for ( int i = 0; i < intern.frame_count; i++ ) {
+        sum += profiler_time( stage, i );
+    }
+
+    return sum / intern.frame_count;
+}
+
+const char * profiler_stage_name( profile_stage_t stage )
+{
+    switch ( stage ) {
+    case PROFILE_EVENTS:
+        return "events";
+    case PROFILE_BULLETS:
+        return "bullets";
+    case PROFILE_LINE_BULLETS:
+        return "lines";
+    case PROFILE_PLAYER:
+        return "player";
+    case PROFILE_COLLISION:
+        return "collide";
+    case PROFILE_RENDER_WORLD:
+        return "world";
+    case PROFILE_RENDER_UI:
+        return "ui";
+    case PROFILE_SUBMIT:
+        return "submit";
+    case PROFILE_SWAP:
+        return "swap";
+    case PROFILE_GPU:
+        return "gpu";
+    case PROFILE_FRAME:
+        return "frame";
+    default:
+        return "?";
+    }
+}
+
+void profiler_toggle()
+{
+    intern.visible = !intern.visible;
+}
+
+int profiler_visible()
+{
+    return intern.visible;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+enum profile_stage_t {
+    PROFILE_EVENTS,
+    PROFILE_BULLETS,
+    PROFILE_LINE_BULLETS,
+    PROFILE_PLAYER,
+    PROFILE_COLLISION,
+    PROFILE_RENDER_WORLD,
+    PROFILE_RENDER_UI,
+    PROFILE_SUBMIT, // sorting the command buffer and issuing gl calls
+    PROFILE_SWAP,
+    PROFILE_GPU,   // whole render pass, from timer queries when available
+    PROFILE_FRAME, // wall time between frame starts
+    PROFILE_STAGE_COUNT,
+};
+
+static const int k_profile_frame_count = 128;
+
+/// starts a new row in the ring of recent frames
+void profiler_begin_frame();
+
+/// cpu timing, may be nested or repeated within a frame (times add up)
+void profiler_begin( profile_stage_t stage );
+void profiler_end( profile_stage_t stage );
+
+/// seconds on a monotonic clock, safe to call from any thread
+double profiler_clock();
+
+/// adds an externally measured time to the current frame
+void profiler_record( profile_stage_t stage, float seconds );
+
+/// seconds spent in stage, 0 is the last complete frame
+float profiler_time( profile_stage_t stage, int frames_ago );
+
+/// mean seconds over the complete frames in the ring
+float profiler_average( profile_stage_t stage );
+
+const char * profiler_stage_name( profile_stage_t stage );
+
+void profiler_toggle();
+int profiler_visible();
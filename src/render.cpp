@@ -3,15 +3,15 @@
 #include "color.hpp"
 #include "font.hpp"
 #include "hardware.hpp"
+#include "logging.hpp"
+#include "profiler.hpp"
+#include "render_cmd.hpp"
 #include "render_utils.hpp"
 #include "res.hpp"
 #include "shape.hpp"
 #include "state.hpp"
 #include "utils.hpp"
 
-#include <cglm/affine.h>
-#include <cglm/cam.h>
-#include <cglm/mat4.h>
 #include <cglm/vec2.h>
 
 #ifdef __EMSCRIPTEN__
@@ -22,45 +22,205 @@
 
 #include <math.h>
 #include <stdio.h>
+#include <string.h>
 
-struct textured_sprite_t {
+// pipelined rendering: commands are built on the main thread while the
+// previous frame is submitted and presented on a render thread that owns the
+// gl context
+#ifndef RENDER_THREAD
+#ifdef __EMSCRIPTEN__
+#define RENDER_THREAD 0
+#else
+#define RENDER_THREAD 1
+#endif
+#endif
+
+#if RENDER_THREAD
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+// cached background: the level is drawn once into tiles of one offscreen
+// texture, frames only composite the visible tiles
+#ifndef BACKGROUND_CACHE
+#define BACKGROUND_CACHE 1
+#endif
+
+#if BACKGROUND_CACHE
+static const int k_background_tile_size = 512; // layer units, and texels
+static const int k_background_size = 2048;     // cache texture
+static const int k_background_row = k_background_size / k_background_tile_size;
+static const int k_background_slot_count = k_background_row * k_background_row;
+
+/// a level tile held in the cache texture
+struct background_slot_t {
+    int x; // in tiles
+    int y;
+    int version; // level version it was drawn from, -1 when empty
+    int used;    // frame it was last composited in
+};
+#endif
+
+/// draw order within a layer, lower is further back
+enum depth_t {
+    // world
+    DEPTH_LEVEL = 0,
+    DEPTH_BULLETS,
+    DEPTH_MOBS,
+    DEPTH_PLAYER,
+
+    // ui
+    DEPTH_PANEL = 0,
+    DEPTH_GRAPH,
+    DEPTH_TEXT,
+};
+
+/// timings of one submitted frame, measured where the gl calls happen and
+/// recorded into the profiler by the main thread
+struct submit_result_t {
+    float submit_time;
+    float swap_time;
+    float gpu_time; // negative when no timer query was ready
+    int draw_count;
+    double present_time; // profiler_clock() once the swap returned
+};
+
+struct solid_sprite_t {
     rect_t rect;
-    rect_t uv_rect;
     color_t color;
     float alpha = 1.0f;
 
-    int texture;
-    void render();
+    void render( int depth );
 };
 
-struct solid_sprite_t {
-    rect_t rect;
+struct sprite_t {
+    vec2 pos;
+    float scale;
+    float rotation = 0.0f;
+
+    float ring = 0.0f; // render_polygon() outline width, 0 fills
+
     color_t color;
     float alpha = 1.0f;
 
-    void render();
+    void render( int mesh, int depth );
+
+    /// regular polygon with scale as its radius, 0 sides draws a circle
+    void render_polygon( int sides, int depth );
+};
+
+enum alignment_t {
+    ALIGN_LEFT,
+    ALIGN_RIGHT,
+    ALIGN_CENTER,
+};
+
+struct text_settings_t {
+    color_t color = color_white;
+    float alpha = 1.0f;
+    alignment_t align_x = ALIGN_LEFT;
+    alignment_t align_y = ALIGN_LEFT;
+    bool render_bg = false;
+    float scale = 1.0f;
+};
+
+static const int k_label_len = 128;
+
+/// retained text, laid out when its text changes and reused every frame
+/// after. scale and alignment only move the laid out glyphs, so changing them
+/// or the color costs nothing extra
+struct label_t {
+    char text[ k_label_len ];
+    text_settings_t settings;
+
+    glyph_t glyph_list[ k_label_len ];
+    int glyph_count;
+    float width; // unscaled
+    float height;
+    int valid;
+
+    void set( const char * new_text, const text_settings_t & new_settings );
+
+    void render( int x, int y );
 };
 
 // render state
 struct {
-    vbuffer_t quad_pos_buffer;
-    vbuffer_t quad_uv_buffer;
+    // command building
+
+    // one is built while the other is submitted
+    render_cmd_buffer_t cmd_buffer_list[ 2 ];
+    render_cmd_buffer_t * cmds; // buffer being built
+    int layer;
+
+    // frames built for other backends, never touched by the render thread
+    render_cmd_buffer_t record_buffer;
+
+    font_t font;
+    int atlas_texture; // every image, packed by bake
+
+    // retained text of the hud and the scene screens
+    struct {
+        label_t bullets;
+        label_t stats;
+        label_t controls;
+        label_t title;
+        label_t subtitle;
+        int bullet_count; // what the bullets label shows, -1 before the first
+    } ui;
+
+    float shake_timer;
+
+    rect_t view_rect; // world space, padded by the shake amplitude
+
+    // dynamic resolution of the world layer
+    float world_scale;
+    float last_frame_time;
+    float gpu_time; // newest timer query result, negative before the first
+    float load_avg; // seconds, of whichever of the two drives the scale
+    int fast_frame_count;
+
+    render_stats_t stats;
+
+    // gl submission
+
+    affine_t proj; // camera, layer space to clip space
+
+    // merged solid and text draws
+    vbuffer_t batch_pos_buffer;
+    vbuffer_t batch_uv_buffer;
+    vbuffer_t batch_color_buffer;
+    float * batch_pos_data;
+    float * batch_uv_data;
+    float * batch_color_data;
+    float * batch_shape_data; // polygon sides, ring and pixel size
+    int batch_cap;
+    vbuffer_t batch_shape_buffer;
+
+    int target_width; // pixels of the target being drawn to
+    int target_height;
+    rect_t view;      // camera of the layer being submitted
 
     vbuffer_t fb_pos_buffer;
     vbuffer_t fb_uv_buffer;
 
-    vbuffer_t player_buffer;
-    vbuffer_t hammer_buffer;
-    vbuffer_t mob_buffer;
+    // static level geometry, rebuilt when the level version changes
+    vbuffer_t level_pos_buffer;
+    vbuffer_t level_color_buffer;
+    int level_vertex_count;
+    int level_version;
 
-    // bullets
-    vbuffer_t bitch_buffer;
-    vbuffer_t line_bullet_buffer;
+    // line bullets
+    vbuffer_t line_bullet_corner_buffer; // static template, repeated
+    vbuffer_t line_bullet_end_buffer;    // pos1 and pos2 per vertex
+    float * line_bullet_end_data;
+    int line_bullet_cap;
 
     struct {
         int id;
         int proj;
-        int model;
+        int pos;
         int color;
     } shader1;
 
@@ -68,26 +228,92 @@ struct {
         int id;
         int texture;
         int amount;
+        int pos;
+        int uv;
     } shader2;
 
     struct {
         int id;
         int proj;
-        int model;
-        int color;
         int texture;
+        int pos;
+        int uv;
+        int color;
     } shader3;
 
-    font_t font;
-    int font_texture;
+    struct {
+        int id;
+        int proj;
+        int color;
+        int width;
+        int corner;
+        int ends;
+    } shader4;
 
-    mat4 model;
-    mat4 proj;
+    struct {
+        int id;
+        int proj;
+        int pos;
+        int local;
+        int shape;
+        int color;
+    } shader5;
+
+#if BACKGROUND_CACHE
+    framebuffer_t background_fb;
+    int background_state; // 0 not created yet, 1 ready, -1 unsupported
+    background_slot_t background_slot_list[ k_background_slot_count ];
+    int background_frame;
+    int background_bound; // background_fb bound for drawing misses
+#endif
 
-    float shake_timer;
+    // offscreen world target, rendered at a fraction of the window size
+    framebuffer_t world_fb;
+
+    gpu_timer_t gpu_timer;
+    int draw_count;
+
+#if RENDER_THREAD
+    struct {
+        std::thread thread;
+        std::mutex mutex;
+        std::condition_variable cond;
+
+        // cmd_buffer_list indices, -1 when none
+        int pending;   // built, waiting for the render thread
+        int rendering; // being submitted and presented
+
+        submit_result_t result;
+        int has_result;
+        int quit;
+    } thread;
+#endif
 
 } intern;
 
+static const float k_shake_amount = 5.0f;
+static const float k_shake_time = 0.2f;
+
+// dynamic resolution
+static const float k_frame_budget = 1.0f / 60.0f; // when nothing paces us
+static const float k_min_world_scale = 0.5f;
+static const float k_world_scale_step = 0.05f;
+
+// fractions of the budget the load has to go over to drop the scale, and stay
+// under to raise it. frame deltas never go below the budget when vsync or the
+// limiter paces them, so only being late tells anything. gpu time is the
+// render cost itself and has to leave room
+static const float k_frame_high_load = 1.2f;
+static const float k_frame_low_load = 1.05f;
+static const float k_gpu_high_load = 0.9f;
+static const float k_gpu_low_load = 0.6f;
+
+// u_proj for batches, their vertices arrive in clip space
+static const float k_clip_proj[ 4 ] = { 1.0f, 1.0f, 0.0f, 0.0f };
+
+static const int k_cmd_arena_size = 4 * 1024 * 1024;
+static const int k_cmd_cap = 16384;
+
 static void init_shader1()
 {
     int id = build_shader(
@@ -96,10 +322,8 @@ static void init_shader1()
     );
     intern.shader1.id = id;
     intern.shader1.proj = find_uniform( id, "u_proj" );
-    intern.shader1.model = find_uniform( id, "u_model" );
-    intern.shader1.color = find_uniform( id, "u_color" );
-
-    glBindAttribLocation( id, 0, "a_pos" );
+    intern.shader1.pos = find_attrib( id, "a_pos" );
+    intern.shader1.color = find_attrib( id, "a_color" );
 }
 
 static void init_shader2()
@@ -111,9 +335,8 @@ static void init_shader2()
     intern.shader2.id = id;
     intern.shader2.texture = find_uniform( id, "u_texture" );
     intern.shader2.amount = find_uniform( id, "u_amount" );
-
-    glBindAttribLocation( id, 0, "a_pos" );
-    glBindAttribLocation( id, 1, "a_uv" );
+    intern.shader2.pos = find_attrib( id, "a_pos" );
+    intern.shader2.uv = find_attrib( id, "a_uv" );
 }
 
 static void init_shader3()
@@ -124,118 +347,107 @@ static void init_shader3()
     );
     intern.shader3.id = id;
     intern.shader3.proj = find_uniform( id, "u_proj" );
-    intern.shader3.model = find_uniform( id, "u_model" );
-    intern.shader3.color = find_uniform( id, "u_color" );
     intern.shader3.texture = find_uniform( id, "u_texture" );
-
-    glBindAttribLocation( id, 0, "a_pos" );
-    glBindAttribLocation( id, 1, "a_uv" );
+    intern.shader3.pos = find_attrib( id, "a_pos" );
+    intern.shader3.uv = find_attrib( id, "a_uv" );
+    intern.shader3.color = find_attrib( id, "a_color" );
 }
 
-void compute_model_matrix( mat4 out, rect_t rect )
+static void init_shader4()
 {
-    vec3 scale;
-    scale[ 0 ] = roundf( rect.w );
-    scale[ 1 ] = roundf( rect.h );
-    scale[ 2 ] = 1.0f;
-
-    glm_mat4_identity( out );
-    glm_translate_x( out, roundf( rect.x ) );
-    glm_translate_y( out, roundf( rect.y ) );
-    glm_scale( out, scale );
-    glm_mat4_mul( intern.model, out, out );
+    int id = build_shader(
+        find_shader_string( "shader4_vertex" ),
+        find_shader_string( "shader4_fragment" )
+    );
+    intern.shader4.id = id;
+    intern.shader4.proj = find_uniform( id, "u_proj" );
+    intern.shader4.color = find_uniform( id, "u_color" );
+    intern.shader4.width = find_uniform( id, "u_width" );
+    intern.shader4.corner = find_attrib( id, "a_corner" );
+    intern.shader4.ends = find_attrib( id, "a_ends" );
 }
 
-void textured_sprite_t::render()
+static void init_shader5()
 {
-    vec4 color4;
-    color4[ 0 ] = color.r;
-    color4[ 1 ] = color.g;
-    color4[ 2 ] = color.b;
-    color4[ 3 ] = alpha;
-
-    mat4 local_model;
-    compute_model_matrix( local_model, rect );
-
-    float uv_data[ 12 ];
-    uv_rect.vertices_2d( uv_data );
-    intern.quad_uv_buffer.set( uv_data, 6 );
+    int id = build_shader(
+        find_shader_string( "shader5_vertex" ),
+        find_shader_string( "shader5_fragment" )
+    );
+    intern.shader5.id = id;
+    intern.shader5.proj = find_uniform( id, "u_proj" );
+    intern.shader5.pos = find_attrib( id, "a_pos" );
+    intern.shader5.local = find_attrib( id, "a_local" );
+    intern.shader5.shape = find_attrib( id, "a_shape" );
+    intern.shader5.color = find_attrib( id, "a_color" );
+}
 
-    glUseProgram( intern.shader3.id );
-    glBindTexture( GL_TEXTURE_2D, texture );
-    set_uniform( intern.shader3.proj, intern.proj );
-    set_uniform( intern.shader3.model, local_model );
-    set_uniform( intern.shader3.color, color4 );
-    set_uniform( intern.shader3.texture, 0 );
-    intern.quad_pos_buffer.enable( 0 );
-    intern.quad_uv_buffer.enable( 1 );
+////////////////////////////////////////////////////////////////////////////////
+// command building
+////////////////////////////////////////////////////////////////////////////////
 
-    glDrawArrays( GL_TRIANGLES, 0, intern.quad_pos_buffer.element_count );
+static render_cmd_t * push_cmd( int depth, int material, int type )
+{
+    return intern.cmds->push( intern.layer, depth, material, type );
 }
 
-struct sprite_t {
-    vec2 pos;
-    float scale;
-    float rotation = 0.0f;
-
-    color_t color;
-    float alpha = 1.0f;
+void solid_sprite_t::render( int depth )
+{
+    render_cmd_t * cmd = push_cmd( depth, MATERIAL_SOLID, CMD_RECT );
+    if ( !cmd ) return;
 
-    void setup();
-};
+    cmd->rect.rect = rect;
+    cmd->rect.color = color;
+    cmd->rect.alpha = alpha;
+}
 
-void sprite_t::setup()
+void sprite_t::render( int mesh, int depth )
 {
-    vec4 color4;
-    color4[ 0 ] = color.r;
-    color4[ 1 ] = color.g;
-    color4[ 2 ] = color.b;
-    color4[ 3 ] = alpha;
-
-    mat4 local_model;
-    glm_mat4_identity( local_model );
-    glm_translate_x( local_model, pos[ 0 ] );
-    glm_translate_y( local_model, pos[ 1 ] );
-    glm_scale_uni( local_model, scale );
-    glm_rotate_z( local_model, rotation, local_model );
-
-    glUseProgram( intern.shader1.id );
-    set_uniform( intern.shader1.proj, intern.proj );
-    set_uniform( intern.shader1.model, local_model );
-    set_uniform( intern.shader1.color, color4 );
+    render_cmd_t * cmd = push_cmd( depth, MATERIAL_SOLID, CMD_SHAPE );
+    if ( !cmd ) return;
+
+    cmd->shape.mesh = mesh;
+    cmd->shape.x = pos[ 0 ];
+    cmd->shape.y = pos[ 1 ];
+    cmd->shape.scale = scale;
+    cmd->shape.rotation = rotation;
+    cmd->shape.color = color;
+    cmd->shape.alpha = alpha;
 }
 
-void solid_sprite_t::render()
+void sprite_t::render_polygon( int sides, int depth )
 {
-    vec4 color4;
-    color4[ 0 ] = color.r;
-    color4[ 1 ] = color.g;
-    color4[ 2 ] = color.b;
-    color4[ 3 ] = alpha;
+    render_cmd_t * cmd = push_cmd( depth, MATERIAL_POLYGON, CMD_POLYGON );
+    if ( !cmd ) return;
+
+    cmd->polygon.x = pos[ 0 ];
+    cmd->polygon.y = pos[ 1 ];
+    cmd->polygon.radius = scale;
+    cmd->polygon.rotation = rotation;
+    cmd->polygon.sides = sides;
+    cmd->polygon.ring = ring;
+    cmd->polygon.color = color;
+    cmd->polygon.alpha = alpha;
+}
 
-    mat4 local_model;
-    compute_model_matrix( local_model, rect );
+/// starts a layer, everything pushed after this is seen through view
+static void setup_camera( int layer, rect_t view )
+{
+    intern.layer = layer;
 
-    glUseProgram( intern.shader1.id );
-    set_uniform( intern.shader1.proj, intern.proj );
-    set_uniform( intern.shader1.model, local_model );
-    set_uniform( intern.shader1.color, color4 );
+    render_cmd_t * cmd = push_cmd( 0, MATERIAL_NONE, CMD_CAMERA );
+    if ( !cmd ) return;
 
-    intern.quad_pos_buffer.enable( 0 );
-    glDrawArrays( GL_TRIANGLES, 0, intern.quad_pos_buffer.element_count );
+    cmd->camera.view = view;
 }
 
-static void setup_ui_camera()
+static void setup_ui_camera( int layer = LAYER_UI )
 {
-    glm_ortho(
-        0.0f,
-        hardware_width(),
-        hardware_height(),
-        0.0f,
-        0.0f,
-        1000.0f,
-        intern.proj
-    );
+    rect_t view;
+    view.x = 0.0f;
+    view.y = 0.0f;
+    view.w = hardware_width();
+    view.h = hardware_height();
+    setup_camera( layer, view );
 }
 
 static void setup_world_camera()
@@ -245,59 +457,60 @@ static void setup_world_camera()
     shake[ 1 ] = 0.0f;
 
     if ( tick_timer( &intern.shake_timer, state.render_step ) ) {
-        shake[ 0 ] = 5.0f * sinf( state.render_time * 100.0f );
-        shake[ 1 ] = 5.0f * sinf( state.render_time * 100.0f );
-    }
-
-    glm_ortho(
-        0.0f,
-        hardware_width(),
-        hardware_height(),
-        0.0f,
-        0.0f,
-        1000.0f,
-        intern.proj
-    );
+        shake[ 0 ] = k_shake_amount * sinf( state.render_time * 100.0f );
+        shake[ 1 ] = k_shake_amount * sinf( state.render_time * 100.0f );
+    }
 
-    glm_translate_x(
-        intern.proj,
-        shake[ 0 ] + hardware_width() * 0.5f - state.player_pos[ 0 ]
-    );
-    glm_translate_y(
-        intern.proj,
-        shake[ 1 ] + hardware_height() * 0.5f - state.player_pos[ 1 ]
-    );
+    rect_t view;
+    view.x = state.player_pos[ 0 ] - hardware_width() * 0.5f;
+    view.y = state.player_pos[ 1 ] - hardware_height() * 0.5f;
+    view.w = hardware_width();
+    view.h = hardware_height();
+
+    intern.view_rect = view;
+    intern.view_rect.margin( -k_shake_amount );
+
+    view.x -= shake[ 0 ];
+    view.y -= shake[ 1 ];
+    setup_camera( LAYER_WORLD, view );
+
+    intern.cmds->effect_amount = intern.shake_timer / k_shake_time;
 }
 
-enum alignment_t {
-    ALIGN_LEFT,
-    ALIGN_RIGHT,
-    ALIGN_CENTER,
-};
+/// rect around a point entity, used for view culling
+static rect_t bounds_rect( vec2 pos, float radius )
+{
+    rect_t r;
+    r.x = pos[ 0 ] - radius;
+    r.y = pos[ 1 ] - radius;
+    r.w = radius * 2.0f;
+    r.h = radius * 2.0f;
+    return r;
+}
 
-struct text_settings_t {
-    color_t color = color_white;
-    float alpha = 1.0f;
-    alignment_t align_x = ALIGN_LEFT;
-    alignment_t align_y = ALIGN_LEFT;
-    bool render_bg = false;
-    float scale = 1.0f;
-};
+static int is_visible( rect_t r )
+{
+    if ( intern.view_rect.overlaps( r ) ) {
+        intern.stats.drawn_count++;
+        return 1;
+    }
 
-static void render_text(
+    intern.stats.culled_count++;
+    return 0;
+}
+
+/// moves the anchor by the alignment and pushes the run, width and height are
+/// unscaled. the glyphs have to live in the arena of the buffer
+static void push_glyphs(
     int x,
     int y,
-    const char * str,
-    text_settings_t settings = text_settings_t()
+    const glyph_t * g_list,
+    int g_count,
+    float width,
+    float height,
+    const text_settings_t & settings
 )
 {
-    glyph_t g_list[ 64 ];
-    int g_count;
-    float width;
-    float height;
-
-    intern.font.calc_glyphs( g_list, &g_count, &width, &height, str );
-
     // x -> s * x    s * x - x = x * (s - 1)
 
     width *= settings.scale;
@@ -324,138 +537,71 @@ static void render_text(
         solid.rect = { (float) x, (float) y, width, height };
         solid.rect.margin( -3 );
         solid.color = color_black;
-        solid.render();
-    }
-
-    vec3 scale;
-    scale[ 0 ] = settings.scale;
-    scale[ 1 ] = settings.scale;
-    scale[ 2 ] = 1.0f;
-
-    vec3 translate;
-    translate[ 0 ] = x;
-    translate[ 1 ] = y;
-    translate[ 2 ] = 0.0f;
-
-    glm_mat4_identity( intern.model );
-    glm_translate( intern.model, translate );
-    glm_scale( intern.model, scale );
-
-    for ( int i = 0; i < g_count; i++ ) {
-        textured_sprite_t s;
-        s.rect.x = g_list[ i ].x;
-        s.rect.y = g_list[ i ].y;
-        s.rect.w = g_list[ i ].w;
-        s.rect.h = g_list[ i ].h;
-        s.uv_rect.x = g_list[ i ].u1;
-        s.uv_rect.y = g_list[ i ].v1;
-        s.uv_rect.w = g_list[ i ].u2 - g_list[ i ].u1;
-        s.uv_rect.h = g_list[ i ].v2 - g_list[ i ].v1;
-        s.texture = intern.font_texture;
-        s.color = settings.color;
-        s.alpha = settings.alpha;
-        s.render();
+        solid.render( DEPTH_PANEL );
     }
 
-    glm_mat4_identity( intern.model );
+    render_cmd_t * cmd = push_cmd( DEPTH_TEXT, MATERIAL_TEXT, CMD_GLYPHS );
+    if ( !cmd ) return;
+
+    cmd->glyphs.glyph_list = g_list;
+    cmd->glyphs.glyph_count = g_count;
+    cmd->glyphs.texture = intern.atlas_texture;
+    cmd->glyphs.x = x;
+    cmd->glyphs.y = y;
+    cmd->glyphs.scale = settings.scale;
+    cmd->glyphs.color = settings.color;
+    cmd->glyphs.alpha = settings.alpha;
 }
 
-void render_init()
+/// lays the text out every call, for text that changes every frame
+static void render_text(
+    int x,
+    int y,
+    const char * str,
+    text_settings_t settings = text_settings_t()
+)
 {
-    float quad_data[ 12 ];
-    rect_t{ 0.0f, 0.0f, 1.0f, 1.0f }.vertices_2d( quad_data );
-
-    float fb_pos_data[ 12 ];
-    rect_t{ -1.0f, -1.0f, 2.0f, 2.0f }.vertices_2d( fb_pos_data );
-
-    float fb_uv_data[ 12 ];
-    rect_t{ 0.0f, 0.0f, 1.0f, 1.0f }.vertices_2d( fb_uv_data );
-
-    float player_data[ 14 ];
-    ngon_vertices( player_data, 5 );
-
-    float bitch_bullet[ 10 ];
-    ngon_vertices( bitch_bullet, 3 ); // (amount + 2) * 2
-
-    float mob[ 68 ];
-    ngon_vertices( mob, 32 ); // (amount + 2) * 2
-
-    float hammer[ 16 ];
-    hammer[ 0 ] = -2.0f;
-    hammer[ 1 ] = -2.0f;
-
-    hammer[ 2 ] = 30.0f;
-    hammer[ 3 ] = -2.0f;
-
-    hammer[ 4 ] = 30.0f;
-    hammer[ 5 ] = 2.0f;
-
-    hammer[ 6 ] = -2.0f;
-    hammer[ 7 ] = 2.0f;
-
-    hammer[ 8 ] = 30.0f;
-    hammer[ 9 ] = -10.0f;
-
-    hammer[ 10 ] = 44.0f;
-    hammer[ 11 ] = -10.0f;
-
-    hammer[ 12 ] = 44.0f;
-    hammer[ 13 ] = 10.0f;
-
-    hammer[ 14 ] = 30.0f;
-    hammer[ 15 ] = 10.0f;
-
-    // init vertex buffers
-
-    intern.quad_pos_buffer.init( 2 );
-    intern.quad_pos_buffer.set( quad_data, 6 );
-
-    intern.quad_uv_buffer.init( 2 );
-    intern.quad_uv_buffer.set( fb_uv_data, 6 );
-
-    intern.player_buffer.init( 2 );
-    intern.player_buffer.set( player_data, 7 );
-
-    intern.mob_buffer.init( 2 );
-    intern.mob_buffer.set( mob, 34 );
-
-    intern.bitch_buffer.init( 2 );
-    intern.bitch_buffer.set( bitch_bullet, 5 );
-
-    intern.line_bullet_buffer.init( 2 );
-
-    intern.hammer_buffer.init( 2 );
-    intern.hammer_buffer.set( hammer, 8 );
+    glyph_t * g_list =
+        intern.cmds->arena.alloc_list< glyph_t >( (int) strlen( str ) );
+    int g_count;
+    float width;
+    float height;
 
-    // intern.fb_pos_buffer.init( 2 );
-    // intern.fb_pos_buffer.set( fb_pos_data, 6 );
+    if ( !g_list ) return;
 
-    // intern.fb_uv_buffer.init( 2 );
-    // intern.fb_uv_buffer.set( fb_uv_data, 6 );
+    intern.font.calc_glyphs( g_list, &g_count, &width, &height, str );
+    intern.stats.layout_count++;
 
-    // init shaders
+    push_glyphs( x, y, g_list, g_count, width, height, settings );
+}
 
-    init_shader1();
-    init_shader2();
-    init_shader3();
+void label_t::set( const char * new_text, const text_settings_t & new_settings )
+{
+    settings = new_settings;
 
-    // init font
+    if ( valid && strcmp( text, new_text ) == 0 ) return;
 
-    intern.font.init( find_res( "bit.fnt" ) );
-    intern.font_texture = load_texture( find_res( "bit.png" ) );
+    snprintf( text, k_label_len, "%s", new_text );
+    intern.font.calc_glyphs( glyph_list, &glyph_count, &width, &height, text );
+    intern.stats.layout_count++;
+    valid = 1;
+}
 
-    // init misc
+void label_t::render( int x, int y )
+{
+    if ( !valid || glyph_count == 0 ) return;
 
-    glm_mat4_identity( intern.model );
+    // commands only point into their own arena, so the glyphs are copied
+    // rather than laid out again
+    glyph_t * g_list =
+        intern.cmds->arena.alloc_list< glyph_t >( glyph_count );
+    if ( !g_list ) return;
 
-    // init gl state
+    memcpy( g_list, glyph_list, glyph_count * sizeof( glyph_t ) );
 
-    glEnable( GL_BLEND );
-    glBlendFunc( GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA ); // blend alpha
+    push_glyphs( x, y, g_list, glyph_count, width, height, settings );
 }
 
-////////////////////////////////////////////////////////////////////////////////
-
 static void render_bitch_bullet( int i )
 {
     sprite_t s;
@@ -464,54 +610,63 @@ static void render_bitch_bullet( int i )
     s.scale = 5.0f;
     s.color = color_red;
     s.rotation = state.render_time;
-    s.setup();
-
-    intern.bitch_buffer.enable( 0 );
-    glDrawArrays( GL_TRIANGLE_FAN, 0, intern.bitch_buffer.element_count );
+    s.render_polygon( 3, DEPTH_BULLETS );
 }
 
-static void render_line_bullet( int i )
+static rect_t line_bullet_rect( int i )
 {
-    vec2 delta;
-    glm_vec2_sub(
-        state.line_bullet_pos2_list[ i ],
-        state.line_bullet_pos1_list[ i ],
-        delta
+    rect_t r;
+    r.x = fminf(
+        state.line_bullet_pos1_list[ i ][ 0 ],
+        state.line_bullet_pos2_list[ i ][ 0 ]
     );
+    r.y = fminf(
+        state.line_bullet_pos1_list[ i ][ 1 ],
+        state.line_bullet_pos2_list[ i ][ 1 ]
+    );
+    r.w = fabsf(
+        state.line_bullet_pos1_list[ i ][ 0 ] -
+        state.line_bullet_pos2_list[ i ][ 0 ]
+    );
+    r.h = fabsf(
+        state.line_bullet_pos1_list[ i ][ 1 ] -
+        state.line_bullet_pos2_list[ i ][ 1 ]
+    );
+    r.margin( -3.0f );
+    return r;
+}
 
-    sprite_t s;
-    s.pos[ 0 ] = state.line_bullet_pos1_list[ i ][ 0 ];
-    s.pos[ 1 ] = state.line_bullet_pos1_list[ i ][ 1 ];
-    s.scale = 1.0f;
-    s.color = color_yellow;
-    s.rotation = atan2f( delta[ 1 ], delta[ 0 ] );
-    s.setup();
-
-    float len = glm_vec2_norm( delta );
-    float w = 3.0f;
-
-    // heh... shur up
-    float line_bullet[ 16 ];
-    line_bullet[ 0 ] = 0.0f;
-    line_bullet[ 1 ] = 0.0f;
-    line_bullet[ 2 ] = -w;
-    line_bullet[ 3 ] = 0.0f;
-    line_bullet[ 4 ] = 0.0f;
-    line_bullet[ 5 ] = -w;
-    line_bullet[ 6 ] = len;
-    line_bullet[ 7 ] = -w;
-    line_bullet[ 8 ] = len + w;
-    line_bullet[ 9 ] = 0.0f;
-    line_bullet[ 10 ] = len;
-    line_bullet[ 11 ] = w;
-    line_bullet[ 12 ] = 0.0f;
-    line_bullet[ 13 ] = w;
-    line_bullet[ 14 ] = -w;
-    line_bullet[ 15 ] = 0.0f;
-
-    intern.line_bullet_buffer.set( line_bullet, 8 );
-    intern.line_bullet_buffer.enable( 0 );
-    glDrawArrays( GL_TRIANGLE_FAN, 0, intern.line_bullet_buffer.element_count );
+/// the end points of all visible line bullets as one command
+static void render_line_bullets()
+{
+    if ( state.line_bullet_count == 0 ) return;
+
+    float * end_list =
+        intern.cmds->arena.alloc_list< float >( state.line_bullet_count * 4 );
+    if ( !end_list ) return;
+
+    int count = 0;
+    for ( int i = 0; i < state.line_bullet_count; i++ ) {
+        if ( !is_visible( line_bullet_rect( i ) ) ) continue;
+
+        float * out = end_list + count * 4;
+        out[ 0 ] = state.line_bullet_pos1_list[ i ][ 0 ];
+        out[ 1 ] = state.line_bullet_pos1_list[ i ][ 1 ];
+        out[ 2 ] = state.line_bullet_pos2_list[ i ][ 0 ];
+        out[ 3 ] = state.line_bullet_pos2_list[ i ][ 1 ];
+        count++;
+    }
+
+    if ( count == 0 ) return;
+
+    render_cmd_t * cmd =
+        push_cmd( DEPTH_BULLETS, MATERIAL_LINE_BULLET, CMD_LINE_BULLETS );
+    if ( !cmd ) return;
+
+    cmd->line_bullets.end_list = end_list;
+    cmd->line_bullets.count = count;
+    cmd->line_bullets.width = 3.0f;
+    cmd->line_bullets.color = color_yellow;
 }
 
 static void render_mob( int i )
@@ -523,10 +678,7 @@ static void render_mob( int i )
     // s.color.r += 0.3f * sinf( state.render_time * 4.0f );
     s.color.g += 0.3f + 0.3f * sinf( state.render_time * 4.0f );
     s.color.b += 0.3f + 0.3f * sinf( state.render_time * 4.0f );
-    s.setup();
-
-    intern.mob_buffer.enable( 0 );
-    glDrawArrays( GL_TRIANGLE_FAN, 0, intern.mob_buffer.element_count );
+    s.render_polygon( 0, DEPTH_MOBS );
 }
 
 static void render_player()
@@ -538,31 +690,12 @@ static void render_player()
     s.scale = 8.0f * z_scale;
     s.color = state.player_z ? color_green : color_white;
     s.rotation = state.render_time;
-    s.setup();
-
-    intern.player_buffer.enable( 0 );
-    glDrawArrays( GL_TRIANGLE_FAN, 0, intern.player_buffer.element_count );
+    s.render_polygon( 5, DEPTH_PLAYER );
 
     s.scale = z_scale;
     s.color = color_orange;
     s.rotation = state.player_hammer;
-    s.setup();
-
-    intern.hammer_buffer.enable( 0 );
-    glDrawArrays( GL_TRIANGLE_FAN, 0, 4 );
-    glDrawArrays( GL_TRIANGLE_FAN, 4, 4 );
-}
-
-static void render_exit()
-{
-    solid_sprite_t s;
-    s.color = color_black;
-    s.rect.x = state.exit_pos[ 0 ];
-    s.rect.y = state.exit_pos[ 1 ];
-    s.rect.w = 50.0f;
-    s.rect.h = 50.0f;
-    s.rect.centerize();
-    s.render();
+    s.render( MESH_HAMMER, DEPTH_PLAYER );
 }
 
 static void render_ui()
@@ -572,150 +705,1184 @@ static void render_ui()
     text_settings_t settings;
     settings.scale = 2.0f;
 
-    char buffer[ 1024 ];
-    snprintf( buffer, 1024, "bullets: %d", state.bullet_count );
-    render_text( 0, 0, buffer, settings );
+    // formatted only when the count changes
+    if ( state.bullet_count != intern.ui.bullet_count ) {
+        char buffer[ 64 ];
+        snprintf( buffer, 64, "bullets: %d", state.bullet_count );
+        intern.ui.bullets.set( buffer, settings );
+        intern.ui.bullet_count = state.bullet_count;
+    }
+    intern.ui.bullets.render( 0, 0 );
+
+#if !RELEASE
+    char buffer[ k_label_len ];
+    snprintf(
+        buffer,
+        k_label_len,
+        "drawn: %d\nculled: %d\nscale: %.2f\ncmds: %d\ndraws: %d",
+        intern.stats.drawn_count,
+        intern.stats.culled_count,
+        intern.stats.world_scale,
+        intern.stats.cmd_count,
+        intern.stats.draw_count
+    );
+    text_settings_t stats_settings = settings;
+    stats_settings.align_y = ALIGN_RIGHT;
+    intern.ui.stats.set( buffer, stats_settings );
+    intern.ui.stats.render( 0, hardware_height() );
+#endif
 
     settings.align_x = ALIGN_RIGHT;
-    render_text(
-        hardware_width(),
-        0.0f,
+    intern.ui.controls.set(
         "move    [w][a][s][d]\n"
         "hammer  [h][j][k][l]\n"
         "jump    [space]",
         settings
     );
+    intern.ui.controls.render( hardware_width(), 0 );
 }
 
-static void render_room_outline( int i )
+/// big centered title with a line under it, for the start, win and lose
+/// screens
+static void render_title_screen( const char * title, const char * subtitle )
 {
-    solid_sprite_t s;
-    s.rect = state.room_rect_list[ i ];
-    s.rect.margin( -10 );
-    s.color = color_white;
-    s.render();
-}
+    setup_ui_camera();
 
-static void render_room( int i )
-{
-    solid_sprite_t s;
-    s.rect = state.room_rect_list[ i ];
-    s.rect.margin( -5 );
-    s.color = color_gray;
-    s.render();
+    text_settings_t settings;
+    settings.align_x = ALIGN_CENTER;
+    settings.align_y = ALIGN_CENTER;
+    settings.scale = 5.0f;
+    intern.ui.title.set( title, settings );
+    intern.ui.title.render( hardware_width() / 2, hardware_height() / 2 );
+
+    settings.align_y = ALIGN_RIGHT;
+    settings.scale = 2.0f;
+    intern.ui.subtitle.set( subtitle, settings );
+    intern.ui.subtitle.render(
+        hardware_width() / 2,
+        hardware_height() - 10.0f
+    );
 }
 
-static void render_rooms()
+/// the level is baked into static buffers on the gl side, the command only
+/// carries it so it can be rebuilt when the version changes
+static void render_level()
 {
-    for ( int i = 0; i < state.room_count; i++ ) {
-        render_room_outline( i );
+    render_cmd_t * cmd = push_cmd( DEPTH_LEVEL, MATERIAL_LEVEL, CMD_LEVEL );
+    if ( !cmd ) return;
+
+    rect_t * room_list =
+        intern.cmds->arena.alloc_list< rect_t >( state.room_count );
+    if ( room_list ) {
+        memcpy(
+            room_list,
+            state.room_rect_list,
+            sizeof( rect_t ) * state.room_count
+        );
     }
 
-    for ( int i = 0; i < state.room_count; i++ ) {
-        render_room( i );
-    }
+    cmd->level.version = state.level_version;
+    cmd->level.room_list = room_list;
+    cmd->level.room_count = room_list ? state.room_count : 0;
+    cmd->level.exit_x = state.exit_pos[ 0 ];
+    cmd->level.exit_y = state.exit_pos[ 1 ];
+}
+
+static void render_bullets()
+{
+    float radius = 5.0f;
+
+    rect_t query = intern.view_rect;
+    query.margin( -radius );
+
+    // cells outside the view are never visited, so the bullets in them cost
+    // nothing here
+    int visited = 0;
+    state.bullet_grid.for_each( query, [ & ]( int i ) {
+        visited++;
+        if ( is_visible( bounds_rect( state.bullet_pos_list[ i ], radius ) ) ) {
+            render_bitch_bullet( i );
+        }
+    } );
+
+    intern.stats.culled_count += state.bullet_grid.item_count - visited;
 }
 
 static void render_world()
 {
     setup_world_camera();
 
-    render_rooms();
-    render_exit();
+    intern.stats.drawn_count = 0;
+    intern.stats.culled_count = 0;
 
-    for ( int i = 0; i < state.bullet_count; i++ ) {
-        render_bitch_bullet( i );
-    }
+    render_level();
 
-    for ( int i = 0; i < state.line_bullet_count; i++ ) {
-        render_line_bullet( i );
-    }
+    render_bullets();
+
+    render_line_bullets();
 
     for ( int i = 0; i < state.mob_count; i++ ) {
-        render_mob( i );
+        // radius pulses up to 22
+        if ( is_visible( bounds_rect( state.mob_pos_list[ i ], 22.0f ) ) ) {
+            render_mob( i );
+        }
     }
 
     render_player();
 }
 
-void trigger_camera_shake()
+/// drops the world resolution quickly when frames run over budget and
+/// raises it slowly once they have been comfortably inside it for a while.
+/// the budget is the deadline of the present mode, the load the measured gpu
+/// time where timer queries work and the frame delta elsewhere
+static void update_world_scale()
 {
-    intern.shake_timer = 0.2f;
-}
+    float time = hardware_time();
+    float frame_time = time - intern.last_frame_time;
+    intern.last_frame_time = time;
 
-void render()
+    // loading hitches and window drags say nothing about render cost
+    if ( frame_time > 0.25f ) return;
+
+    float budget = hardware_present_stats().deadline;
+    if ( budget <= 0.0f ) budget = k_frame_budget;
+
+    float load = frame_time;
+    float high = budget * k_frame_high_load;
+    float low = budget * k_frame_low_load;
+
+    if ( intern.gpu_time >= 0.0f ) {
+        load = intern.gpu_time;
+        high = budget * k_gpu_high_load;
+        low = budget * k_gpu_low_load;
+    }
+
+    intern.load_avg += ( load - intern.load_avg ) * 0.1f;
+
+    if ( intern.load_avg > high ) {
+        intern.world_scale -= k_world_scale_step;
+        // give the smaller target a moment to show before judging it
+        intern.load_avg = ( high + low ) * 0.5f;
+        intern.fast_frame_count = 0;
+    } else if ( intern.load_avg < low ) {
+        intern.fast_frame_count++;
+    } else {
+        intern.fast_frame_count = 0;
+    }
+
+    if ( intern.fast_frame_count >= 60 ) {
+        intern.world_scale += k_world_scale_step;
+        intern.fast_frame_count = 0;
+    }
+
+    intern.world_scale =
+        fminf( fmaxf( intern.world_scale, k_min_world_scale ), 1.0f );
+    intern.stats.world_scale = intern.world_scale;
+}
+
+/// one row per stage: average in ms and a bar per recent frame, scaled so a
+/// full bar is half a 60 hz frame. the last row is the present timing
+static void render_profiler()
 {
-    glClearColor( 0.0f, 0.0f, 0.0f, 1.0f );
-    glClear( GL_COLOR_BUFFER_BIT );
+    setup_ui_camera( LAYER_OVERLAY );
+
+    float x = 10.0f;
+    float y = 60.0f;
+    float row_height = 20.0f;
+    float bar_height = 16.0f;
+    float bar_width = 2.0f;
+    float graph_x = x + 136.0f;
+    float full_time = k_frame_budget * 0.5f;
+    int row_count = PROFILE_STAGE_COUNT;
+
+    solid_sprite_t panel;
+    panel.rect.x = x;
+    panel.rect.y = y;
+    panel.rect.w = graph_x - x + k_profile_frame_count * bar_width;
+    panel.rect.h = ( row_count + 1 ) * row_height;
+    panel.rect.margin( -5 );
+    panel.color = color_black;
+    panel.alpha = 0.8f;
+    panel.render( DEPTH_PANEL );
+
+    for ( int s = 0; s < row_count; s++ ) {
+        profile_stage_t stage = (profile_stage_t) s;
+        float row_y = y + s * row_height;
+
+        // bars, newest on the right
+        for ( int f = 0; f < k_profile_frame_count; f++ ) {
+            float t = profiler_time( stage, f );
+            float h = roundf( fminf( t / full_time, 1.0f ) * bar_height );
+            if ( h < 1.0f ) continue;
+
+            solid_sprite_t bar;
+            bar.rect.x =
+                graph_x + ( k_profile_frame_count - 1 - f ) * bar_width;
+            bar.rect.y = row_y + bar_height - h;
+            bar.rect.w = bar_width;
+            bar.rect.h = h;
+            bar.color = color_green;
+            bar.render( DEPTH_GRAPH );
+        }
+
+        char buffer[ 64 ];
+        if ( stage == PROFILE_GPU && !intern.gpu_timer.supported ) {
+            snprintf( buffer, 64, "%-8s   n/a", profiler_stage_name( stage ) );
+        } else {
+            snprintf(
+                buffer,
+                64,
+                "%-8s %5.2fms",
+                profiler_stage_name( stage ),
+                profiler_average( stage ) * 1000.0f
+            );
+        }
+
+        text_settings_t settings;
+        settings.align_y = ALIGN_CENTER;
+        render_text( x, row_y + bar_height * 0.5f, buffer, settings );
+    }
+
+    // present to present, from the platform layer
+    present_stats_t present = hardware_present_stats();
+    float row_y = y + row_count * row_height + bar_height * 0.5f;
+
+    text_settings_t settings;
+    settings.align_y = ALIGN_CENTER;
+
+    char buffer[ 64 ];
+    snprintf(
+        buffer,
+        64,
+        "%-8s %5.2fms",
+        "present",
+        present.avg_frame_time * 1000.0f
+    );
+    render_text( x, row_y, buffer, settings );
+
+    snprintf(
+        buffer,
+        64,
+        "p99 %5.2f miss %d",
+        present.p99_frame_time * 1000.0f,
+        present.missed_count
+    );
+    render_text( graph_x, row_y, buffer, settings );
+}
+
+/// walks state and fills the command buffer, no gl calls in here
+static void render_build( render_cmd_buffer_t * buffer )
+{
+    intern.cmds = buffer;
+    intern.layer = LAYER_WORLD;
+    intern.stats.layout_count = 0;
+
+    update_world_scale();
+    buffer->world_scale = intern.world_scale;
 
     if ( state.scene == SCENE_GAME ) {
+        profiler_begin( PROFILE_RENDER_WORLD );
         render_world();
+        profiler_end( PROFILE_RENDER_WORLD );
+
+        profiler_begin( PROFILE_RENDER_UI );
         render_ui();
+        profiler_end( PROFILE_RENDER_UI );
     }
     if ( state.scene == SCENE_START ) {
-        setup_ui_camera();
-        text_settings_t settings;
-        settings.align_x = ALIGN_CENTER;
-        settings.align_y = ALIGN_CENTER;
-        settings.scale = 5.0f;
-        render_text(
-            hardware_width() / 2,
-            hardware_height() / 2,
-            "don't",
-            settings
-        );
-
-        settings.align_y = ALIGN_RIGHT;
-        settings.scale = 2.0f;
-        render_text(
-            hardware_width() / 2,
-            hardware_height() - 10.0f,
-            "press [space] to start",
-            settings
-        );
+        render_title_screen( "don't", "press [space] to start" );
     }
     if ( state.scene == SCENE_WIN ) {
-        setup_ui_camera();
-        text_settings_t settings;
-        settings.align_x = ALIGN_CENTER;
-        settings.align_y = ALIGN_CENTER;
-        settings.scale = 5.0f;
-        render_text(
-            hardware_width() / 2,
-            hardware_height() / 2,
-            "WIN",
-            settings
-        );
+        render_title_screen( "WIN", "a stupid game by meowstr <3" );
+    }
+    if ( state.scene == SCENE_LOSE ) {
+        render_title_screen( "LOSE", "a stupid game by meowstr <3" );
+    }
+
+    if ( profiler_visible() ) {
+        render_profiler();
+    }
 
-        settings.align_y = ALIGN_RIGHT;
-        settings.scale = 2.0f;
-        render_text(
-            hardware_width() / 2,
-            hardware_height() - 10.0f,
-            "a stupid game by meowstr <3",
-            settings
+    intern.stats.cmd_count = buffer->cmd_count;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// gl submission
+////////////////////////////////////////////////////////////////////////////////
+
+static void draw_arrays( int mode, int first, int count )
+{
+    glDrawArrays( mode, first, count );
+    intern.draw_count++;
+}
+
+/// grows the cpu side batch arrays to fit vertex_count vertices
+static void reserve_batch( int vertex_count )
+{
+    if ( vertex_count <= intern.batch_cap ) return;
+
+    int cap = intern.batch_cap ? intern.batch_cap : 1024;
+    while ( cap < vertex_count ) {
+        cap *= 2;
+    }
+
+    delete[] intern.batch_pos_data;
+    delete[] intern.batch_uv_data;
+    delete[] intern.batch_color_data;
+    delete[] intern.batch_shape_data;
+    intern.batch_pos_data = new float[ cap * 2 ];
+    intern.batch_uv_data = new float[ cap * 2 ];
+    intern.batch_color_data = new float[ cap * 4 ];
+    intern.batch_shape_data = new float[ cap * 3 ];
+    intern.batch_cap = cap;
+}
+
+static void fill_color( float * out, int count, color_t color, float alpha )
+{
+    for ( int i = 0; i < count; i++ ) {
+        out[ i * 4 + 0 ] = color.r;
+        out[ i * 4 + 1 ] = color.g;
+        out[ i * 4 + 2 ] = color.b;
+        out[ i * 4 + 3 ] = alpha;
+    }
+}
+
+static void submit_camera( const render_cmd_t & cmd )
+{
+    intern.proj = affine_ortho( cmd.camera.view );
+    intern.view = cmd.camera.view;
+}
+
+static void build_level_geometry( const render_cmd_t & cmd )
+{
+    int vertex_count = level_vertex_count( cmd );
+    float * pos_data = new float[ vertex_count * 2 ];
+    float * color_data = new float[ vertex_count * 4 ];
+
+    level_vertices( cmd, pos_data, color_data );
+
+    intern.level_pos_buffer.set( pos_data, vertex_count, 1 );
+    intern.level_color_buffer.set( color_data, vertex_count, 1 );
+    delete[] pos_data;
+    delete[] color_data;
+
+    intern.level_vertex_count = vertex_count;
+    intern.level_version = cmd.level.version;
+}
+
+/// room outlines, room fills and the exit in one draw, the gpu clips
+/// whatever is off screen
+static void draw_level_geometry( const affine_t & view )
+{
+    float proj[ 4 ];
+    affine_uniform( view, proj );
+
+    glUseProgram( intern.shader1.id );
+    set_uniform( intern.shader1.proj, proj );
+    intern.level_pos_buffer.enable( intern.shader1.pos );
+    intern.level_color_buffer.enable( intern.shader1.color );
+
+    draw_arrays( GL_TRIANGLES, 0, intern.level_vertex_count );
+}
+
+#if BACKGROUND_CACHE
+
+static int init_background()
+{
+    int max_size = 0;
+    glGetIntegerv( GL_MAX_TEXTURE_SIZE, &max_size );
+    if ( max_size < k_background_size ) {
+        INFO_LOG( "textures up to %d, drawing the level directly", max_size );
+        return -1;
+    }
+
+    intern.background_fb.init( k_background_size, k_background_size );
+
+    // texels are layer units, nearest keeps the room edges as sharp as
+    // drawing them directly
+    glBindTexture( GL_TEXTURE_2D, intern.background_fb.texture );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST );
+
+    for ( background_slot_t & slot : intern.background_slot_list ) {
+        slot.version = -1;
+        slot.used = -1;
+    }
+
+    return 1;
+}
+
+static void slot_origin( int slot, int * out_x, int * out_y )
+{
+    *out_x = ( slot % k_background_row ) * k_background_tile_size;
+    *out_y = ( slot / k_background_row ) * k_background_tile_size;
+}
+
+/// draws tile x, y of the level into a slot, binding the cache on the
+/// first miss of the frame
+static void draw_background_tile( int slot, int x, int y )
+{
+    const int size = k_background_tile_size;
+
+    if ( !intern.background_bound ) {
+        intern.background_fb.bind();
+        glEnable( GL_SCISSOR_TEST );
+        intern.background_bound = 1;
+    }
+
+    int px;
+    int py;
+    slot_origin( slot, &px, &py );
+
+    glViewport( px, py, size, size );
+    glScissor( px, py, size, size );
+    glClear( GL_COLOR_BUFFER_BIT );
+
+    rect_t tile;
+    tile.x = x * size;
+    tile.y = y * size;
+    tile.w = size;
+    tile.h = size;
+    draw_level_geometry( affine_ortho( tile ) );
+}
+
+/// the slot holding tile x, y of the current level, drawing it into the
+/// least recently used slot on a miss. slots used this frame are never
+/// taken, so there is always one as long as fewer tiles than slots are
+/// visible
+static int find_background_slot( int x, int y )
+{
+    int frame = intern.background_frame;
+    int oldest = -1;
+
+    for ( int i = 0; i < k_background_slot_count; i++ ) {
+        background_slot_t & slot = intern.background_slot_list[ i ];
+
+        if ( slot.version == intern.level_version && slot.x == x &&
+             slot.y == y ) {
+            slot.used = frame;
+            return i;
+        }
+
+        if ( slot.used == frame ) continue;
+        if ( oldest < 0 ||
+             slot.used < intern.background_slot_list[ oldest ].used ) {
+            oldest = i;
+        }
+    }
+
+    background_slot_t & slot = intern.background_slot_list[ oldest ];
+    slot.x = x;
+    slot.y = y;
+    slot.version = intern.level_version;
+    slot.used = frame;
+
+    draw_background_tile( oldest, x, y );
+    return oldest;
+}
+
+/// composites the visible tiles in one draw, false when the cache cannot
+/// cover the view and the level has to be drawn directly
+static int submit_cached_level()
+{
+    if ( intern.background_state == 0 ) {
+        intern.background_state = init_background();
+    }
+    if ( intern.background_state < 0 ) return 0;
+
+    const int size = k_background_tile_size;
+    rect_t v = intern.view;
+
+    int x0 = (int) floorf( v.x / size );
+    int y0 = (int) floorf( v.y / size );
+    int x1 = (int) floorf( ( v.x + v.w ) / size );
+    int y1 = (int) floorf( ( v.y + v.h ) / size );
+
+    int tile_count = ( x1 - x0 + 1 ) * ( y1 - y0 + 1 );
+    if ( tile_count > k_background_slot_count ) return 0;
+
+    intern.background_frame++;
+    reserve_batch( tile_count * 6 );
+
+    float * pos = intern.batch_pos_data;
+    float * uv = intern.batch_uv_data;
+    float * color = intern.batch_color_data;
+
+    for ( int y = y0; y <= y1; y++ ) {
+        for ( int x = x0; x <= x1; x++ ) {
+            int slot = find_background_slot( x, y );
+
+            rect_t tile;
+            tile.x = x * size;
+            tile.y = y * size;
+            tile.w = size;
+            tile.h = size;
+            tile.vertices_2d( pos );
+            affine_apply( intern.proj, pos, pos, 6 );
+
+            // the tile was drawn with y pointing down, so its top is the
+            // upper texel row of the slot
+            int px;
+            int py;
+            slot_origin( slot, &px, &py );
+
+            rect_t uv_rect;
+            uv_rect.x = (float) px / k_background_size;
+            uv_rect.y = (float) ( py + size ) / k_background_size;
+            uv_rect.w = (float) size / k_background_size;
+            uv_rect.h = -(float) size / k_background_size;
+            uv_rect.vertices_2d( uv );
+
+            fill_color( color, 6, color_white, 1.0f );
+
+            pos += 12;
+            uv += 12;
+            color += 24;
+        }
+    }
+
+    // misses went into the cache, the world target is bound again for the
+    // composite
+    if ( intern.background_bound ) {
+        glDisable( GL_SCISSOR_TEST );
+        intern.world_fb.bind();
+        glViewport( 0, 0, intern.target_width, intern.target_height );
+        intern.background_bound = 0;
+    }
+
+    int vertex_count = tile_count * 6;
+    intern.batch_pos_buffer.set( intern.batch_pos_data, vertex_count );
+    intern.batch_uv_buffer.set( intern.batch_uv_data, vertex_count );
+    intern.batch_color_buffer.set( intern.batch_color_data, vertex_count );
+
+    glUseProgram( intern.shader3.id );
+    glBindTexture( GL_TEXTURE_2D, intern.background_fb.texture );
+    set_uniform( intern.shader3.proj, k_clip_proj );
+    set_uniform( intern.shader3.texture, 0 );
+    intern.batch_pos_buffer.enable( intern.shader3.pos );
+    intern.batch_uv_buffer.enable( intern.shader3.uv );
+    intern.batch_color_buffer.enable( intern.shader3.color );
+
+    draw_arrays( GL_TRIANGLES, 0, vertex_count );
+    return 1;
+}
+
+#endif
+
+static void submit_level( const render_cmd_t & cmd )
+{
+    if ( intern.level_version != cmd.level.version ) {
+        build_level_geometry( cmd );
+    }
+
+#if BACKGROUND_CACHE
+    if ( submit_cached_level() ) return;
+#endif
+
+    draw_level_geometry( intern.proj );
+}
+
+/// shapes and rects, transformed on the cpu straight into clip space as
+/// one vertex batch
+static void
+submit_solid( const render_cmd_buffer_t * buffer, int first, int last )
+{
+    int vertex_count = 0;
+    for ( int i = first; i < last; i++ ) {
+        vertex_count += solid_vertex_count( buffer->sorted( i ) );
+    }
+
+    reserve_batch( vertex_count );
+
+    float * pos = intern.batch_pos_data;
+    float * color = intern.batch_color_data;
+
+    for ( int i = first; i < last; i++ ) {
+        const render_cmd_t & cmd = buffer->sorted( i );
+
+        int count = solid_vertices( cmd, intern.proj, pos );
+        if ( cmd.type == CMD_SHAPE ) {
+            fill_color( color, count, cmd.shape.color, cmd.shape.alpha );
+        } else {
+            fill_color( color, count, cmd.rect.color, cmd.rect.alpha );
+        }
+        pos += count * 2;
+        color += count * 4;
+    }
+
+    intern.batch_pos_buffer.set( intern.batch_pos_data, vertex_count );
+    intern.batch_color_buffer.set( intern.batch_color_data, vertex_count );
+
+    glUseProgram( intern.shader1.id );
+    set_uniform( intern.shader1.proj, k_clip_proj );
+    intern.batch_pos_buffer.enable( intern.shader1.pos );
+    intern.batch_color_buffer.enable( intern.shader1.color );
+
+    draw_arrays( GL_TRIANGLES, 0, vertex_count );
+}
+
+/// circles, n-gons and rings as one batch with a quad each, shader5 cuts
+/// the shape out of the quad with its distance function
+static void
+submit_polygons( const render_cmd_buffer_t * buffer, int first, int last )
+{
+    int vertex_count = ( last - first ) * k_polygon_quad_vertex_count;
+    reserve_batch( vertex_count );
+
+    // one target pixel in layer units, the camera does not rotate
+    float pixel = 2.0f / ( fabsf( intern.proj.a ) * intern.target_width );
+
+    float * pos = intern.batch_pos_data;
+    float * local = intern.batch_uv_data;
+    float * shape = intern.batch_shape_data;
+    float * color = intern.batch_color_data;
+
+    for ( int i = first; i < last; i++ ) {
+        const render_cmd_t & cmd = buffer->sorted( i );
+
+        polygon_quad( cmd, intern.proj, pixel, pos, local, shape );
+        fill_color(
+            color,
+            k_polygon_quad_vertex_count,
+            cmd.polygon.color,
+            cmd.polygon.alpha
         );
+
+        pos += k_polygon_quad_vertex_count * 2;
+        local += k_polygon_quad_vertex_count * 2;
+        shape += k_polygon_quad_vertex_count * 3;
+        color += k_polygon_quad_vertex_count * 4;
     }
-    if ( state.scene == SCENE_LOSE ) {
-        setup_ui_camera();
-        text_settings_t settings;
-        settings.align_x = ALIGN_CENTER;
-        settings.align_y = ALIGN_CENTER;
-        settings.scale = 5.0f;
-        render_text(
-            hardware_width() / 2,
-            hardware_height() / 2,
-            "LOSE",
-            settings
+
+    intern.batch_pos_buffer.set( intern.batch_pos_data, vertex_count );
+    intern.batch_uv_buffer.set( intern.batch_uv_data, vertex_count );
+    intern.batch_shape_buffer.set( intern.batch_shape_data, vertex_count );
+    intern.batch_color_buffer.set( intern.batch_color_data, vertex_count );
+
+    glUseProgram( intern.shader5.id );
+    set_uniform( intern.shader5.proj, k_clip_proj );
+    intern.batch_pos_buffer.enable( intern.shader5.pos );
+    intern.batch_uv_buffer.enable( intern.shader5.local );
+    intern.batch_shape_buffer.enable( intern.shader5.shape );
+    intern.batch_color_buffer.enable( intern.shader5.color );
+
+    draw_arrays( GL_TRIANGLES, 0, vertex_count );
+}
+
+/// glyph runs sharing a texture, as one batch of quads
+static void
+submit_text( const render_cmd_buffer_t * buffer, int first, int last )
+{
+    int vertex_count = 0;
+    for ( int i = first; i < last; i++ ) {
+        vertex_count += buffer->sorted( i ).glyphs.glyph_count * 6;
+    }
+
+    if ( vertex_count == 0 ) return;
+
+    reserve_batch( vertex_count );
+
+    float * pos = intern.batch_pos_data;
+    float * uv = intern.batch_uv_data;
+    float * color = intern.batch_color_data;
+
+    for ( int i = first; i < last; i++ ) {
+        const render_cmd_t & cmd = buffer->sorted( i );
+
+        for ( int g = 0; g < cmd.glyphs.glyph_count; g++ ) {
+            glyph_vertices( cmd, g, intern.proj, pos, uv );
+            fill_color( color, 6, cmd.glyphs.color, cmd.glyphs.alpha );
+
+            pos += 12;
+            uv += 12;
+            color += 24;
+        }
+    }
+
+    intern.batch_pos_buffer.set( intern.batch_pos_data, vertex_count );
+    intern.batch_uv_buffer.set( intern.batch_uv_data, vertex_count );
+    intern.batch_color_buffer.set( intern.batch_color_data, vertex_count );
+
+    glUseProgram( intern.shader3.id );
+    glBindTexture( GL_TEXTURE_2D, buffer->sorted( first ).glyphs.texture );
+    set_uniform( intern.shader3.proj, k_clip_proj );
+    set_uniform( intern.shader3.texture, 0 );
+    intern.batch_pos_buffer.enable( intern.shader3.pos );
+    intern.batch_uv_buffer.enable( intern.shader3.uv );
+    intern.batch_color_buffer.enable( intern.shader3.color );
+
+    draw_arrays( GL_TRIANGLES, 0, vertex_count );
+}
+
+/// grows the template and the per vertex end points to fit count bullets
+static void reserve_line_bullets( int count )
+{
+    if ( count <= intern.line_bullet_cap ) return;
+
+    int cap = intern.line_bullet_cap ? intern.line_bullet_cap : 64;
+    while ( cap < count ) {
+        cap *= 2;
+    }
+
+    float * corner_data = new float[ cap * k_line_bullet_vertex_count * 3 ];
+    for ( int i = 0; i < cap; i++ ) {
+        memcpy(
+            corner_data + i * k_line_bullet_vertex_count * 3,
+            k_line_bullet_corner_list,
+            sizeof( k_line_bullet_corner_list )
         );
+    }
+    intern.line_bullet_corner_buffer.set(
+        corner_data,
+        cap * k_line_bullet_vertex_count
+    );
+    delete[] corner_data;
+
+    delete[] intern.line_bullet_end_data;
+    intern.line_bullet_end_data =
+        new float[ cap * k_line_bullet_vertex_count * 4 ];
+    intern.line_bullet_cap = cap;
+}
+
+/// all line bullets of the command in one upload and one draw, the capsules
+/// are expanded from the template in shader4
+static void submit_line_bullets( const render_cmd_t & cmd )
+{
+    int count = cmd.line_bullets.count;
+    reserve_line_bullets( count );
+
+    float * out = intern.line_bullet_end_data;
+    for ( int i = 0; i < count; i++ ) {
+        const float * ends = cmd.line_bullets.end_list + i * 4;
+        for ( int v = 0; v < k_line_bullet_vertex_count; v++ ) {
+            memcpy( out, ends, sizeof( float ) * 4 );
+            out += 4;
+        }
+    }
+
+    vec4 color4;
+    color4[ 0 ] = cmd.line_bullets.color.r;
+    color4[ 1 ] = cmd.line_bullets.color.g;
+    color4[ 2 ] = cmd.line_bullets.color.b;
+    color4[ 3 ] = 1.0f;
+
+    intern.line_bullet_end_buffer.set(
+        intern.line_bullet_end_data,
+        count * k_line_bullet_vertex_count
+    );
+
+    float proj[ 4 ];
+    affine_uniform( intern.proj, proj );
+
+    glUseProgram( intern.shader4.id );
+    set_uniform( intern.shader4.proj, proj );
+    set_uniform( intern.shader4.color, color4 );
+    set_uniform( intern.shader4.width, cmd.line_bullets.width );
+    intern.line_bullet_corner_buffer.enable( intern.shader4.corner );
+    intern.line_bullet_end_buffer.enable( intern.shader4.ends );
+
+    draw_arrays( GL_TRIANGLES, 0, count * k_line_bullet_vertex_count );
+}
+
+static int can_merge( const render_cmd_buffer_t * buffer, int a, int b )
+{
+    int material = buffer->sorted_material( a );
+    if ( material != buffer->sorted_material( b ) ) return 0;
 
-        settings.align_y = ALIGN_RIGHT;
-        settings.scale = 2.0f;
-        render_text(
-            hardware_width() / 2,
-            hardware_height() - 10.0f,
-            "a stupid game by meowstr <3",
-            settings
+    if ( material == MATERIAL_SOLID || material == MATERIAL_POLYGON ) {
+        return 1;
+    }
+
+    if ( material == MATERIAL_TEXT ) {
+        return buffer->sorted( a ).glyphs.texture ==
+               buffer->sorted( b ).glyphs.texture;
+    }
+
+    return 0;
+}
+
+/// executes sorted commands [first, last), merging runs of one material
+static void
+submit_range( const render_cmd_buffer_t * buffer, int first, int last )
+{
+    int i = first;
+    while ( i < last ) {
+        int end = i + 1;
+        while ( end < last && can_merge( buffer, i, end ) ) {
+            end++;
+        }
+
+        const render_cmd_t & cmd = buffer->sorted( i );
+
+        switch ( buffer->sorted_material( i ) ) {
+        case MATERIAL_NONE:
+            submit_camera( cmd );
+            break;
+        case MATERIAL_LEVEL:
+            submit_level( cmd );
+            break;
+        case MATERIAL_POLYGON:
+            submit_polygons( buffer, i, end );
+            break;
+        case MATERIAL_SOLID:
+            submit_solid( buffer, i, end );
+            break;
+        case MATERIAL_TEXT:
+            submit_text( buffer, i, end );
+            break;
+        case MATERIAL_LINE_BULLET:
+            submit_line_bullets( cmd );
+            break;
+        }
+
+        i = end;
+    }
+}
+
+/// the part of the world target a frame at world_scale renders to
+static void world_target_size( float world_scale, int * width, int * height )
+{
+    *width = roundf( hardware_width() * world_scale );
+    *height = roundf( hardware_height() * world_scale );
+}
+
+static void begin_world_target( float world_scale )
+{
+    int width;
+    int height;
+    world_target_size( world_scale, &width, &height );
+
+    // the window grew past the target, it grows along with it
+    framebuffer_t & fb = intern.world_fb;
+    if ( width > fb.width || height > fb.height ) {
+        fb.resize(
+            width > fb.width ? width : fb.width,
+            height > fb.height ? height : fb.height
         );
     }
+
+    intern.world_fb.bind();
+    glViewport( 0, 0, width, height );
+    intern.target_width = width;
+    intern.target_height = height;
+    glClear( GL_COLOR_BUFFER_BIT );
+}
+
+/// stretches the rendered part of the world target over the window, with the
+/// chromatic split scaled by effect_amount
+static void end_world_target( float world_scale, float effect_amount )
+{
+    int width;
+    int height;
+    world_target_size( world_scale, &width, &height );
+
+    intern.world_fb.unbind();
+    glViewport( 0, 0, hardware_width(), hardware_height() );
+    intern.target_width = hardware_width();
+    intern.target_height = hardware_height();
+
+    rect_t uv_rect;
+    uv_rect.x = 0.0f;
+    uv_rect.y = 0.0f;
+    // against the allocated size, which is not the window's once it changed
+    uv_rect.w = (float) width / intern.world_fb.width;
+    uv_rect.h = (float) height / intern.world_fb.height;
+
+    float uv_data[ 12 ];
+    uv_rect.vertices_2d( uv_data );
+    intern.fb_uv_buffer.set( uv_data, 6 );
+
+    glUseProgram( intern.shader2.id );
+    glBindTexture( GL_TEXTURE_2D, intern.world_fb.texture );
+    set_uniform( intern.shader2.texture, 0 );
+    set_uniform( intern.shader2.amount, effect_amount );
+    intern.fb_pos_buffer.enable( intern.shader2.pos );
+    intern.fb_uv_buffer.enable( intern.shader2.uv );
+
+    draw_arrays( GL_TRIANGLES, 0, intern.fb_pos_buffer.element_count );
+}
+
+/// sorts the buffer and turns it into gl calls, layer by layer
+static void render_submit( render_cmd_buffer_t * buffer )
+{
+    intern.gpu_timer.begin();
+    intern.draw_count = 0;
+
+    glClearColor( 0.0f, 0.0f, 0.0f, 1.0f );
+    glClear( GL_COLOR_BUFFER_BIT );
+    intern.target_width = hardware_width();
+    intern.target_height = hardware_height();
+
+    buffer->sort();
+
+    int i = 0;
+    while ( i < buffer->cmd_count ) {
+        int layer = buffer->sorted_layer( i );
+
+        int end = i + 1;
+        while ( end < buffer->cmd_count &&
+                buffer->sorted_layer( end ) == layer ) {
+            end++;
+        }
+
+        if ( layer == LAYER_WORLD ) {
+            begin_world_target( buffer->world_scale );
+            submit_range( buffer, i, end );
+            end_world_target( buffer->world_scale, buffer->effect_amount );
+        } else {
+            submit_range( buffer, i, end );
+        }
+
+        i = end;
+    }
+
+    intern.gpu_timer.end();
+}
+
+/// submits and presents a built buffer, on whichever thread owns the context
+static void
+render_present( render_cmd_buffer_t * buffer, submit_result_t * out )
+{
+    out->gpu_time = intern.gpu_timer.poll();
+
+    double start = profiler_clock();
+    render_submit( buffer );
+    double submitted = profiler_clock();
+    hardware_swap();
+    double swapped = profiler_clock();
+
+    out->submit_time = submitted - start;
+    out->swap_time = swapped - submitted;
+    out->present_time = swapped;
+    out->draw_count = intern.draw_count;
+}
+
+static void record_submit( const submit_result_t & result )
+{
+    profiler_record( PROFILE_SUBMIT, result.submit_time );
+    profiler_record( PROFILE_SWAP, result.swap_time );
+    if ( result.gpu_time >= 0.0f ) {
+        profiler_record( PROFILE_GPU, result.gpu_time );
+        intern.gpu_time = result.gpu_time;
+    }
+
+    intern.stats.draw_count = result.draw_count;
+    if ( intern.stats.first_present == 0.0 ) {
+        intern.stats.first_present = result.present_time;
+    }
+}
+
+#if RENDER_THREAD
+
+static void render_thread_main()
+{
+    hardware_make_current( 1 );
+
+    std::unique_lock< std::mutex > lock( intern.thread.mutex );
+
+    for ( ;; ) {
+        intern.thread.cond.wait( lock, [] {
+            return intern.thread.pending != -1 || intern.thread.quit;
+        } );
+
+        // a pending frame is still presented after quit
+        if ( intern.thread.pending == -1 ) break;
+
+        int slot = intern.thread.pending;
+        intern.thread.pending = -1;
+        intern.thread.rendering = slot;
+        intern.thread.cond.notify_all();
+        lock.unlock();
+
+        submit_result_t result;
+        render_present( &intern.cmd_buffer_list[ slot ], &result );
+
+        lock.lock();
+        intern.thread.rendering = -1;
+        intern.thread.result = result;
+        intern.thread.has_result = 1;
+    }
+
+    lock.unlock();
+    hardware_make_current( 0 );
+}
+
+#endif
+
+void render_init()
+{
+    float fb_pos_data[ 12 ];
+    rect_t{ -1.0f, -1.0f, 2.0f, 2.0f }.vertices_2d( fb_pos_data );
+
+    float fb_uv_data[ 12 ];
+    rect_t{ 0.0f, 0.0f, 1.0f, 1.0f }.vertices_2d( fb_uv_data );
+
+    // init vertex buffers
+
+    intern.batch_pos_buffer.init( 2 );
+    intern.batch_uv_buffer.init( 2 );
+    intern.batch_color_buffer.init( 4 );
+    intern.batch_shape_buffer.init( 3 );
+    intern.batch_pos_data = nullptr;
+    intern.batch_uv_data = nullptr;
+    intern.batch_color_data = nullptr;
+    intern.batch_shape_data = nullptr;
+    intern.batch_cap = 0;
+
+    intern.line_bullet_corner_buffer.init( 3 );
+    intern.line_bullet_end_buffer.init( 4 );
+    intern.line_bullet_end_data = nullptr;
+    intern.line_bullet_cap = 0;
+
+    intern.level_pos_buffer.init( 2 );
+    intern.level_color_buffer.init( 4 );
+    intern.level_version = -1;
+
+    intern.fb_pos_buffer.init( 2 );
+    intern.fb_pos_buffer.set( fb_pos_data, 6, 1 );
+
+    intern.fb_uv_buffer.init( 2 );
+    intern.fb_uv_buffer.set( fb_uv_data, 6 );
+
+    // init shaders
+
+    shader_cache_init( "shaders.cache" );
+    init_shader1();
+    init_shader2();
+    init_shader3();
+    init_shader4();
+    init_shader5();
+    shader_cache_flush();
+
+    // init textures
+
+    intern.atlas_texture = upload_texture( load_image( "atlas.tex" ).get() );
+
+    // init font
+
+    intern.font.init( find_res( "bit.bfnt" ) );
+    intern.font.place_in_atlas( find_atlas_region( "bit.png" ) );
+
+    // init retained text, laid out on first use
+
+    intern.ui.bullet_count = -1;
+
+    // init command buffer
+
+    intern.cmd_buffer_list[ 0 ].init( k_cmd_arena_size, k_cmd_cap );
+    intern.cmd_buffer_list[ 1 ].init( k_cmd_arena_size, k_cmd_cap );
+
+    // init offscreen world target
+
+    intern.world_fb.init( hardware_width(), hardware_height() );
+    intern.world_scale = 1.0f;
+    intern.last_frame_time = hardware_time();
+    intern.gpu_time = -1.0f;
+    intern.load_avg = 0.0f;
+    intern.fast_frame_count = 0;
+
+    // init profiler
+
+    intern.gpu_timer.init();
+
+    // init gl state
+
+    glEnable( GL_BLEND );
+    glBlendFunc( GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA ); // blend alpha
+
+#if RENDER_THREAD
+    // from here on only the render thread touches gl
+    intern.thread.pending = -1;
+    intern.thread.rendering = -1;
+    intern.thread.has_result = 0;
+    intern.thread.quit = 0;
+
+    hardware_make_current( 0 );
+    intern.thread.thread = std::thread( render_thread_main );
+#endif
+}
+
+void render_destroy()
+{
+#if RENDER_THREAD
+    {
+        std::lock_guard< std::mutex > lock( intern.thread.mutex );
+        intern.thread.quit = 1;
+    }
+    intern.thread.cond.notify_all();
+    intern.thread.thread.join();
+
+    hardware_make_current( 1 );
+#endif
+}
+
+void trigger_camera_shake()
+{
+    intern.shake_timer = k_shake_time;
+}
+
+const render_stats_t & render_stats()
+{
+    return intern.stats;
+}
+
+#if RENDER_THREAD
+
+/// builds frame N + 1 while the render thread presents frame N. waiting for
+/// the previous frame to be picked up first keeps the simulation at most one
+/// frame ahead of the screen
+void render()
+{
+    int slot;
+
+    {
+        std::unique_lock< std::mutex > lock( intern.thread.mutex );
+        intern.thread.cond.wait( lock, [] {
+            return intern.thread.pending == -1;
+        } );
+
+        // timings arrive a frame late
+        if ( intern.thread.has_result ) {
+            record_submit( intern.thread.result );
+            intern.thread.has_result = 0;
+        }
+
+        slot = intern.thread.rendering == 0 ? 1 : 0;
+    }
+
+    render_cmd_buffer_t * buffer = &intern.cmd_buffer_list[ slot ];
+    buffer->reset();
+    render_build( buffer );
+
+    {
+        std::lock_guard< std::mutex > lock( intern.thread.mutex );
+        intern.thread.pending = slot;
+    }
+    intern.thread.cond.notify_all();
+}
+
+#else
+
+void render()
+{
+    render_cmd_buffer_t * buffer = &intern.cmd_buffer_list[ 0 ];
+
+    buffer->reset();
+    render_build( buffer );
+
+    submit_result_t result;
+    render_present( buffer, &result );
+    record_submit( result );
+}
+
+#endif
+
+render_cmd_buffer_t * render_record()
+{
+    render_cmd_buffer_t * buffer = &intern.record_buffer;
+    if ( !buffer->cmd_list ) buffer->init( k_cmd_arena_size, k_cmd_cap );
+
+    buffer->reset();
+    render_build( buffer );
+    return buffer;
 }
@@ -1,7 +1,31 @@
 #pragma once
 
+struct render_cmd_buffer_t;
+
+struct render_stats_t {
+    int drawn_count;   // world entities drawn last frame
+    int culled_count;  // world entities outside the view last frame
+    float world_scale; // offscreen world resolution relative to the window
+    int cmd_count;     // render commands recorded last frame
+    int draw_count;    // gl draw calls issued last frame
+    int layout_count;  // text runs laid out last frame, retained ones skip it
+
+    // profiler_clock() when the first frame was swapped, 0 until its timings
+    // came back
+    double first_present;
+};
+
 void render_init();
 
+/// stops the render thread and hands the gl context back to the caller
+void render_destroy();
+
 void render();
 
+/// builds the frame without submitting it, for drawing it some other way.
+/// the buffer is reused by the next call
+render_cmd_buffer_t * render_record();
+
 void trigger_camera_shake();
+
+const render_stats_t & render_stats();
@@ -0,0 +1,344 @@
+#include "render_cmd.hpp"
+
+#include "logging.hpp"
+
+#include <algorithm>
+#include <math.h>
+#include <string.h>
+
+void render_cmd_buffer_t::init( int arena_size, int new_cmd_cap )
+{
+    arena.init( arena_size );
+    cmd_cap = new_cmd_cap;
+    reset();
+}
+
+void render_cmd_buffer_t::reset()
+{
+    arena.reset();
+    cmd_list = arena.alloc_list< render_cmd_t >( cmd_cap );
+    key_list = arena.alloc_list< uint64_t >( cmd_cap );
+    cmd_count = 0;
+    overflow = 0;
+
+    world_scale = 1.0f;
+    effect_amount = 0.0f;
+}
+
+render_cmd_t *
+render_cmd_buffer_t::push( int layer, int depth, int material, int type )
+{
+    if ( cmd_count >= cmd_cap ) {
+        if ( !overflow ) {
+            ERROR_LOG( "render command buffer full (%d)", cmd_cap );
+        }
+        overflow = 1;
+        return nullptr;
+    }
+
+    int i = cmd_count;
+    cmd_count++;
+
+    key_list[ i ] = ( (uint64_t) layer << 56 ) |
+                    ( (uint64_t) ( depth & 0xffff ) << 40 ) |
+                    ( (uint64_t) ( material & 0xff ) << 32 ) | (uint64_t) i;
+
+    cmd_list[ i ].type = type;
+    return cmd_list + i;
+}
+
+void render_cmd_buffer_t::sort()
+{
+    // the index in the low bits keeps equal keys in submission order
+    std::sort( key_list, key_list + cmd_count );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// command geometry
+////////////////////////////////////////////////////////////////////////////////
+
+// two quads, as triangles
+static float hammer_vertex_list[ 24 ] = {
+    -2.0f, -2.0f, 30.0f, -2.0f, 30.0f, 2.0f,
+    -2.0f, -2.0f, 30.0f, 2.0f,  -2.0f, 2.0f,
+    30.0f, -10.0f, 44.0f, -10.0f, 44.0f, 10.0f,
+    30.0f, -10.0f, 44.0f, 10.0f,  30.0f, 10.0f,
+};
+
+static const mesh_data_t mesh_list[ MESH_COUNT ] = {
+    { hammer_vertex_list, 12 },
+};
+
+const mesh_data_t & find_mesh( int mesh )
+{
+    return mesh_list[ mesh ];
+}
+
+static rect_t round_rect( rect_t r )
+{
+    r.x = roundf( r.x );
+    r.y = roundf( r.y );
+    r.w = roundf( r.w );
+    r.h = roundf( r.h );
+    return r;
+}
+
+int solid_vertex_count( const render_cmd_t & cmd )
+{
+    if ( cmd.type == CMD_SHAPE ) {
+        return find_mesh( cmd.shape.mesh ).vertex_count;
+    }
+    return 6;
+}
+
+int solid_vertices(
+    const render_cmd_t & cmd,
+    const affine_t & view,
+    float * out_pos
+)
+{
+    if ( cmd.type != CMD_SHAPE ) {
+        round_rect( cmd.rect.rect ).vertices_2d( out_pos );
+        affine_apply( view, out_pos, out_pos, 6 );
+        return 6;
+    }
+
+    const mesh_data_t & mesh = find_mesh( cmd.shape.mesh );
+    affine_t model = affine_trs(
+        cmd.shape.x,
+        cmd.shape.y,
+        cmd.shape.rotation,
+        cmd.shape.scale
+    );
+
+    affine_apply(
+        affine_mul( view, model ),
+        mesh.vertex_list,
+        out_pos,
+        mesh.vertex_count
+    );
+
+    return mesh.vertex_count;
+}
+
+void glyph_vertices(
+    const render_cmd_t & cmd,
+    int glyph,
+    const affine_t & view,
+    float * out_pos,
+    float * out_uv
+)
+{
+    const glyph_t & g = cmd.glyphs.glyph_list[ glyph ];
+    float scale = cmd.glyphs.scale;
+
+    rect_t r;
+    r.x = cmd.glyphs.x + roundf( g.x ) * scale;
+    r.y = cmd.glyphs.y + roundf( g.y ) * scale;
+    r.w = roundf( g.w ) * scale;
+    r.h = roundf( g.h ) * scale;
+    r.vertices_2d( out_pos );
+    affine_apply( view, out_pos, out_pos, 6 );
+
+    rect_t uv_rect;
+    uv_rect.x = g.u1;
+    uv_rect.y = g.v1;
+    uv_rect.w = g.u2 - g.u1;
+    uv_rect.h = g.v2 - g.v1;
+    uv_rect.vertices_2d( out_uv );
+}
+
+int level_vertex_count( const render_cmd_t & cmd )
+{
+    return ( cmd.level.room_count * 2 + 1 ) * 6;
+}
+
+static void
+level_quad( rect_t r, color_t color, float ** pos, float ** out_color )
+{
+    round_rect( r ).vertices_2d( *pos );
+
+    for ( int i = 0; i < 6; i++ ) {
+        ( *out_color )[ i * 4 + 0 ] = color.r;
+        ( *out_color )[ i * 4 + 1 ] = color.g;
+        ( *out_color )[ i * 4 + 2 ] = color.b;
+        ( *out_color )[ i * 4 + 3 ] = 1.0f;
+    }
+
+    *pos += 12;
+    *out_color += 24;
+}
+
+void level_vertices(
+    const render_cmd_t & cmd,
+    float * out_pos,
+    float * out_color
+)
+{
+    int room_count = cmd.level.room_count;
+
+    for ( int i = 0; i < room_count; i++ ) {
+        rect_t r = cmd.level.room_list[ i ];
+        r.margin( -10 );
+        level_quad( r, color_white, &out_pos, &out_color );
+    }
+
+    for ( int i = 0; i < room_count; i++ ) {
+        rect_t r = cmd.level.room_list[ i ];
+        r.margin( -5 );
+        level_quad( r, color_gray, &out_pos, &out_color );
+    }
+
+    rect_t exit_rect;
+    exit_rect.x = cmd.level.exit_x;
+    exit_rect.y = cmd.level.exit_y;
+    exit_rect.w = 50.0f;
+    exit_rect.h = 50.0f;
+    exit_rect.centerize();
+    level_quad( exit_rect, color_black, &out_pos, &out_color );
+}
+
+void polygon_quad(
+    const render_cmd_t & cmd,
+    const affine_t & view,
+    float pixel,
+    float * out_pos,
+    float * out_local,
+    float * out_shape
+)
+{
+    float radius = cmd.polygon.radius;
+    float pad = radius > 0.0f ? pixel / radius : 0.0f;
+
+    rect_t local;
+    local.x = -1.0f - pad;
+    local.y = -1.0f - pad;
+    local.w = 2.0f + pad * 2.0f;
+    local.h = 2.0f + pad * 2.0f;
+    local.vertices_2d( out_local );
+
+    affine_t model = affine_trs(
+        cmd.polygon.x,
+        cmd.polygon.y,
+        cmd.polygon.rotation,
+        radius
+    );
+    affine_apply(
+        affine_mul( view, model ),
+        out_local,
+        out_pos,
+        k_polygon_quad_vertex_count
+    );
+
+    // fewer than 3 sides makes a circle, as in polygon_vertices()
+    float sides = cmd.polygon.sides >= 3 ? cmd.polygon.sides : 0.0f;
+
+    for ( int i = 0; i < k_polygon_quad_vertex_count; i++ ) {
+        out_shape[ i * 3 + 0 ] = sides;
+        out_shape[ i * 3 + 1 ] = cmd.polygon.ring;
+        out_shape[ i * 3 + 2 ] = pad;
+    }
+}
+
+static int polygon_sides( const render_cmd_t & cmd )
+{
+    int sides = cmd.polygon.sides;
+    return sides < 3 || sides > k_circle_sides ? k_circle_sides : sides;
+}
+
+int polygon_vertex_count( const render_cmd_t & cmd )
+{
+    int sides = polygon_sides( cmd );
+    return cmd.polygon.ring > 0.0f ? sides * 6 : sides * 3;
+}
+
+int polygon_vertices(
+    const render_cmd_t & cmd,
+    const affine_t & view,
+    float * out_pos
+)
+{
+    int sides = polygon_sides( cmd );
+
+    // center, then the corners with the first repeated
+    float fan[ ( k_circle_sides + 2 ) * 2 ];
+    ngon_vertices( fan, sides );
+
+    const float * corner = fan + 2;
+    float inner = 1.0f - cmd.polygon.ring;
+    float * out = out_pos;
+
+    for ( int i = 0; i < sides; i++ ) {
+        const float * a = corner + i * 2;
+        const float * b = corner + i * 2 + 2;
+
+        if ( cmd.polygon.ring <= 0.0f ) {
+            float tri[ 6 ] = { 0.0f, 0.0f, a[ 0 ], a[ 1 ], b[ 0 ], b[ 1 ] };
+            memcpy( out, tri, sizeof( tri ) );
+            out += 6;
+            continue;
+        }
+
+        float quad[ 12 ] = {
+            a[ 0 ] * inner, a[ 1 ] * inner, a[ 0 ], a[ 1 ], b[ 0 ], b[ 1 ],
+            a[ 0 ] * inner, a[ 1 ] * inner, b[ 0 ], b[ 1 ],
+            b[ 0 ] * inner, b[ 1 ] * inner,
+        };
+        memcpy( out, quad, sizeof( quad ) );
+        out += 12;
+    }
+
+    affine_t model = affine_trs(
+        cmd.polygon.x,
+        cmd.polygon.y,
+        cmd.polygon.rotation,
+        cmd.polygon.radius
+    );
+
+    int count = ( out - out_pos ) / 2;
+    affine_apply( affine_mul( view, model ), out_pos, out_pos, count );
+    return count;
+}
+
+const float k_line_bullet_corner_list[ k_line_bullet_vertex_count * 3 ] = {
+    // back, bottom left, bottom right
+    0.0f, -1.0f, 0.0f,
+    0.0f, 0.0f, -1.0f,
+    1.0f, 0.0f, -1.0f,
+    // back, bottom right, tip
+    0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, -1.0f,
+    1.0f, 1.0f, 0.0f,
+    // back, tip, top right
+    0.0f, -1.0f, 0.0f,
+    1.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 1.0f,
+    // back, top right, top left
+    0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 1.0f,
+    0.0f, 0.0f, 1.0f,
+};
+
+void line_bullet_vertices( const render_cmd_t & cmd, int i, float * out_pos )
+{
+    const float * ends = cmd.line_bullets.end_list + i * 4;
+    float width = cmd.line_bullets.width;
+
+    float dx = ends[ 2 ] - ends[ 0 ];
+    float dy = ends[ 3 ] - ends[ 1 ];
+    float len = sqrtf( dx * dx + dy * dy );
+    float dir_x = len > 0.0f ? dx / len : 1.0f;
+    float dir_y = len > 0.0f ? dy / len : 0.0f;
+    float normal_x = -dir_y;
+    float normal_y = dir_x;
+
+    for ( int v = 0; v < k_line_bullet_vertex_count; v++ ) {
+        const float * corner = k_line_bullet_corner_list + v * 3;
+        float x = ends[ 0 ] + dx * corner[ 0 ];
+        float y = ends[ 1 ] + dy * corner[ 0 ];
+        x += ( dir_x * corner[ 1 ] + normal_x * corner[ 2 ] ) * width;
+        y += ( dir_y * corner[ 1 ] + normal_y * corner[ 2 ] ) * width;
+        out_pos[ v * 2 + 0 ] = x;
+        out_pos[ v * 2 + 1 ] = y;
+    }
+}
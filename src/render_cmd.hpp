@@ -0,0 +1,228 @@
+#pragma once
+
+#include "affine.hpp"
+#include "arena.hpp"
+#include "color.hpp"
+#include "font.hpp"
+#include "shape.hpp"
+
+#include <cglm/types.h>
+#include <stdint.h>
+
+/// layers are submitted in order, each starts with a camera command
+enum render_layer_t {
+    LAYER_WORLD, // offscreen at the dynamic resolution
+    LAYER_UI,
+    LAYER_OVERLAY, // profiler
+    LAYER_COUNT,
+};
+
+/// what a command is drawn with, neighbouring commands (after sorting) with
+/// the same material are merged into one draw
+enum render_material_t {
+    MATERIAL_NONE, // cameras
+    MATERIAL_LEVEL,
+    MATERIAL_POLYGON, // sdf circles, n-gons and rings
+    MATERIAL_SOLID,   // shapes and rects
+    MATERIAL_TEXT,
+    MATERIAL_LINE_BULLET,
+};
+
+enum render_cmd_type_t {
+    CMD_CAMERA,
+    CMD_LEVEL,
+    CMD_SHAPE,
+    CMD_POLYGON,
+    CMD_RECT,
+    CMD_GLYPHS,
+    CMD_LINE_BULLETS,
+};
+
+/// shapes that are not regular polygons
+enum mesh_t {
+    MESH_HAMMER,
+    MESH_COUNT,
+};
+
+/// everything a command points to lives in the arena of its buffer, so a
+/// filled buffer does not depend on state
+struct render_cmd_t {
+    int type;
+
+    union {
+        struct {
+            rect_t view; // visible rect in layer space
+        } camera;
+
+        struct {
+            int version;
+            const rect_t * room_list;
+            int room_count;
+            float exit_x;
+            float exit_y;
+        } level;
+
+        struct {
+            int mesh;
+            float x;
+            float y;
+            float scale;
+            float rotation;
+            color_t color;
+            float alpha;
+        } shape;
+
+        struct {
+            float x;
+            float y;
+            float radius; // to the corners
+            float rotation;
+            int sides;  // 0 for a circle
+            float ring; // outline width in radius units, 0 fills
+            color_t color;
+            float alpha;
+        } polygon;
+
+        struct {
+            rect_t rect;
+            color_t color;
+            float alpha;
+        } rect;
+
+        struct {
+            const glyph_t * glyph_list;
+            int glyph_count;
+            int texture;
+            float x;
+            float y;
+            float scale;
+            color_t color;
+            float alpha;
+        } glyphs;
+
+        struct {
+            const float * end_list; // x1, y1, x2, y2 per bullet
+            int count;
+            float width;
+            color_t color;
+        } line_bullets;
+    };
+};
+
+struct render_cmd_buffer_t {
+    arena_t arena;
+
+    render_cmd_t * cmd_list;
+    uint64_t * key_list; // layer, depth, material, then the command index
+    int cmd_count;
+    int cmd_cap;
+    int overflow;
+
+    // frame wide settings for the submission
+    float world_scale;
+    float effect_amount;
+
+    void init( int arena_size, int new_cmd_cap );
+
+    /// drops all commands and everything allocated for them
+    void reset();
+
+    /// nullptr when the buffer is full
+    render_cmd_t * push( int layer, int depth, int material, int type );
+
+    /// orders the keys, the commands themselves stay where they are
+    void sort();
+
+    const render_cmd_t & sorted( int i ) const
+    {
+        return cmd_list[ key_list[ i ] & 0xffffffff ];
+    }
+
+    int sorted_layer( int i ) const
+    {
+        return (int) ( key_list[ i ] >> 56 );
+    }
+
+    int sorted_material( int i ) const
+    {
+        return (int) ( ( key_list[ i ] >> 32 ) & 0xff );
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// command geometry, shared by the gl and software backends
+////////////////////////////////////////////////////////////////////////////////
+
+/// triangle list in model space
+struct mesh_data_t {
+    float * vertex_list;
+    int vertex_count;
+};
+
+const mesh_data_t & find_mesh( int mesh );
+
+/// vertices solid_vertices() writes for a shape or rect command
+int solid_vertex_count( const render_cmd_t & cmd );
+
+/// triangle list, returns the vertex count. view is folded into the model
+/// transform, so the vertices come out in the space of the target
+int solid_vertices(
+    const render_cmd_t & cmd,
+    const affine_t & view,
+    float * out_pos
+);
+
+/// 6 vertices, positions through view and atlas uvs of one glyph quad
+void glyph_vertices(
+    const render_cmd_t & cmd,
+    int glyph,
+    const affine_t & view,
+    float * out_pos,
+    float * out_uv
+);
+
+int level_vertex_count( const render_cmd_t & cmd );
+
+/// room outlines, room fills and the exit, with rgba per vertex
+void level_vertices(
+    const render_cmd_t & cmd,
+    float * out_pos,
+    float * out_color
+);
+
+static const int k_polygon_quad_vertex_count = 6;
+static const int k_circle_sides = 32;
+
+/// quad covering a polygon command for the sdf shader, grown by pixel (the
+/// size of a target pixel in layer units) to leave room for the antialiased
+/// edge. out_local gets the corners in radius units, unrotated, and
+/// out_shape the sides, ring and pixel in radius units for every vertex
+void polygon_quad(
+    const render_cmd_t & cmd,
+    const affine_t & view,
+    float pixel,
+    float * out_pos,
+    float * out_local,
+    float * out_shape
+);
+
+/// vertices polygon_vertices() writes
+int polygon_vertex_count( const render_cmd_t & cmd );
+
+/// the polygon tessellated into triangles, for backends without the sdf
+/// shader. circles get k_circle_sides sides
+int polygon_vertices(
+    const render_cmd_t & cmd,
+    const affine_t & view,
+    float * out_pos
+);
+
+/// capsule around a line bullet as 4 triangles
+/// x: 0 at pos1, 1 at pos2
+/// y: offset along the line, in widths
+/// z: offset across the line, in widths
+static const int k_line_bullet_vertex_count = 12;
+extern const float k_line_bullet_corner_list[ k_line_bullet_vertex_count * 3 ];
+
+/// the capsule of one line bullet in layer space, what shader4 computes
+void line_bullet_vertices( const render_cmd_t & cmd, int i, float * out_pos );
@@ -1,5 +1,6 @@
 #include "render_utils.hpp"
 
+#include "hardware.hpp"
 #include "logging.hpp"
 #include "res.hpp"
 
@@ -9,80 +10,389 @@
 #include <glad/glad.h>
 #endif
 
-#include <sstream>
+#include <stdint.h>
+#include <stdio.h>
 #include <string.h>
-#include <string>
-#include <vector>
 
-static int match_shader_line( const char * line, const char * name )
-{
-    char buffer[ 128 ];
-    snprintf( buffer, 128, "#shader %s", name );
+static const int k_shader_source_cap = 32;
+static const int k_program_binary_cap = 16;
 
-    return strncmp( line, buffer, strlen( buffer ) ) == 0;
-}
+struct shader_source_t {
+    const char * name;
+    const char * source;
+};
+
+/// a linked program as returned by glGetProgramBinary
+struct program_binary_t {
+    uint64_t key; // hash of the sources and the driver
+    unsigned int format;
+    int size;
+    char * data;
+    int used; // loaded or stored this run, the rest is not written back
+};
+
+#ifndef __EMSCRIPTEN__
+
+#ifndef GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#endif
+#ifndef GL_PROGRAM_BINARY_LENGTH
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#endif
+#ifndef GL_NUM_PROGRAM_BINARY_FORMATS
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+#endif
+
+// GL 4.1 / ARB_get_program_binary, not part of the loaded GL 3.0 profile
+typedef void( APIENTRYP get_program_binary_proc_t )(
+    GLuint program,
+    GLsizei buf_size,
+    GLsizei * length,
+    GLenum * binary_format,
+    void * binary
+);
+typedef void( APIENTRYP program_binary_proc_t )(
+    GLuint program,
+    GLenum binary_format,
+    const void * binary,
+    GLsizei length
+);
+typedef void( APIENTRYP program_parameteri_proc_t )(
+    GLuint program,
+    GLenum pname,
+    GLint value
+);
 
-static int match_any_shader_line( const char * line )
+#endif
+
+static struct {
+    // shaders.glsl, split in place into null terminated sections
+    char * shader_text;
+    shader_source_t shader_list[ k_shader_source_cap ];
+    int shader_count;
+
+    // program binary cache
+    const char * cache_path;
+    int cache_supported;
+    int cache_dirty;
+    program_binary_t binary_list[ k_program_binary_cap ];
+    int binary_count;
+
+#ifndef __EMSCRIPTEN__
+    get_program_binary_proc_t get_program_binary;
+    program_binary_proc_t program_binary;
+    program_parameteri_proc_t program_parameteri;
+#endif
+} intern;
+
+/// every "#shader <name>" line starts a section that runs to the next one
+static void index_shaders()
 {
-    const char * buffer = "#shader";
-    return strncmp( line, buffer, strlen( buffer ) ) == 0;
+    res_t res = find_res( "shaders.glsl" );
+
+    char * text = new char[ res.size + 1 ];
+    memcpy( text, res.data, res.size );
+    text[ res.size ] = '\0';
+    intern.shader_text = text;
+    intern.shader_count = 0;
+
+    const char * tag = "#shader ";
+    int tag_len = strlen( tag );
+
+    char * line = text;
+    while ( *line ) {
+        char * eol = strchr( line, '\n' );
+        char * next = eol ? eol + 1 : line + strlen( line );
+
+        if ( strncmp( line, tag, tag_len ) == 0 ) {
+            if ( intern.shader_count >= k_shader_source_cap ) {
+                ERROR_LOG( "too many shaders (%d)", k_shader_source_cap );
+                break;
+            }
+
+            // terminates the previous section and the name
+            *line = '\0';
+            char * name_end = eol ? eol : next;
+            while ( name_end > line + tag_len &&
+                    ( name_end[ -1 ] == ' ' || name_end[ -1 ] == '\r' ) ) {
+                name_end--;
+            }
+            *name_end = '\0';
+
+            shader_source_t & shader =
+                intern.shader_list[ intern.shader_count ];
+            shader.name = line + tag_len;
+            shader.source = next;
+            intern.shader_count++;
+        }
+
+        line = next;
+    }
 }
 
-// TODO: make this less c++ dependent?
 const char * find_shader_string( const char * name )
 {
-    res_t shader_res = find_res( "shaders.glsl" );
-    const unsigned char * shaders = shader_res.data;
-    int len = shader_res.size;
-
-    // split into lines
-    std::vector< std::string > lines;
-
-    {
-        std::string line;
-        for ( int i = 0; i < len; i++ ) {
-            if ( shaders[ i ] == '\n' ) {
-                lines.push_back( line );
-                line = "";
-            } else {
-                line += shaders[ i ];
-            }
+    if ( !intern.shader_text ) {
+        index_shaders();
+    }
+
+    for ( int i = 0; i < intern.shader_count; i++ ) {
+        if ( strcmp( intern.shader_list[ i ].name, name ) == 0 ) {
+            return intern.shader_list[ i ].source;
         }
     }
 
-    // find shader line
-    int matched_line = -1;
-    for ( int i = 0; i < std::ssize( lines ); i++ ) {
-        if ( match_shader_line( lines[ i ].c_str(), name ) ) {
-            matched_line = i;
-            break;
+    ERROR_LOG( "failed to find shader: %s", name );
+    return "";
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// program binary cache
+////////////////////////////////////////////////////////////////////////////////
+
+// fnv-1a
+static uint64_t hash_string( uint64_t hash, const char * str )
+{
+    if ( !str ) str = "";
+
+    for ( ; *str; str++ ) {
+        hash ^= (unsigned char) *str;
+        hash *= 0x100000001b3ull;
+    }
+
+    // separator, so "ab" + "c" and "a" + "bc" differ
+    hash ^= 0xff;
+    hash *= 0x100000001b3ull;
+
+    return hash;
+}
+
+/// binaries are only valid for the driver that produced them
+static uint64_t
+program_key( const char * vertex_source, const char * fragment_source )
+{
+    uint64_t hash = 0xcbf29ce484222325ull;
+    hash = hash_string( hash, vertex_source );
+    hash = hash_string( hash, fragment_source );
+    hash = hash_string( hash, (const char *) glGetString( GL_VENDOR ) );
+    hash = hash_string( hash, (const char *) glGetString( GL_RENDERER ) );
+    hash = hash_string( hash, (const char *) glGetString( GL_VERSION ) );
+    return hash;
+}
+
+static int has_program_binary()
+{
+#ifdef __EMSCRIPTEN__
+    return 0;
+#else
+    int supported = GLVersion.major > 4 ||
+                    ( GLVersion.major == 4 && GLVersion.minor >= 1 );
+
+    int count = 0;
+    glGetIntegerv( GL_NUM_EXTENSIONS, &count );
+    for ( int i = 0; i < count && !supported; i++ ) {
+        const char * ext = (const char *) glGetStringi( GL_EXTENSIONS, i );
+        if ( strcmp( ext, "GL_ARB_get_program_binary" ) == 0 ) supported = 1;
+    }
+
+    if ( !supported ) return 0;
+
+    // drivers may support the entry points but no formats at all
+    int format_count = 0;
+    glGetIntegerv( GL_NUM_PROGRAM_BINARY_FORMATS, &format_count );
+    if ( format_count <= 0 ) return 0;
+
+    intern.get_program_binary =
+        (get_program_binary_proc_t) hardware_gl_proc( "glGetProgramBinary" );
+    intern.program_binary =
+        (program_binary_proc_t) hardware_gl_proc( "glProgramBinary" );
+    intern.program_parameteri =
+        (program_parameteri_proc_t) hardware_gl_proc( "glProgramParameteri" );
+
+    return intern.get_program_binary && intern.program_binary &&
+           intern.program_parameteri;
+#endif
+}
+
+static const char k_cache_magic[ 4 ] = { 'P', 'B', 'C', '1' };
+
+static void free_program_binaries()
+{
+    for ( int i = 0; i < intern.binary_count; i++ ) {
+        delete[] intern.binary_list[ i ].data;
+    }
+    intern.binary_count = 0;
+}
+
+/// file layout: magic, count, then per binary key, format, size and data
+static int read_cache_file( FILE * file )
+{
+    char magic[ 4 ];
+    int count;
+
+    if ( fread( magic, 4, 1, file ) != 1 ) return 1;
+    if ( memcmp( magic, k_cache_magic, 4 ) != 0 ) return 1;
+    if ( fread( &count, sizeof( int ), 1, file ) != 1 ) return 1;
+    if ( count < 0 || count > k_program_binary_cap ) return 1;
+
+    for ( int i = 0; i < count; i++ ) {
+        program_binary_t & binary = intern.binary_list[ i ];
+
+        if ( fread( &binary.key, sizeof( uint64_t ), 1, file ) != 1 ) return 1;
+        if ( fread( &binary.format, sizeof( int ), 1, file ) != 1 ) return 1;
+        if ( fread( &binary.size, sizeof( int ), 1, file ) != 1 ) return 1;
+        if ( binary.size <= 0 || binary.size > 64 * 1024 * 1024 ) return 1;
+
+        binary.data = new char[ binary.size ];
+        binary.used = 0;
+        intern.binary_count++;
+
+        if ( fread( binary.data, binary.size, 1, file ) != 1 ) return 1;
+    }
+
+    return 0;
+}
+
+void shader_cache_init( const char * path )
+{
+    intern.cache_path = path;
+    intern.cache_dirty = 0;
+    intern.binary_count = 0;
+    intern.cache_supported = has_program_binary();
+
+    if ( !intern.cache_supported ) {
+        INFO_LOG( "program binaries not available, compiling shaders" );
+        return;
+    }
+
+    FILE * file = fopen( path, "rb" );
+    if ( !file ) return;
+
+    if ( read_cache_file( file ) ) {
+        INFO_LOG( "ignoring invalid shader cache: %s", path );
+        free_program_binaries();
+    }
+
+    fclose( file );
+}
+
+void shader_cache_flush()
+{
+    if ( !intern.cache_supported ) return;
+
+    // binaries of edited shaders or an older driver were not asked for, they
+    // are dropped so the cap only has to hold the programs in use
+    int used_count = 0;
+    for ( int i = 0; i < intern.binary_count; i++ ) {
+        used_count += intern.binary_list[ i ].used;
+    }
+
+    if ( !intern.cache_dirty && used_count == intern.binary_count ) return;
+
+    FILE * file = fopen( intern.cache_path, "wb" );
+    if ( !file ) {
+        ERROR_LOG( "failed to write shader cache: %s", intern.cache_path );
+        return;
+    }
+
+    fwrite( k_cache_magic, 4, 1, file );
+    fwrite( &used_count, sizeof( int ), 1, file );
+
+    for ( int i = 0; i < intern.binary_count; i++ ) {
+        const program_binary_t & binary = intern.binary_list[ i ];
+        if ( !binary.used ) continue;
+
+        fwrite( &binary.key, sizeof( uint64_t ), 1, file );
+        fwrite( &binary.format, sizeof( int ), 1, file );
+        fwrite( &binary.size, sizeof( int ), 1, file );
+        fwrite( binary.data, binary.size, 1, file );
+    }
+
+    fclose( file );
+    intern.cache_dirty = 0;
+}
+
+/// 0 and a linked program in out when the cache has a binary that the
+/// driver still accepts
+static int load_program_binary( int * out, uint64_t key )
+{
+#ifndef __EMSCRIPTEN__
+    if ( !intern.cache_supported ) return 1;
+
+    for ( int i = 0; i < intern.binary_count; i++ ) {
+        program_binary_t & binary = intern.binary_list[ i ];
+        if ( binary.key != key ) continue;
+
+        int program = glCreateProgram();
+        intern.program_binary(
+            program,
+            binary.format,
+            binary.data,
+            binary.size
+        );
+
+        int linked = 0;
+        glGetProgramiv( program, GL_LINK_STATUS, &linked );
+        if ( linked ) {
+            binary.used = 1;
+            *out = program;
+            return 0;
         }
+
+        // a driver update, compile it again
+        glDeleteProgram( program );
+        return 1;
     }
+#endif
 
-    // no match
-    if ( matched_line == -1 ) {
-        ERROR_LOG( "failed to find shader: %s", name );
-        return "";
+    return 1;
+}
+
+static void store_program_binary( int program, uint64_t key )
+{
+#ifndef __EMSCRIPTEN__
+    if ( !intern.cache_supported ) return;
+
+    int size = 0;
+    glGetProgramiv( program, GL_PROGRAM_BINARY_LENGTH, &size );
+    if ( size <= 0 ) return;
+
+    // replace a stale binary with the same key
+    int index = -1;
+    for ( int i = 0; i < intern.binary_count; i++ ) {
+        if ( intern.binary_list[ i ].key == key ) index = i;
     }
 
-    // match lines
-    std::vector< std::string > matched_lines;
-    for ( int i = matched_line + 1; i < std::ssize( lines ); i++ ) {
-        // stop when we get to another shader
-        if ( match_any_shader_line( lines[ i ].c_str() ) ) break;
-        matched_lines.push_back( lines[ i ] );
+    // when full, one nothing asked for so far this run makes room. it may
+    // still be wanted later, but it is more likely left by an older build
+    int full = intern.binary_count >= k_program_binary_cap;
+    for ( int i = 0; i < intern.binary_count && full && index == -1; i++ ) {
+        if ( !intern.binary_list[ i ].used ) index = i;
     }
 
-    // combine lines into one string
-    std::stringstream ss;
-    for ( std::string & line : matched_lines ) {
-        ss << line << '\n';
+    if ( index == -1 ) {
+        if ( intern.binary_count >= k_program_binary_cap ) {
+            ERROR_LOG( "shader cache full (%d)", k_program_binary_cap );
+            return;
+        }
+        index = intern.binary_count;
+        intern.binary_count++;
+    } else {
+        delete[] intern.binary_list[ index ].data;
     }
 
-    // TODO: lol yea i know
-    std::string * str = new std::string( ss.str() );
+    program_binary_t & binary = intern.binary_list[ index ];
+    binary.key = key;
+    binary.size = size;
+    binary.data = new char[ size ];
+    binary.used = 1;
 
-    return str->c_str();
+    GLenum format = 0;
+    intern.get_program_binary( program, size, nullptr, &format, binary.data );
+    binary.format = format;
+
+    intern.cache_dirty = 1;
+#endif
 }
 
 static int create_shader( int * out, int type, const char * source )
@@ -146,6 +456,16 @@ static int create_shader_program( int * out, int * shaders, int count )
         glAttachShader( program, shaders[ i ] );
     }
 
+#ifndef __EMSCRIPTEN__
+    if ( intern.cache_supported ) {
+        intern.program_parameteri(
+            program,
+            GL_PROGRAM_BINARY_RETRIEVABLE_HINT,
+            GL_TRUE
+        );
+    }
+#endif
+
     glLinkProgram( program );
 
     glGetProgramiv( program, GL_LINK_STATUS, &linked );
@@ -180,6 +500,12 @@ int build_shader( const char * vertex_source, const char * fragment_source )
     int shaders[ 2 ];
     int error;
     int program = -1;
+    uint64_t key = program_key( vertex_source, fragment_source );
+
+    // warm start, no glsl compilation at all
+    if ( load_program_binary( &program, key ) == 0 ) {
+        return program;
+    }
 
     error = create_shader( shaders + 0, GL_VERTEX_SHADER, vertex_source );
     if ( error ) {
@@ -196,6 +522,8 @@ int build_shader( const char * vertex_source, const char * fragment_source )
         goto cleanup_shader2;
     }
 
+    store_program_binary( program, key );
+
 cleanup_shader2:
     glDeleteShader( shaders[ 1 ] );
 cleanup_shader1:
@@ -214,14 +542,18 @@ void vbuffer_t::init( int new_element_size )
     element_count = 0;
 }
 
-void vbuffer_t::set( const float * new_data, int new_element_count )
+void vbuffer_t::set(
+    const float * new_data,
+    int new_element_count,
+    int is_static
+)
 {
     glBindBuffer( GL_ARRAY_BUFFER, buffer );
     glBufferData(
         GL_ARRAY_BUFFER,                                    // type
         new_element_count * element_size * sizeof( float ), // size in bytes
         new_data,                                           // data pointer
-        GL_DYNAMIC_DRAW                                     // render strategy
+        is_static ? GL_STATIC_DRAW : GL_DYNAMIC_DRAW        // render strategy
     );
 
     element_count = new_element_count;
@@ -250,6 +582,15 @@ int find_uniform( int shader, const char * uniform_name )
     return location;
 }
 
+int find_attrib( int shader, const char * attrib_name )
+{
+    int location = glGetAttribLocation( shader, attrib_name );
+    if ( location < 0 ) {
+        ERROR_LOG( "failed to find attribute '%s' in shader", attrib_name );
+    }
+    return location;
+}
+
 void set_uniform( int uniform, int v )
 {
     glUniform1i( uniform, v );
@@ -260,12 +601,12 @@ void set_uniform( int uniform, float v )
     glUniform1f( uniform, v );
 }
 
-void set_uniform( int uniform, float ( &v )[ 3 ] )
+void set_uniform( int uniform, const float ( &v )[ 3 ] )
 {
     glUniform3fv( uniform, 1, v );
 }
 
-void set_uniform( int uniform, float ( &v )[ 4 ] )
+void set_uniform( int uniform, const float ( &v )[ 4 ] )
 {
     glUniform4fv( uniform, 1, v );
 }
@@ -275,8 +616,11 @@ void set_uniform( int uniform, vec4 ( &m )[ 4 ] )
     glUniformMatrix4fv( uniform, 1, GL_FALSE, (float *) m );
 }
 
-void framebuffer_t::init( int width, int height )
+void framebuffer_t::init( int new_width, int new_height )
 {
+    width = new_width;
+    height = new_height;
+
     unsigned int fbo;
     glGenFramebuffers( 1, &fbo );
 
@@ -317,69 +661,155 @@ void framebuffer_t::init( int width, int height )
     texture = local_texture;
 }
 
-#define STB_IMAGE_IMPLEMENTATION
-#include <stb_image.h>
+void framebuffer_t::resize( int new_width, int new_height )
+{
+    width = new_width;
+    height = new_height;
+
+    // the attachment follows the texture object, only its storage changes
+    glBindTexture( GL_TEXTURE_2D, texture );
+    glTexImage2D(
+        GL_TEXTURE_2D,
+        0,
+        GL_RGB,
+        width,
+        height,
+        0,
+        GL_RGB,
+        GL_UNSIGNED_BYTE,
+        nullptr
+    );
+}
+
+void framebuffer_t::bind()
+{
+    glBindFramebuffer( GL_FRAMEBUFFER, id );
+}
 
-int load_texture( res_t res )
+void framebuffer_t::unbind()
+{
+    glBindFramebuffer( GL_FRAMEBUFFER, 0 );
+}
+
+#ifndef GL_TIME_ELAPSED
+#define GL_TIME_ELAPSED 0x88BF
+#endif
+
+static int has_timer_query()
+{
+#ifdef __EMSCRIPTEN__
+    return 0;
+#else
+    int major = GLVersion.major;
+    int minor = GLVersion.minor;
+    if ( major > 3 || ( major == 3 && minor >= 3 ) ) return 1;
+
+    int count = 0;
+    glGetIntegerv( GL_NUM_EXTENSIONS, &count );
+    for ( int i = 0; i < count; i++ ) {
+        const char * ext = (const char *) glGetStringi( GL_EXTENSIONS, i );
+        if ( strcmp( ext, "GL_ARB_timer_query" ) == 0 ) return 1;
+    }
+
+    return 0;
+#endif
+}
+
+void gpu_timer_t::init()
+{
+    issued_count = 0;
+    read_count = 0;
+    running = 0;
+    supported = has_timer_query();
+
+    if ( !supported ) {
+        INFO_LOG( "gpu timer queries not available" );
+        return;
+    }
+
+#ifndef __EMSCRIPTEN__
+    glGenQueries( 4, query_list );
+#endif
+}
+
+void gpu_timer_t::begin()
+{
+    if ( !supported ) return;
+
+    // every query is still in flight, skip this frame
+    if ( issued_count - read_count >= 4 ) return;
+
+#ifndef __EMSCRIPTEN__
+    glBeginQuery( GL_TIME_ELAPSED, query_list[ issued_count % 4 ] );
+#endif
+    issued_count++;
+    running = 1;
+}
+
+void gpu_timer_t::end()
+{
+    if ( !running ) return;
+
+#ifndef __EMSCRIPTEN__
+    glEndQuery( GL_TIME_ELAPSED );
+#endif
+    running = 0;
+}
+
+float gpu_timer_t::poll()
+{
+    float result = -1.0f;
+
+#ifndef __EMSCRIPTEN__
+    while ( supported && read_count < issued_count ) {
+        unsigned int query = query_list[ read_count % 4 ];
+
+        int available = 0;
+        glGetQueryObjectiv( query, GL_QUERY_RESULT_AVAILABLE, &available );
+        if ( !available ) break;
+
+        unsigned int ns = 0;
+        glGetQueryObjectuiv( query, GL_QUERY_RESULT, &ns );
+        result = ns * 1e-9f;
+        read_count++;
+    }
+#endif
+
+    return result;
+}
+
+int upload_texture( const image_t & image )
 {
     unsigned int texture;
     glGenTextures( 1, &texture );
     glBindTexture( GL_TEXTURE_2D, texture );
 
-    int error = 0;
-    // generate a texture
-    glBindTexture( GL_TEXTURE_2D, texture );
-    // set the texture wrapping/filtering options (on the currently bound
-    // texture object)
-    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT );
-    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT );
+    // atlas regions must not wrap into their neighbours
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
     glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST );
     glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST );
     // glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR );
     // glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
-    //  load and generate the texture
-    int width, height, nrChannels;
-    unsigned char * data = stbi_load_from_memory(
-        res.data,
-        res.size,
-        &width,
-        &height,
-        &nrChannels,
-        0
-    );
-    if ( data ) {
+
+    if ( image.pixels ) {
         glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
-        if ( nrChannels == 3 ) {
-            glTexImage2D(
-                GL_TEXTURE_2D,
-                0,
-                GL_RGB,
-                width,
-                height,
-                0,
-                GL_RGB,
-                GL_UNSIGNED_BYTE,
-                data
-            );
-        } else {
-            glTexImage2D(
-                GL_TEXTURE_2D,
-                0,
-                GL_RGBA,
-                width,
-                height,
-                0,
-                GL_RGBA,
-                GL_UNSIGNED_BYTE,
-                data
-            );
-        }
+        glTexImage2D(
+            GL_TEXTURE_2D,
+            0,
+            GL_RGBA,
+            image.width,
+            image.height,
+            0,
+            GL_RGBA,
+            image.format == IMAGE_RGBA4444 ? GL_UNSIGNED_SHORT_4_4_4_4
+                                           : GL_UNSIGNED_BYTE,
+            image.pixels
+        );
         // glGenerateMipmap( GL_TEXTURE_2D );
     } else {
         ERROR_LOG( "failed to load texture" );
-        error = 1;
     }
-    stbi_image_free( data );
 
     return texture;
 }
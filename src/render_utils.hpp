@@ -1,5 +1,6 @@
 #pragma once
 
+#include "loader.hpp"
 #include "res.hpp"
 
 #include <cglm/types.h>
@@ -10,28 +11,69 @@ struct vbuffer_t {
     int element_size;
 
     void init( int new_element_size );
-    void set( const float * new_data, int new_element_count );
+    void set(
+        const float * new_data,
+        int new_element_count,
+        int is_static = 0
+    );
     void enable( int attrib_index );
 };
 
 struct framebuffer_t {
     int id;
     int texture;
+    int width; // allocated size of the texture
+    int height;
+
+    void init( int new_width, int new_height );
+
+    /// reallocates the texture, its contents are lost
+    void resize( int new_width, int new_height );
 
-    void init( int width, int height );
     void bind();
+    void unbind();
 };
 
-int load_texture( res_t res );
+/// gpu time of a pass from GL_TIME_ELAPSED queries, read back a few frames
+/// late so the cpu never waits on the gpu
+struct gpu_timer_t {
+    unsigned int query_list[ 4 ];
+    int issued_count;
+    int read_count;
+    int running;
+    int supported;
+
+    void init();
+    void begin();
+    void end();
+
+    /// seconds of the newest finished query, or -1 when none is ready
+    float poll();
+};
 
+/// the decoding happens in the loader, only the upload is left for the gl
+/// thread
+int upload_texture( const image_t & image );
+
+/// section of shaders.glsl, the file is split once on first use
 const char * find_shader_string( const char * name );
 
+/// loads linked program binaries saved by an earlier run, build_shader()
+/// uses them instead of compiling when the sources and driver match
+void shader_cache_init( const char * path );
+
+/// writes the cache back if build_shader() added binaries to it or some went
+/// unused, only the binaries this run loaded or added are kept
+void shader_cache_flush();
+
 int build_shader( const char * vertex_string, const char * fragment_string );
 
 int find_uniform( int shader, const char * uniform_name );
 
+int find_attrib( int shader, const char * attrib_name );
+
 void set_uniform( int uniform, int v );
 void set_uniform( int uniform, float v );
-void set_uniform( int uniform, float ( &v )[ 3 ] );
-void set_uniform( int uniform, float ( &v )[ 4 ] );
+void set_uniform( int uniform, const float ( &v )[ 3 ] );
+void set_uniform( int uniform, const float ( &v )[ 4 ] );
 void set_uniform( int uniform, vec4 ( &m )[ 4 ] );
@@ -1,21 +1,118 @@
 #include "res.hpp"
 #include "logging.hpp"
+#include "pack.hpp"
+
+#if RES_BLOB
+// the data comes from the blob bake -b writes, the assembler pulls it in so
+// the compiler never sees it. it lands page aligned in read only memory,
+// shared between processes. the generated header has the tables and the
+// blob path, already escaped for the assembler string below
+#include "res_blob.h"
+__asm__(
+    "  .section .rodata.res_data, \"a\", @progbits\n"
+    "  .balign 4096\n"
+    "  .global res_data\n"
+    "  .hidden res_data\n"
+    "res_data:\n"
+    "  .incbin \"" RES_BLOB_PATH "\"\n"
+    "  .previous\n"
+);
+extern "C" const unsigned char res_data[];
+#else
 #include "res_data.h"
+#endif
 
 #include <string.h>
 
-res_t find_res( const char * name )
+static_assert( res_hash( "" ) == 2166136261u, "res_hash is not constexpr" );
+
+/// murmur3 finalizer, the same as in bake
+static uint32_t res_mix( uint32_t h )
+{
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+/// index into the name list, -1 when the name is not there. the slot is only
+/// a candidate, names that were never baked can land on any of them
+static int find_index(
+    res_name_t name,
+    const unsigned int * hash_list,
+    const int * disp_list,
+    int disp_count,
+    const int * slot_list,
+    int slot_count,
+    const char * const * name_list
+)
 {
-    for ( int i = 0; i < res_data_count; i++ ) {
-        if ( strcmp( name, res_data_name_list[ i ] ) == 0 ) {
-            res_t res;
-            res.data = res_data + res_data_offset_list[ i ];
-            res.size = res_data_size_list[ i ];
-            return res;
-        }
+    uint32_t disp = disp_list[ name.hash & ( disp_count - 1 ) ];
+    int i = slot_list[ res_mix( name.hash + disp ) & ( slot_count - 1 ) ];
+
+    if ( i < 0 || hash_list[ i ] != name.hash ) return -1;
+    if ( strcmp( name_list[ i ], name.name ) != 0 ) return -1;
+
+    return i;
+}
+
+res_t find_res( res_name_t name )
+{
+    res_t res;
+    if ( pack_find( name, &res ) ) return res;
+
+    int i = find_index(
+        name,
+        res_data_hash_list,
+        res_data_disp_list,
+        res_data_disp_count,
+        res_data_slot_list,
+        res_data_slot_count,
+        res_data_name_list
+    );
+
+    if ( i >= 0 ) {
+        res.data = res_data + res_data_offset_list[ i ];
+        res.size = res_data_size_list[ i ];
+        return res;
     }
 
-    ERROR_LOG( "failed to find resource: %s", name );
+    ERROR_LOG( "failed to find resource: %s", name.name );
 
     return { nullptr, 0 };
 }
+
+atlas_region_t find_atlas_region( res_name_t name )
+{
+    atlas_region_t region = {};
+    if ( pack_find_atlas_region( name, &region ) ) return region;
+
+    region.atlas_w = res_atlas_width;
+    region.atlas_h = res_atlas_height;
+
+    int i = find_index(
+        name,
+        res_atlas_hash_list,
+        res_atlas_disp_list,
+        res_atlas_disp_count,
+        res_atlas_slot_list,
+        res_atlas_slot_count,
+        res_atlas_name_list
+    );
+
+    if ( i >= 0 ) {
+        region.x = res_atlas_x_list[ i ];
+        region.y = res_atlas_y_list[ i ];
+        region.w = res_atlas_w_list[ i ];
+        region.h = res_atlas_h_list[ i ];
+        region.trim_x = res_atlas_trim_x_list[ i ];
+        region.trim_y = res_atlas_trim_y_list[ i ];
+        return region;
+    }
+
+    ERROR_LOG( "failed to find atlas region: %s", name.name );
+
+    return region;
+}
@@ -1,8 +1,66 @@
 #pragma once
 
+#include <stdint.h>
+
 struct res_t {
-    unsigned char * data;
+    const unsigned char * data;
     int size;
 };
 
-res_t find_res( const char * name );
+/// fnv-1a, the hash bake builds the lookup tables over
+constexpr uint32_t res_hash( const char * name )
+{
+    uint32_t hash = 2166136261u;
+    for ( ; *name; name++ ) {
+        hash ^= (unsigned char) *name;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/// a resource name and its hash. literals are hashed at compile time, names
+/// built at runtime have to be wrapped explicitly: res_name_t( name )
+struct res_name_t {
+    const char * name;
+    uint32_t hash;
+
+    template < int N >
+    consteval res_name_t( const char ( &new_name )[ N ] )
+        : name( new_name ), hash( res_hash( new_name ) )
+    {
+    }
+
+    explicit res_name_t( const char * new_name )
+        : name( new_name ), hash( res_hash( new_name ) )
+    {
+    }
+
+    // char buffers would otherwise pick the consteval one
+    template < int N >
+    explicit res_name_t( char ( &new_name )[ N ] )
+        : name( new_name ), hash( res_hash( new_name ) )
+    {
+    }
+};
+
+/// one probe into a perfect hash table, whatever the resource count
+res_t find_res( res_name_t name );
+
+/// where a baked image ended up in the atlas resource, in atlas pixels
+struct atlas_region_t {
+    int x;
+    int y;
+    int w;
+    int h;
+
+    // offset of the region in the source image, transparent borders are
+    // trimmed away when baking
+    int trim_x;
+    int trim_y;
+
+    int atlas_w;
+    int atlas_h;
+};
+
+/// the atlas itself is the resource "atlas.tex"
+atlas_region_t find_atlas_region( res_name_t name );
@@ -1,4 +1,4 @@
-unsigned char res_data[] = {
+alignas( 16 ) const unsigned char res_data[] = {
     0x0A, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
     0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
     0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
@@ -20,21 +20,27 @@ unsigned char res_data[] = {
     0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x23, 0x76, 0x65, 
     0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x31, 0x30, 0x30, 0x0A, 
     0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 
-    0x76, 0x65, 0x63, 0x33, 0x20, 0x61, 0x5F, 0x70, 0x6F, 0x73, 
-    0x3B, 0x0A, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 
-    0x6D, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5F, 0x70, 0x72, 0x6F, 
-    0x6A, 0x3B, 0x0A, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 
-    0x20, 0x6D, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5F, 0x6D, 0x6F, 
-    0x64, 0x65, 0x6C, 0x3B, 0x0A, 0x76, 0x6F, 0x69, 0x64, 0x20, 
-    0x6D, 0x61, 0x69, 0x6E, 0x28, 0x29, 0x0A, 0x7B, 0x0A, 0x20, 
-    0x20, 0x20, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x70, 0x6F, 
-    0x73, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x20, 
-    0x61, 0x5F, 0x70, 0x6F, 0x73, 0x2C, 0x20, 0x31, 0x2E, 0x30, 
-    0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6C, 
-    0x5F, 0x50, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 
-    0x3D, 0x20, 0x75, 0x5F, 0x70, 0x72, 0x6F, 0x6A, 0x20, 0x2A, 
-    0x20, 0x75, 0x5F, 0x6D, 0x6F, 0x64, 0x65, 0x6C, 0x20, 0x2A, 
-    0x20, 0x70, 0x6F, 0x73, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x2F, 
+    0x76, 0x65, 0x63, 0x32, 0x20, 0x61, 0x5F, 0x70, 0x6F, 0x73, 
+    0x3B, 0x0A, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 
+    0x65, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x61, 0x5F, 0x63, 
+    0x6F, 0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x75, 0x6E, 0x69, 0x66, 
+    0x6F, 0x72, 0x6D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 
+    0x5F, 0x70, 0x72, 0x6F, 0x6A, 0x3B, 0x20, 0x2F, 0x2F, 0x20, 
+    0x73, 0x63, 0x61, 0x6C, 0x65, 0x20, 0x78, 0x79, 0x2C, 0x20, 
+    0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x7A, 0x77, 0x0A, 
+    0x76, 0x61, 0x72, 0x79, 0x69, 0x6E, 0x67, 0x20, 0x76, 0x65, 
+    0x63, 0x34, 0x20, 0x76, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 
+    0x3B, 0x0A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x6D, 0x61, 0x69, 
+    0x6E, 0x28, 0x29, 0x0A, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x76, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 
+    0x61, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x67, 0x6C, 0x5F, 0x50, 0x6F, 0x73, 0x69, 
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 
+    0x34, 0x28, 0x20, 0x61, 0x5F, 0x70, 0x6F, 0x73, 0x20, 0x2A, 
+    0x20, 0x75, 0x5F, 0x70, 0x72, 0x6F, 0x6A, 0x2E, 0x78, 0x79, 
+    0x20, 0x2B, 0x20, 0x75, 0x5F, 0x70, 0x72, 0x6F, 0x6A, 0x2E, 
+    0x7A, 0x77, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x31, 
+    0x2E, 0x30, 0x20, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x2F, 
     0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
     0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
     0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
@@ -57,12 +63,12 @@ unsigned char res_data[] = {
     0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x31, 0x30, 0x30, 0x0A, 
     0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x20, 
     0x6C, 0x6F, 0x77, 0x70, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 
-    0x3B, 0x0A, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 
-    0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x5F, 0x63, 0x6F, 0x6C, 
+    0x3B, 0x0A, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6E, 0x67, 0x20, 
+    0x76, 0x65, 0x63, 0x34, 0x20, 0x76, 0x5F, 0x63, 0x6F, 0x6C, 
     0x6F, 0x72, 0x3B, 0x0A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x6D, 
     0x61, 0x69, 0x6E, 0x28, 0x29, 0x0A, 0x7B, 0x0A, 0x20, 0x20, 
     0x20, 0x20, 0x67, 0x6C, 0x5F, 0x46, 0x72, 0x61, 0x67, 0x43, 
-    0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x75, 0x5F, 0x63, 
+    0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x76, 0x5F, 0x63, 
     0x6F, 0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x2F, 
     0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
     0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
@@ -173,27 +179,33 @@ unsigned char res_data[] = {
     0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
     0x2F, 0x0A, 0x0A, 0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 
     0x6E, 0x20, 0x31, 0x30, 0x30, 0x0A, 0x61, 0x74, 0x74, 0x72, 
-    0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x76, 0x65, 0x63, 0x33, 
+    0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x76, 0x65, 0x63, 0x32, 
     0x20, 0x61, 0x5F, 0x70, 0x6F, 0x73, 0x3B, 0x0A, 0x61, 0x74, 
     0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x76, 0x65, 
-    0x63, 0x32, 0x20, 0x61, 0x5F, 0x75, 0x76, 0x3B, 0x0A, 0x75, 
-    0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x6D, 0x61, 0x74, 
-    0x34, 0x20, 0x75, 0x5F, 0x70, 0x72, 0x6F, 0x6A, 0x3B, 0x0A, 
-    0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x6D, 0x61, 
-    0x74, 0x34, 0x20, 0x75, 0x5F, 0x6D, 0x6F, 0x64, 0x65, 0x6C, 
-    0x3B, 0x0A, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6E, 0x67, 0x20, 
-    0x76, 0x65, 0x63, 0x32, 0x20, 0x76, 0x5F, 0x75, 0x76, 0x3B, 
-    0x0A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x6D, 0x61, 0x69, 0x6E, 
-    0x28, 0x29, 0x0A, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 
-    0x5F, 0x75, 0x76, 0x20, 0x3D, 0x20, 0x61, 0x5F, 0x75, 0x76, 
-    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x63, 0x34, 
-    0x20, 0x70, 0x6F, 0x73, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 
-    0x34, 0x28, 0x20, 0x61, 0x5F, 0x70, 0x6F, 0x73, 0x2C, 0x20, 
-    0x31, 0x2E, 0x30, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 
-    0x20, 0x67, 0x6C, 0x5F, 0x50, 0x6F, 0x73, 0x69, 0x74, 0x69, 
-    0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x75, 0x5F, 0x70, 0x72, 0x6F, 
-    0x6A, 0x20, 0x2A, 0x20, 0x75, 0x5F, 0x6D, 0x6F, 0x64, 0x65, 
-    0x6C, 0x20, 0x2A, 0x20, 0x70, 0x6F, 0x73, 0x3B, 0x0A, 0x7D, 
+    0x63, 0x32, 0x20, 0x61, 0x5F, 0x75, 0x76, 0x3B, 0x0A, 0x61, 
+    0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x76, 
+    0x65, 0x63, 0x34, 0x20, 0x61, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 
+    0x72, 0x3B, 0x0A, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 
+    0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x5F, 0x70, 0x72, 
+    0x6F, 0x6A, 0x3B, 0x20, 0x2F, 0x2F, 0x20, 0x73, 0x63, 0x61, 
+    0x6C, 0x65, 0x20, 0x78, 0x79, 0x2C, 0x20, 0x6F, 0x66, 0x66, 
+    0x73, 0x65, 0x74, 0x20, 0x7A, 0x77, 0x0A, 0x76, 0x61, 0x72, 
+    0x79, 0x69, 0x6E, 0x67, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 
+    0x76, 0x5F, 0x75, 0x76, 0x3B, 0x0A, 0x76, 0x61, 0x72, 0x79, 
+    0x69, 0x6E, 0x67, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x76, 
+    0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x76, 0x6F, 
+    0x69, 0x64, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x28, 0x29, 0x0A, 
+    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x5F, 0x75, 0x76, 
+    0x20, 0x3D, 0x20, 0x61, 0x5F, 0x75, 0x76, 0x3B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x76, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 
+    0x20, 0x3D, 0x20, 0x61, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6C, 0x5F, 0x50, 
+    0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 
+    0x76, 0x65, 0x63, 0x34, 0x28, 0x20, 0x61, 0x5F, 0x70, 0x6F, 
+    0x73, 0x20, 0x2A, 0x20, 0x75, 0x5F, 0x70, 0x72, 0x6F, 0x6A, 
+    0x2E, 0x78, 0x79, 0x20, 0x2B, 0x20, 0x75, 0x5F, 0x70, 0x72, 
+    0x6F, 0x6A, 0x2E, 0x7A, 0x77, 0x2C, 0x20, 0x30, 0x2E, 0x30, 
+    0x2C, 0x20, 0x31, 0x2E, 0x30, 0x20, 0x29, 0x3B, 0x0A, 0x7D, 
     0x0A, 0x0A, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
     0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
     0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
@@ -219,110 +231,294 @@ unsigned char res_data[] = {
     0x6F, 0x61, 0x74, 0x3B, 0x0A, 0x75, 0x6E, 0x69, 0x66, 0x6F, 
     0x72, 0x6D, 0x20, 0x73, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x72, 
     0x32, 0x44, 0x20, 0x75, 0x5F, 0x74, 0x65, 0x78, 0x74, 0x75, 
-    0x72, 0x65, 0x3B, 0x0A, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 
-    0x6D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x5F, 0x63, 
-    0x6F, 0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x76, 0x61, 0x72, 0x79, 
-    0x69, 0x6E, 0x67, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x76, 
-    0x5F, 0x75, 0x76, 0x3B, 0x0A, 0x76, 0x6F, 0x69, 0x64, 0x20, 
+    0x72, 0x65, 0x3B, 0x0A, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6E, 
+    0x67, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x76, 0x5F, 0x75, 
+    0x76, 0x3B, 0x0A, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6E, 0x67, 
+    0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x76, 0x5F, 0x63, 0x6F, 
+    0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x76, 0x6F, 0x69, 0x64, 0x20, 
     0x6D, 0x61, 0x69, 0x6E, 0x28, 0x29, 0x0A, 0x7B, 0x0A, 0x20, 
     0x20, 0x20, 0x20, 0x67, 0x6C, 0x5F, 0x46, 0x72, 0x61, 0x67, 
-    0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x75, 0x5F, 
+    0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x76, 0x5F, 
     0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x2A, 0x20, 0x74, 0x65, 
     0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x44, 0x28, 0x20, 0x75, 
     0x5F, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x2C, 0x20, 
     0x76, 0x5F, 0x75, 0x76, 0x20, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 
-    0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 
-    0x00, 0x0D, 0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x02, 0x00, 
-    0x00, 0x00, 0x02, 0x00, 0x08, 0x06, 0x00, 0x00, 0x00, 0xF4, 
-    0x78, 0xD4, 0xFA, 0x00, 0x00, 0x06, 0xE1, 0x49, 0x44, 0x41, 
-    0x54, 0x78, 0xDA, 0xED, 0xDB, 0x41, 0x72, 0xDB, 0x30, 0x0C, 
-    0x05, 0x50, 0xDF, 0xFF, 0xD2, 0xEE, 0xA6, 0x8B, 0x8C, 0xC7, 
-    0x15, 0x81, 0x0F, 0x28, 0x71, 0x27, 0xEF, 0xED, 0x32, 0xB2, 
-    0x64, 0x59, 0x04, 0x49, 0x10, 0x54, 0x1E, 0x8F, 0x17, 0xCF, 
-    0xBF, 0x4E, 0x7F, 0xBF, 0x7A, 0x77, 0x8D, 0xAF, 0xC7, 0xAE, 
-    0xCE, 0x79, 0x86, 0x2A, 0xDF, 0x37, 0xB9, 0xEF, 0xCE, 0xBD, 
-    0x5E, 0x3D, 0xC3, 0x7F, 0xDD, 0x63, 0xE5, 0x19, 0x57, 0xBF, 
-    0xB7, 0xFA, 0xCC, 0xD3, 0x73, 0x2A, 0xE7, 0x56, 0x7F, 0x67, 
-    0xE7, 0x58, 0x1A, 0x13, 0xEF, 0x54, 0xBE, 0xFB, 0xEA, 0x73, 
-    0xEF, 0xDA, 0xEB, 0xEA, 0xB3, 0x57, 0xDF, 0x77, 0xEA, 0x77, 
-    0xE9, 0x33, 0x3E, 0xFD, 0x9E, 0xD3, 0xF5, 0x4E, 0x9F, 0x9F, 
-    0xC6, 0x43, 0x67, 0x6C, 0xD9, 0x88, 0x8F, 0x4A, 0xFF, 0xAE, 
-    0xC4, 0x4B, 0xA5, 0x8F, 0x9F, 0xE2, 0xE3, 0x6A, 0x7C, 0x3A, 
-    0x5D, 0xE7, 0xEA, 0xDA, 0xD3, 0x18, 0xBF, 0x8A, 0xE5, 0x6E, 
-    0xFB, 0x4F, 0xC7, 0xC8, 0xA4, 0x0D, 0x26, 0xF3, 0x41, 0x77, 
-    0x6E, 0xAA, 0xF4, 0xFF, 0xCE, 0xF8, 0xB9, 0xD5, 0x0F, 0x3A, 
-    0x63, 0xE5, 0xA3, 0xAA, 0xDB, 0x71, 0x3B, 0xC7, 0x4E, 0xD7, 
-    0xFC, 0x1A, 0x10, 0x9D, 0x63, 0xC9, 0x03, 0x4F, 0x12, 0xA0, 
-    0xAB, 0xEB, 0xA4, 0x03, 0x70, 0xF7, 0x19, 0x6D, 0x06, 0xD7, 
-    0x34, 0xC8, 0xBF, 0x2B, 0x01, 0xE8, 0x0C, 0x86, 0xDD, 0xF6, 
-    0x4D, 0xAE, 0x37, 0x8D, 0xA7, 0xD3, 0xF3, 0x4D, 0xFB, 0x62, 
-    0x1A, 0xEF, 0x69, 0xCC, 0xA4, 0x31, 0x30, 0x89, 0xE1, 0x4A, 
-    0x1F, 0x3C, 0xB5, 0x51, 0x7A, 0x7E, 0xE5, 0xBC, 0x49, 0xCC, 
-    0x56, 0x12, 0x87, 0xED, 0x71, 0x64, 0x63, 0x5C, 0xE9, 0x8E, 
-    0x77, 0xA7, 0xC4, 0xA5, 0xFA, 0xEC, 0x36, 0x16, 0x10, 0xC9, 
-    0xEF, 0x3F, 0x25, 0x46, 0x93, 0x39, 0xF3, 0xF5, 0x33, 0xD5, 
-    0x36, 0x4E, 0xE6, 0xBD, 0xC7, 0x1D, 0x93, 0xCA, 0x64, 0xF0, 
-    0xBD, 0x6A, 0xF8, 0xE9, 0xC0, 0xBB, 0x75, 0x5E, 0x25, 0x01, 
-    0xA8, 0x04, 0x5D, 0x3A, 0xC9, 0x6D, 0xB4, 0xD5, 0x34, 0x11, 
-    0xDA, 0x98, 0xB0, 0xAB, 0xF7, 0x9B, 0x0C, 0xF0, 0x1B, 0x13, 
-    0x43, 0x35, 0x19, 0xEA, 0x9C, 0xDB, 0xBD, 0xFF, 0xF4, 0x3E, 
-    0xA7, 0xAB, 0xD0, 0xCD, 0x04, 0xA0, 0xB3, 0x2A, 0xD9, 0x3A, 
-    0x9E, 0x24, 0x00, 0x1B, 0x93, 0xFB, 0xA9, 0x0D, 0x26, 0xDF, 
-    0xDF, 0xA9, 0xE6, 0xFC, 0x44, 0x02, 0xB0, 0x59, 0xD5, 0xE8, 
-    0xC6, 0xEE, 0x73, 0xE0, 0xAE, 0x04, 0x68, 0x9A, 0x00, 0x74, 
-    0xDB, 0x3B, 0x89, 0xAD, 0x47, 0x9A, 0xFD, 0x74, 0x06, 0x94, 
-    0xA4, 0x83, 0x74, 0x3B, 0x4F, 0xA5, 0xDC, 0x97, 0x4C, 0x7C, 
-    0x5B, 0x1D, 0x75, 0x52, 0x2A, 0xAB, 0xFE, 0x9E, 0xA4, 0xBC, 
-    0x75, 0x67, 0x02, 0x90, 0x4E, 0xEE, 0x49, 0x60, 0x77, 0xCA, 
-    0xD0, 0xD5, 0x98, 0x9B, 0xAC, 0x48, 0xB7, 0x56, 0xA2, 0x9D, 
-    0xFB, 0x4B, 0xFB, 0x46, 0x27, 0x0E, 0xBA, 0x93, 0x7B, 0x32, 
-    0x88, 0x77, 0xFA, 0x58, 0x75, 0x05, 0xDD, 0x59, 0x6D, 0xA7, 
-    0x89, 0x58, 0x3A, 0xBE, 0x6D, 0x2E, 0xC4, 0x26, 0x65, 0xEE, 
-    0xE9, 0xB1, 0xE9, 0x84, 0x74, 0xC7, 0x22, 0xF4, 0x6A, 0x3C, 
-    0xDA, 0xAE, 0x22, 0x4F, 0xAA, 0xE8, 0xD5, 0xED, 0xD8, 0x64, 
-    0xDC, 0x89, 0xCA, 0xFE, 0xC9, 0xFE, 0xFA, 0x4F, 0x55, 0x00, 
-    0xEE, 0x2C, 0xB3, 0xA7, 0xE5, 0xDC, 0x6E, 0xB0, 0x25, 0x25, 
-    0xC3, 0x4A, 0x69, 0xAA, 0x3B, 0xC9, 0x6C, 0x25, 0x00, 0x9B, 
-    0xD9, 0xEB, 0x55, 0x60, 0x4F, 0x4B, 0xE6, 0xDB, 0x25, 0xBB, 
-    0x3B, 0x57, 0xA2, 0x49, 0xB2, 0x39, 0xDD, 0xDA, 0xDB, 0xA8, 
-    0x80, 0x4D, 0x57, 0xD1, 0x9F, 0x5A, 0x01, 0xE8, 0xF6, 0xCB, 
-    0x4E, 0xBC, 0x4F, 0x2B, 0x8A, 0x93, 0x2A, 0x58, 0xBA, 0xD5, 
-    0x35, 0x9D, 0x33, 0xBA, 0xE3, 0x59, 0xBA, 0x0D, 0x96, 0x2C, 
-    0x76, 0x93, 0x2D, 0xAE, 0x49, 0xD2, 0x9E, 0xF4, 0x9D, 0xD6, 
-    0xDE, 0xFF, 0x5D, 0xE5, 0x8F, 0xBB, 0xDF, 0x01, 0xD8, 0xBA, 
-    0xFF, 0xC9, 0xA0, 0xB7, 0xBD, 0xFF, 0x3D, 0x29, 0xB3, 0x4D, 
-    0x32, 0xCD, 0xAD, 0xE7, 0x50, 0xDD, 0x23, 0x4B, 0x26, 0x82, 
-    0xAD, 0xB6, 0xB8, 0x33, 0x01, 0x48, 0x9E, 0xDB, 0x66, 0x59, 
-    0x76, 0x73, 0xEB, 0x28, 0x4D, 0x00, 0xBA, 0xDB, 0x25, 0xC9, 
-    0x3B, 0x16, 0x9F, 0xF4, 0x0E, 0x40, 0xF7, 0xFD, 0x8A, 0x34, 
-    0x99, 0x9B, 0x8C, 0x15, 0x49, 0xB9, 0x7B, 0x5A, 0xD5, 0xDC, 
-    0x78, 0x61, 0xED, 0xC1, 0xFD, 0xB6, 0x56, 0x76, 0xA7, 0xC9, 
-    0xA8, 0x5B, 0x4A, 0xEA, 0x04, 0x45, 0xB2, 0xAF, 0xD3, 0xCD, 
-    0x24, 0xA7, 0xF7, 0x9A, 0xAC, 0x12, 0x37, 0x3B, 0x6A, 0xB2, 
-    0x2F, 0x39, 0x79, 0xB1, 0x67, 0x23, 0x09, 0xAA, 0x96, 0xC3, 
-    0xAA, 0x93, 0x4E, 0xF7, 0xB7, 0x6C, 0x54, 0x36, 0x92, 0xED, 
-    0xB4, 0xC9, 0x3B, 0x23, 0xDD, 0x55, 0xCB, 0x76, 0x69, 0x3A, 
-    0x59, 0x11, 0x25, 0xDB, 0x6A, 0x1B, 0xE3, 0x52, 0xB7, 0x2F, 
-    0x75, 0x5F, 0x5A, 0xEB, 0xF4, 0xDB, 0x77, 0xA5, 0xDA, 0xC9, 
-    0x7E, 0x79, 0x9A, 0x6C, 0xF1, 0x8B, 0x93, 0x00, 0x01, 0x03, 
-    0x00, 0xBF, 0xBC, 0x12, 0xD0, 0x2D, 0xA3, 0x75, 0xF7, 0x22, 
-    0x26, 0x25, 0x64, 0xE5, 0x22, 0x00, 0xB8, 0x31, 0x01, 0xA8, 
-    0x54, 0x07, 0xBA, 0xE5, 0xAD, 0xEA, 0x1B, 0xAA, 0xD5, 0x17, 
-    0x5A, 0x00, 0x80, 0xC1, 0xC4, 0x3F, 0xD9, 0x8B, 0xBC, 0x4A, 
-    0x20, 0x4E, 0x09, 0x80, 0xC9, 0x1D, 0x00, 0xFE, 0xA3, 0x0A, 
-    0xC0, 0xDA, 0xBF, 0x21, 0x00, 0x00, 0x9F, 0x95, 0x00, 0x6C, 
-    0xFC, 0x0B, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0A, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x0A, 0x23, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x20, 
+    0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x34, 0x5F, 0x76, 0x65, 
+    0x72, 0x74, 0x65, 0x78, 0x0A, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x23, 0x76, 0x65, 
+    0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x31, 0x30, 0x30, 0x0A, 
+    0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 
+    0x76, 0x65, 0x63, 0x33, 0x20, 0x61, 0x5F, 0x63, 0x6F, 0x72, 
+    0x6E, 0x65, 0x72, 0x3B, 0x0A, 0x61, 0x74, 0x74, 0x72, 0x69, 
+    0x62, 0x75, 0x74, 0x65, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 
+    0x61, 0x5F, 0x65, 0x6E, 0x64, 0x73, 0x3B, 0x0A, 0x75, 0x6E, 
+    0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x76, 0x65, 0x63, 0x34, 
+    0x20, 0x75, 0x5F, 0x70, 0x72, 0x6F, 0x6A, 0x3B, 0x20, 0x2F, 
+    0x2F, 0x20, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x20, 0x78, 0x79, 
+    0x2C, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x7A, 
+    0x77, 0x0A, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 
+    0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x75, 0x5F, 0x77, 0x69, 
+    0x64, 0x74, 0x68, 0x3B, 0x0A, 0x76, 0x6F, 0x69, 0x64, 0x20, 
+    0x6D, 0x61, 0x69, 0x6E, 0x28, 0x29, 0x0A, 0x7B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x64, 0x65, 
+    0x6C, 0x74, 0x61, 0x20, 0x3D, 0x20, 0x61, 0x5F, 0x65, 0x6E, 
+    0x64, 0x73, 0x2E, 0x7A, 0x77, 0x20, 0x2D, 0x20, 0x61, 0x5F, 
+    0x65, 0x6E, 0x64, 0x73, 0x2E, 0x78, 0x79, 0x3B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x6C, 
+    0x65, 0x6E, 0x20, 0x3D, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 
+    0x68, 0x28, 0x20, 0x64, 0x65, 0x6C, 0x74, 0x61, 0x20, 0x29, 
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x63, 0x32, 
+    0x20, 0x64, 0x69, 0x72, 0x20, 0x3D, 0x20, 0x6C, 0x65, 0x6E, 
+    0x20, 0x3E, 0x20, 0x30, 0x2E, 0x30, 0x20, 0x3F, 0x20, 0x64, 
+    0x65, 0x6C, 0x74, 0x61, 0x20, 0x2F, 0x20, 0x6C, 0x65, 0x6E, 
+    0x20, 0x3A, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x20, 0x31, 
+    0x2E, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x20, 0x29, 0x3B, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 
+    0x6E, 0x6F, 0x72, 0x6D, 0x61, 0x6C, 0x20, 0x3D, 0x20, 0x76, 
+    0x65, 0x63, 0x32, 0x28, 0x20, 0x2D, 0x64, 0x69, 0x72, 0x2E, 
+    0x79, 0x2C, 0x20, 0x64, 0x69, 0x72, 0x2E, 0x78, 0x20, 0x29, 
+    0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x63, 
+    0x32, 0x20, 0x70, 0x6F, 0x73, 0x20, 0x3D, 0x20, 0x6D, 0x69, 
+    0x78, 0x28, 0x20, 0x61, 0x5F, 0x65, 0x6E, 0x64, 0x73, 0x2E, 
+    0x78, 0x79, 0x2C, 0x20, 0x61, 0x5F, 0x65, 0x6E, 0x64, 0x73, 
+    0x2E, 0x7A, 0x77, 0x2C, 0x20, 0x61, 0x5F, 0x63, 0x6F, 0x72, 
+    0x6E, 0x65, 0x72, 0x2E, 0x78, 0x20, 0x29, 0x3B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x70, 0x6F, 0x73, 0x20, 0x2B, 0x3D, 0x20, 
+    0x28, 0x20, 0x64, 0x69, 0x72, 0x20, 0x2A, 0x20, 0x61, 0x5F, 
+    0x63, 0x6F, 0x72, 0x6E, 0x65, 0x72, 0x2E, 0x79, 0x20, 0x2B, 
+    0x20, 0x6E, 0x6F, 0x72, 0x6D, 0x61, 0x6C, 0x20, 0x2A, 0x20, 
+    0x61, 0x5F, 0x63, 0x6F, 0x72, 0x6E, 0x65, 0x72, 0x2E, 0x7A, 
+    0x20, 0x29, 0x20, 0x2A, 0x20, 0x75, 0x5F, 0x77, 0x69, 0x64, 
+    0x74, 0x68, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6C, 
+    0x5F, 0x50, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 
+    0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x20, 0x70, 0x6F, 
+    0x73, 0x20, 0x2A, 0x20, 0x75, 0x5F, 0x70, 0x72, 0x6F, 0x6A, 
+    0x2E, 0x78, 0x79, 0x20, 0x2B, 0x20, 0x75, 0x5F, 0x70, 0x72, 
+    0x6F, 0x6A, 0x2E, 0x7A, 0x77, 0x2C, 0x20, 0x30, 0x2E, 0x30, 
+    0x2C, 0x20, 0x31, 0x2E, 0x30, 0x20, 0x29, 0x3B, 0x0A, 0x7D, 
+    0x0A, 0x0A, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x0A, 0x23, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 
+    0x20, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x34, 0x5F, 0x66, 
+    0x72, 0x61, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x0A, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 
+    0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x31, 
+    0x30, 0x30, 0x0A, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 
+    0x6F, 0x6E, 0x20, 0x6C, 0x6F, 0x77, 0x70, 0x20, 0x66, 0x6C, 
+    0x6F, 0x61, 0x74, 0x3B, 0x0A, 0x75, 0x6E, 0x69, 0x66, 0x6F, 
+    0x72, 0x6D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x5F, 
+    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x76, 0x6F, 0x69, 
+    0x64, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x28, 0x29, 0x0A, 0x7B, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6C, 0x5F, 0x46, 0x72, 
+    0x61, 0x67, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 
+    0x75, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x7D, 
+    0x0A, 0x0A, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x0A, 0x23, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 
+    0x20, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x35, 0x5F, 0x76, 
+    0x65, 0x72, 0x74, 0x65, 0x78, 0x0A, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x23, 0x76, 
+    0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x31, 0x30, 0x30, 
+    0x0A, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 
+    0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x61, 0x5F, 0x70, 0x6F, 
+    0x73, 0x3B, 0x0A, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 
+    0x74, 0x65, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x61, 0x5F, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x3B, 0x0A, 0x61, 0x74, 0x74, 
+    0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x76, 0x65, 0x63, 
+    0x33, 0x20, 0x61, 0x5F, 0x73, 0x68, 0x61, 0x70, 0x65, 0x3B, 
+    0x0A, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 
+    0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x61, 0x5F, 0x63, 0x6F, 
+    0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x75, 0x6E, 0x69, 0x66, 0x6F, 
+    0x72, 0x6D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x5F, 
+    0x70, 0x72, 0x6F, 0x6A, 0x3B, 0x20, 0x2F, 0x2F, 0x20, 0x73, 
+    0x63, 0x61, 0x6C, 0x65, 0x20, 0x78, 0x79, 0x2C, 0x20, 0x6F, 
+    0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x7A, 0x77, 0x0A, 0x76, 
+    0x61, 0x72, 0x79, 0x69, 0x6E, 0x67, 0x20, 0x76, 0x65, 0x63, 
+    0x32, 0x20, 0x76, 0x5F, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x3B, 
+    0x0A, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6E, 0x67, 0x20, 0x76, 
+    0x65, 0x63, 0x33, 0x20, 0x76, 0x5F, 0x73, 0x68, 0x61, 0x70, 
+    0x65, 0x3B, 0x0A, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6E, 0x67, 
+    0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x76, 0x5F, 0x63, 0x6F, 
+    0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x76, 0x6F, 0x69, 0x64, 0x20, 
+    0x6D, 0x61, 0x69, 0x6E, 0x28, 0x29, 0x0A, 0x7B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x76, 0x5F, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x3D, 0x20, 0x61, 0x5F, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x5F, 0x73, 0x68, 
+    0x61, 0x70, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x5F, 0x73, 0x68, 
+    0x61, 0x70, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 
+    0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x61, 
+    0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x67, 0x6C, 0x5F, 0x50, 0x6F, 0x73, 0x69, 0x74, 
+    0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 
+    0x28, 0x20, 0x61, 0x5F, 0x70, 0x6F, 0x73, 0x20, 0x2A, 0x20, 
+    0x75, 0x5F, 0x70, 0x72, 0x6F, 0x6A, 0x2E, 0x78, 0x79, 0x20, 
+    0x2B, 0x20, 0x75, 0x5F, 0x70, 0x72, 0x6F, 0x6A, 0x2E, 0x7A, 
+    0x77, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 
+    0x30, 0x20, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x23, 
+    0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x20, 0x73, 0x68, 0x61, 
+    0x64, 0x65, 0x72, 0x35, 0x5F, 0x66, 0x72, 0x61, 0x67, 0x6D, 
+    0x65, 0x6E, 0x74, 0x0A, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 
+    0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x23, 0x76, 0x65, 0x72, 
+    0x73, 0x69, 0x6F, 0x6E, 0x20, 0x31, 0x30, 0x30, 0x0A, 0x70, 
+    0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6D, 
+    0x65, 0x64, 0x69, 0x75, 0x6D, 0x70, 0x20, 0x66, 0x6C, 0x6F, 
+    0x61, 0x74, 0x3B, 0x0A, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6E, 
+    0x67, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x76, 0x5F, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x3B, 0x20, 0x2F, 0x2F, 0x20, 0x72, 
+    0x61, 0x64, 0x69, 0x75, 0x73, 0x20, 0x75, 0x6E, 0x69, 0x74, 
+    0x73, 0x2C, 0x20, 0x63, 0x6F, 0x72, 0x6E, 0x65, 0x72, 0x73, 
+    0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x6E, 
+    0x69, 0x74, 0x20, 0x63, 0x69, 0x72, 0x63, 0x6C, 0x65, 0x0A, 
+    0x76, 0x61, 0x72, 0x79, 0x69, 0x6E, 0x67, 0x20, 0x76, 0x65, 
+    0x63, 0x33, 0x20, 0x76, 0x5F, 0x73, 0x68, 0x61, 0x70, 0x65, 
+    0x3B, 0x20, 0x2F, 0x2F, 0x20, 0x73, 0x69, 0x64, 0x65, 0x73, 
+    0x20, 0x28, 0x30, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x20, 
+    0x63, 0x69, 0x72, 0x63, 0x6C, 0x65, 0x29, 0x2C, 0x20, 0x72, 
+    0x69, 0x6E, 0x67, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 
+    0x20, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x20, 0x73, 0x69, 0x7A, 
+    0x65, 0x0A, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6E, 0x67, 0x20, 
+    0x76, 0x65, 0x63, 0x34, 0x20, 0x76, 0x5F, 0x63, 0x6F, 0x6C, 
+    0x6F, 0x72, 0x3B, 0x0A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x6D, 
+    0x61, 0x69, 0x6E, 0x28, 0x29, 0x0A, 0x7B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x6C, 0x65, 
+    0x6E, 0x20, 0x3D, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 
+    0x28, 0x20, 0x76, 0x5F, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 0x6F, 
+    0x61, 0x74, 0x20, 0x64, 0x20, 0x3D, 0x20, 0x6C, 0x65, 0x6E, 
+    0x20, 0x2D, 0x20, 0x31, 0x2E, 0x30, 0x3B, 0x0A, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x64, 0x69, 0x73, 0x74, 
+    0x61, 0x6E, 0x63, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x65, 0x64, 0x67, 0x65, 0x20, 0x66, 0x61, 0x63, 
+    0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x72, 
+    0x61, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x20, 0x65, 0x64, 
+    0x67, 0x65, 0x73, 0x20, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 
+    0x65, 0x64, 0x20, 0x61, 0x74, 0x20, 0x6F, 0x64, 0x64, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x6D, 0x75, 0x6C, 
+    0x74, 0x69, 0x70, 0x6C, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 
+    0x70, 0x69, 0x20, 0x2F, 0x20, 0x73, 0x69, 0x64, 0x65, 0x73, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 
+    0x76, 0x5F, 0x73, 0x68, 0x61, 0x70, 0x65, 0x2E, 0x78, 0x20, 
+    0x3E, 0x20, 0x30, 0x2E, 0x30, 0x20, 0x29, 0x20, 0x7B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 
+    0x6F, 0x61, 0x74, 0x20, 0x68, 0x61, 0x6C, 0x66, 0x5F, 0x61, 
+    0x6E, 0x67, 0x6C, 0x65, 0x20, 0x3D, 0x20, 0x33, 0x2E, 0x31, 
+    0x34, 0x31, 0x35, 0x39, 0x32, 0x36, 0x35, 0x20, 0x2F, 0x20, 
+    0x76, 0x5F, 0x73, 0x68, 0x61, 0x70, 0x65, 0x2E, 0x78, 0x3B, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 
+    0x6C, 0x6F, 0x61, 0x74, 0x20, 0x61, 0x20, 0x3D, 0x20, 0x61, 
+    0x74, 0x61, 0x6E, 0x28, 0x20, 0x76, 0x5F, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x2E, 0x79, 0x2C, 0x20, 0x76, 0x5F, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x2E, 0x78, 0x20, 0x29, 0x3B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 0x6F, 
+    0x61, 0x74, 0x20, 0x70, 0x68, 0x69, 0x20, 0x3D, 0x20, 0x6D, 
+    0x6F, 0x64, 0x28, 0x20, 0x61, 0x2C, 0x20, 0x32, 0x2E, 0x30, 
+    0x20, 0x2A, 0x20, 0x68, 0x61, 0x6C, 0x66, 0x5F, 0x61, 0x6E, 
+    0x67, 0x6C, 0x65, 0x20, 0x29, 0x20, 0x2D, 0x20, 0x68, 0x61, 
+    0x6C, 0x66, 0x5F, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x3B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x20, 
+    0x3D, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x2A, 0x20, 0x63, 0x6F, 
+    0x73, 0x28, 0x20, 0x70, 0x68, 0x69, 0x20, 0x29, 0x20, 0x2D, 
+    0x20, 0x63, 0x6F, 0x73, 0x28, 0x20, 0x68, 0x61, 0x6C, 0x66, 
+    0x5F, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x20, 0x29, 0x3B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 0x76, 0x5F, 0x73, 0x68, 
+    0x61, 0x70, 0x65, 0x2E, 0x79, 0x20, 0x3E, 0x20, 0x30, 0x2E, 
+    0x30, 0x20, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x64, 0x20, 0x3D, 0x20, 0x61, 0x62, 
+    0x73, 0x28, 0x20, 0x64, 0x20, 0x2B, 0x20, 0x76, 0x5F, 0x73, 
+    0x68, 0x61, 0x70, 0x65, 0x2E, 0x79, 0x20, 0x2A, 0x20, 0x30, 
+    0x2E, 0x35, 0x20, 0x29, 0x20, 0x2D, 0x20, 0x76, 0x5F, 0x73, 
+    0x68, 0x61, 0x70, 0x65, 0x2E, 0x79, 0x20, 0x2A, 0x20, 0x30, 
+    0x2E, 0x35, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 
+    0x20, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x61, 0x67, 0x65, 0x20, 
+    0x3D, 0x20, 0x63, 0x6C, 0x61, 0x6D, 0x70, 0x28, 0x20, 0x30, 
+    0x2E, 0x35, 0x20, 0x2D, 0x20, 0x64, 0x20, 0x2F, 0x20, 0x76, 
+    0x5F, 0x73, 0x68, 0x61, 0x70, 0x65, 0x2E, 0x7A, 0x2C, 0x20, 
+    0x30, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x20, 0x29, 
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6C, 0x5F, 0x46, 
+    0x72, 0x61, 0x67, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 
+    0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x20, 0x76, 0x5F, 0x63, 
+    0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x72, 0x67, 0x62, 0x2C, 0x20, 
+    0x76, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x61, 0x20, 
+    0x2A, 0x20, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x61, 0x67, 0x65, 
+    0x20, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x00, 0x00, 0x42, 0x46, 
+    0x4E, 0x54, 0x01, 0x00, 0x00, 0x00, 0x50, 0x78, 0x50, 0x6C, 
+    0x75, 0x73, 0x20, 0x49, 0x42, 0x4D, 0x20, 0x42, 0x49, 0x4F, 
+    0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x62, 0x69, 0x74, 0x2E, 0x70, 0x6E, 0x67, 0x00, 0x00, 0x00, 
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 
+    0x00, 0x02, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
@@ -410,1448 +606,602 @@ unsigned char res_data[] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x98, 0x3F, 0xE8, 0x87, 
-    0x52, 0x62, 0xB9, 0xCA, 0x54, 0xC6, 0x00, 0x00, 0x00, 0x00, 
-    0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82, 
-    0x69, 0x6E, 0x66, 0x6F, 0x20, 0x66, 0x61, 0x63, 0x65, 0x3D, 
-    0x22, 0x50, 0x78, 0x50, 0x6C, 0x75, 0x73, 0x20, 0x49, 0x42, 
-    0x4D, 0x20, 0x42, 0x49, 0x4F, 0x53, 0x22, 0x20, 0x73, 0x69, 
-    0x7A, 0x65, 0x3D, 0x38, 0x20, 0x62, 0x6F, 0x6C, 0x64, 0x3D, 
-    0x30, 0x20, 0x69, 0x74, 0x61, 0x6C, 0x69, 0x63, 0x3D, 0x30, 
-    0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 0x3D, 0x22, 
-    0x22, 0x20, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x3D, 
-    0x30, 0x20, 0x73, 0x74, 0x72, 0x65, 0x74, 0x63, 0x68, 0x48, 
-    0x3D, 0x31, 0x30, 0x30, 0x20, 0x73, 0x6D, 0x6F, 0x6F, 0x74, 
-    0x68, 0x3D, 0x31, 0x20, 0x61, 0x61, 0x3D, 0x31, 0x20, 0x70, 
-    0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3D, 0x30, 0x2C, 0x30, 
-    0x2C, 0x30, 0x2C, 0x30, 0x20, 0x73, 0x70, 0x61, 0x63, 0x69, 
-    0x6E, 0x67, 0x3D, 0x30, 0x2C, 0x30, 0x0A, 0x63, 0x6F, 0x6D, 
-    0x6D, 0x6F, 0x6E, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x48, 0x65, 
-    0x69, 0x67, 0x68, 0x74, 0x3D, 0x38, 0x20, 0x62, 0x61, 0x73, 
-    0x65, 0x3D, 0x37, 0x20, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x57, 
-    0x3D, 0x35, 0x31, 0x32, 0x20, 0x73, 0x63, 0x61, 0x6C, 0x65, 
-    0x48, 0x3D, 0x35, 0x31, 0x32, 0x20, 0x70, 0x61, 0x67, 0x65, 
-    0x73, 0x3D, 0x31, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x65, 0x64, 
-    0x3D, 0x30, 0x0A, 0x70, 0x61, 0x67, 0x65, 0x20, 0x69, 0x64, 
-    0x3D, 0x30, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x3D, 0x22, 0x62, 
-    0x69, 0x74, 0x2E, 0x70, 0x6E, 0x67, 0x22, 0x0A, 0x63, 0x68, 
-    0x61, 0x72, 0x73, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x3D, 
-    0x39, 0x38, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 
-    0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 
-    0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 
-    0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 
-    0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 
-    0x64, 0x3D, 0x31, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x78, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
-    0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 
-    0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 
-    0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 
-    0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 
-    0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 
-    0x69, 0x64, 0x3D, 0x33, 0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x78, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 
-    0x68, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 
-    0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 
-    0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 
-    0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 
-    0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 
-    0x20, 0x69, 0x64, 0x3D, 0x33, 0x33, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x78, 0x3D, 0x32, 0x38, 0x36, 0x20, 0x20, 0x79, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 
-    0x68, 0x3D, 0x34, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 
-    0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x78, 
-    0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x31, 0x20, 0x20, 
-    0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 
-    0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 
-    0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 
-    0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 
-    0x72, 0x20, 0x69, 0x64, 0x3D, 0x33, 0x34, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x78, 0x3D, 0x32, 0x37, 0x20, 0x20, 0x20, 
-    0x79, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 
-    0x74, 0x68, 0x3D, 0x35, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 
-    0x69, 0x67, 0x68, 0x74, 0x3D, 0x33, 0x20, 0x20, 0x20, 0x20, 
-    0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x31, 0x20, 
-    0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 
-    0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 
-    0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 
-    0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x33, 0x35, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x33, 0x36, 0x33, 0x20, 
-    0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 
-    0x64, 0x74, 0x68, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x68, 
-    0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 
-    0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 
-    0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 
-    0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 
-    0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 
-    0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x33, 0x36, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x33, 0x35, 0x37, 
-    0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 
-    0x69, 0x64, 0x74, 0x68, 0x3D, 0x36, 0x20, 0x20, 0x20, 0x20, 
-    0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 
-    0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 
-    0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 
-    0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 
-    0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 
-    0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x33, 0x37, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x34, 0x30, 
-    0x39, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x37, 0x20, 0x20, 0x20, 
-    0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x36, 0x20, 
-    0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 
-    0x73, 0x65, 0x74, 0x3D, 0x31, 0x20, 0x20, 0x20, 0x20, 0x78, 
-    0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 
-    0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 
-    0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x33, 
-    0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x33, 
-    0x37, 0x30, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x37, 0x20, 0x20, 
-    0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 
-    0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 
-    0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 
-    0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 
-    0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 
-    0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 
-    0x33, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 
-    0x33, 0x32, 0x20, 0x20, 0x20, 0x79, 0x3D, 0x38, 0x20, 0x20, 
-    0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x33, 0x20, 
-    0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 
-    0x33, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 
-    0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 
-    0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 
-    0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 
-    0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 
-    0x3D, 0x34, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 
-    0x3D, 0x32, 0x39, 0x36, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x34, 
-    0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 
-    0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 
-    0x73, 0x65, 0x74, 0x3D, 0x31, 0x20, 0x20, 0x20, 0x20, 0x79, 
-    0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 
-    0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 
-    0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 
-    0x64, 0x3D, 0x34, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x78, 0x3D, 0x33, 0x30, 0x30, 0x20, 0x20, 0x79, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 
-    0x34, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
-    0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 
-    0x66, 0x73, 0x65, 0x74, 0x3D, 0x31, 0x20, 0x20, 0x20, 0x20, 
-    0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 
-    0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 
-    0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 
-    0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 
-    0x69, 0x64, 0x3D, 0x34, 0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x78, 0x3D, 0x36, 0x20, 0x20, 0x20, 0x20, 0x79, 0x3D, 
-    0x38, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 
-    0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 
-    0x68, 0x74, 0x3D, 0x35, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 
-    0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x31, 
-    0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 
-    0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 
-    0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 
-    0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 
-    0x20, 0x69, 0x64, 0x3D, 0x34, 0x33, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x78, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 
-    0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 
-    0x68, 0x3D, 0x36, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 
-    0x67, 0x68, 0x74, 0x3D, 0x35, 0x20, 0x20, 0x20, 0x20, 0x78, 
-    0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 
-    0x31, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 
-    0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 
-    0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 
-    0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 
-    0x72, 0x20, 0x69, 0x64, 0x3D, 0x34, 0x34, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x78, 0x3D, 0x33, 0x32, 0x20, 0x20, 0x20, 
-    0x79, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 
-    0x74, 0x68, 0x3D, 0x33, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 
-    0x69, 0x67, 0x68, 0x74, 0x3D, 0x33, 0x20, 0x20, 0x20, 0x20, 
-    0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x31, 0x20, 
-    0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 
-    0x3D, 0x35, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 
-    0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 
-    0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 
-    0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x34, 0x35, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x34, 0x34, 0x20, 0x20, 
-    0x20, 0x79, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 
-    0x64, 0x74, 0x68, 0x3D, 0x36, 0x20, 0x20, 0x20, 0x20, 0x68, 
-    0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x31, 0x20, 0x20, 0x20, 
-    0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 
-    0x74, 0x3D, 0x33, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 
-    0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 
-    0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 
-    0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x34, 0x36, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x33, 0x35, 0x20, 
-    0x20, 0x20, 0x79, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x77, 
-    0x69, 0x64, 0x74, 0x68, 0x3D, 0x32, 0x20, 0x20, 0x20, 0x20, 
-    0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x32, 0x20, 0x20, 
-    0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 
-    0x32, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 
-    0x65, 0x74, 0x3D, 0x35, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 
-    0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 
-    0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 
-    0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x34, 0x37, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x33, 0x33, 
-    0x36, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x37, 0x20, 0x20, 0x20, 
-    0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 
-    0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 
-    0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 
-    0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 
-    0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 
-    0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x34, 
-    0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x32, 
-    0x37, 0x39, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x37, 0x20, 0x20, 
-    0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 
-    0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 
-    0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 
-    0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 
-    0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 
-    0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 
-    0x34, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 
-    0x32, 0x32, 0x34, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x36, 0x20, 
-    0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 
-    0x37, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 
-    0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 
-    0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 
-    0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 
-    0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 
-    0x3D, 0x35, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 
-    0x3D, 0x32, 0x33, 0x30, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x36, 
-    0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 
-    0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 
-    0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 
-    0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 
-    0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 
-    0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 
-    0x64, 0x3D, 0x35, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x78, 0x3D, 0x32, 0x33, 0x36, 0x20, 0x20, 0x79, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 
-    0x36, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
-    0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 
-    0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 
-    0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 
-    0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 
-    0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 
-    0x69, 0x64, 0x3D, 0x35, 0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x78, 0x3D, 0x32, 0x34, 0x32, 0x20, 0x20, 0x79, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 
-    0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 
-    0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 
-    0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 
-    0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 
-    0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 
-    0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 
-    0x20, 0x69, 0x64, 0x3D, 0x35, 0x33, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x78, 0x3D, 0x32, 0x34, 0x39, 0x20, 0x20, 0x79, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 
-    0x68, 0x3D, 0x36, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 
-    0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x78, 
-    0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 
-    0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 
-    0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 
-    0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 
-    0x72, 0x20, 0x69, 0x64, 0x3D, 0x35, 0x34, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x78, 0x3D, 0x32, 0x35, 0x35, 0x20, 0x20, 
-    0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 
-    0x74, 0x68, 0x3D, 0x36, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 
-    0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 
-    0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 
-    0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 
-    0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 
-    0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x35, 0x35, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x32, 0x36, 0x31, 0x20, 
-    0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 
-    0x64, 0x74, 0x68, 0x3D, 0x36, 0x20, 0x20, 0x20, 0x20, 0x68, 
-    0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 
-    0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 
-    0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 
-    0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 
-    0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 
-    0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x35, 0x36, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x32, 0x36, 0x37, 
-    0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 
-    0x69, 0x64, 0x74, 0x68, 0x3D, 0x36, 0x20, 0x20, 0x20, 0x20, 
-    0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 
-    0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 
-    0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 
-    0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 
-    0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 
-    0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x35, 0x37, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x32, 0x37, 
-    0x33, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x36, 0x20, 0x20, 0x20, 
-    0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 
-    0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 
-    0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 
-    0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 
-    0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 
-    0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x35, 
-    0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x34, 
-    0x30, 0x37, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x32, 0x20, 0x20, 
-    0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x36, 
-    0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 
-    0x74, 0x3D, 0x32, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 
-    0x66, 0x73, 0x65, 0x74, 0x3D, 0x31, 0x20, 0x20, 0x20, 0x20, 
-    0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 
-    0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 
-    0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 
-    0x35, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 
-    0x34, 0x30, 0x34, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x33, 0x20, 
-    0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 
-    0x36, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 
-    0x65, 0x74, 0x3D, 0x31, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 
-    0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x31, 0x20, 0x20, 0x20, 
-    0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 
-    0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 
-    0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 
-    0x3D, 0x36, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 
-    0x3D, 0x33, 0x32, 0x34, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x35, 
-    0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 
-    0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 
-    0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 
-    0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 
-    0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 
-    0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 
-    0x64, 0x3D, 0x36, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x78, 0x3D, 0x32, 0x31, 0x20, 0x20, 0x20, 0x79, 0x3D, 0x38, 
-    0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 
-    0x36, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
-    0x74, 0x3D, 0x34, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 
-    0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x32, 0x20, 
-    0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 
-    0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 
-    0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 
-    0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 
-    0x69, 0x64, 0x3D, 0x36, 0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x78, 0x3D, 0x33, 0x32, 0x39, 0x20, 0x20, 0x79, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 
-    0x3D, 0x35, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 
-    0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 
-    0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x31, 0x20, 0x20, 0x20, 
-    0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 
-    0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 
-    0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 
-    0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 
-    0x20, 0x69, 0x64, 0x3D, 0x36, 0x33, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x78, 0x3D, 0x32, 0x39, 0x30, 0x20, 0x20, 0x79, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 
-    0x68, 0x3D, 0x36, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 
-    0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x78, 
-    0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 
-    0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 
-    0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 
-    0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 
-    0x72, 0x20, 0x69, 0x64, 0x3D, 0x36, 0x34, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x78, 0x3D, 0x33, 0x34, 0x33, 0x20, 0x20, 
-    0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 
-    0x74, 0x68, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 
-    0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 
-    0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 
-    0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 
-    0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 
-    0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x36, 0x35, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x36, 0x20, 0x20, 0x20, 
-    0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 
-    0x64, 0x74, 0x68, 0x3D, 0x36, 0x20, 0x20, 0x20, 0x20, 0x68, 
-    0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 
-    0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 
-    0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 
-    0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 
-    0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 
-    0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x36, 0x36, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x31, 0x32, 0x20, 
-    0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 
-    0x69, 0x64, 0x74, 0x68, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 
-    0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 
-    0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 
-    0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 
-    0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 
-    0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 
-    0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x36, 0x37, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x31, 0x39, 
-    0x20, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x37, 0x20, 0x20, 0x20, 
-    0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 
-    0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 
-    0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 
-    0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 
-    0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 
-    0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x36, 
-    0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x32, 
-    0x36, 0x20, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x37, 0x20, 0x20, 
-    0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 
-    0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 
-    0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 
-    0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 
-    0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 
-    0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 
-    0x36, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 
-    0x33, 0x33, 0x20, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x37, 0x20, 
-    0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 
-    0x37, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 
-    0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 
-    0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 
-    0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 
-    0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 
-    0x3D, 0x37, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 
-    0x3D, 0x34, 0x30, 0x20, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x37, 
-    0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 
-    0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 
-    0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 
-    0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 
-    0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 
-    0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 
-    0x64, 0x3D, 0x37, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x78, 0x3D, 0x34, 0x37, 0x20, 0x20, 0x20, 0x79, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 
-    0x37, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
-    0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 
-    0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 
-    0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 
-    0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 
-    0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 
-    0x69, 0x64, 0x3D, 0x37, 0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x78, 0x3D, 0x35, 0x34, 0x20, 0x20, 0x20, 0x79, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 
-    0x3D, 0x36, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 
-    0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 
-    0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 
-    0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 
-    0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 
-    0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 
-    0x20, 0x69, 0x64, 0x3D, 0x37, 0x33, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x78, 0x3D, 0x36, 0x30, 0x20, 0x20, 0x20, 0x79, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 
-    0x68, 0x3D, 0x34, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 
-    0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x78, 
-    0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x31, 0x20, 0x20, 
-    0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 
-    0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 
-    0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 
-    0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 
-    0x72, 0x20, 0x69, 0x64, 0x3D, 0x37, 0x34, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x78, 0x3D, 0x36, 0x34, 0x20, 0x20, 0x20, 
-    0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 
-    0x74, 0x68, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 
-    0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 
-    0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 
-    0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 
-    0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 
-    0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x37, 0x35, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x37, 0x31, 0x20, 0x20, 
-    0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 
-    0x64, 0x74, 0x68, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x68, 
-    0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 
-    0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 
-    0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 
-    0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 
-    0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 
-    0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x37, 0x36, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x37, 0x38, 0x20, 
-    0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 
-    0x69, 0x64, 0x74, 0x68, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 
-    0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 
-    0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 
-    0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 
-    0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 
-    0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 
-    0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x37, 0x37, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x38, 0x35, 
-    0x20, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x37, 0x20, 0x20, 0x20, 
-    0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 
-    0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 
-    0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 
-    0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 
-    0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 
-    0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x37, 
-    0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x39, 
-    0x32, 0x20, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x37, 0x20, 0x20, 
-    0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 
-    0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 
-    0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 
-    0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 
-    0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 
-    0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 
-    0x37, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 
-    0x39, 0x39, 0x20, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x37, 0x20, 
-    0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 
-    0x37, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 
-    0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 
-    0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 
-    0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 
-    0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 
-    0x3D, 0x38, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 
-    0x3D, 0x31, 0x30, 0x36, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x37, 
-    0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 
-    0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 
-    0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 
-    0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 
-    0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 
-    0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 
-    0x64, 0x3D, 0x38, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x78, 0x3D, 0x31, 0x31, 0x33, 0x20, 0x20, 0x79, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 
-    0x36, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
-    0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 
-    0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 
-    0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 
-    0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 
-    0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 
-    0x69, 0x64, 0x3D, 0x38, 0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x78, 0x3D, 0x31, 0x31, 0x39, 0x20, 0x20, 0x79, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 
-    0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 
-    0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 
-    0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 
-    0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 
-    0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 
-    0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 
-    0x20, 0x69, 0x64, 0x3D, 0x38, 0x33, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x78, 0x3D, 0x31, 0x32, 0x36, 0x20, 0x20, 0x79, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 
-    0x68, 0x3D, 0x36, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 
-    0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x78, 
-    0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 
-    0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 
-    0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 
-    0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 
-    0x72, 0x20, 0x69, 0x64, 0x3D, 0x38, 0x34, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x78, 0x3D, 0x31, 0x33, 0x32, 0x20, 0x20, 
-    0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 
-    0x74, 0x68, 0x3D, 0x36, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 
-    0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 
-    0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 
-    0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 
-    0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 
-    0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x38, 0x35, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x31, 0x33, 0x38, 0x20, 
-    0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 
-    0x64, 0x74, 0x68, 0x3D, 0x36, 0x20, 0x20, 0x20, 0x20, 0x68, 
-    0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 
-    0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 
-    0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 
-    0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 
-    0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 
-    0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x38, 0x36, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x31, 0x34, 0x34, 
-    0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 
-    0x69, 0x64, 0x74, 0x68, 0x3D, 0x36, 0x20, 0x20, 0x20, 0x20, 
-    0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 
-    0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 
-    0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 
-    0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 
-    0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 
-    0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x38, 0x37, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x31, 0x35, 
-    0x30, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x37, 0x20, 0x20, 0x20, 
-    0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 
-    0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 
-    0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 
-    0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 
-    0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 
-    0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x38, 
-    0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x31, 
-    0x35, 0x37, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x37, 0x20, 0x20, 
-    0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 
-    0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 
-    0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 
-    0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 
-    0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 
-    0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 
-    0x38, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 
-    0x31, 0x36, 0x34, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x36, 0x20, 
-    0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 
-    0x37, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 
-    0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 
-    0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 
-    0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 
-    0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 
-    0x3D, 0x39, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 
-    0x3D, 0x31, 0x37, 0x30, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x37, 
-    0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 
-    0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 
-    0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 
-    0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 
-    0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 
-    0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 
-    0x64, 0x3D, 0x39, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x78, 0x3D, 0x33, 0x30, 0x34, 0x20, 0x20, 0x79, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 
-    0x34, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
-    0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 
-    0x66, 0x73, 0x65, 0x74, 0x3D, 0x31, 0x20, 0x20, 0x20, 0x20, 
-    0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 
-    0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 
-    0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 
-    0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 
-    0x69, 0x64, 0x3D, 0x39, 0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x78, 0x3D, 0x33, 0x35, 0x30, 0x20, 0x20, 0x79, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 
-    0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 
-    0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 
-    0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 
-    0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 
-    0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 
-    0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 
-    0x20, 0x69, 0x64, 0x3D, 0x39, 0x33, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x78, 0x3D, 0x33, 0x30, 0x38, 0x20, 0x20, 0x79, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 
-    0x68, 0x3D, 0x34, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 
-    0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x78, 
-    0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x31, 0x20, 0x20, 
-    0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 
-    0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 
-    0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 
-    0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 
-    0x72, 0x20, 0x69, 0x64, 0x3D, 0x39, 0x34, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x78, 0x3D, 0x31, 0x34, 0x20, 0x20, 0x20, 
-    0x79, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 
-    0x74, 0x68, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 
-    0x69, 0x67, 0x68, 0x74, 0x3D, 0x34, 0x20, 0x20, 0x20, 0x20, 
-    0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 
-    0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 
-    0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 
-    0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x39, 0x35, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x34, 0x34, 0x20, 0x20, 
-    0x20, 0x79, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 
-    0x64, 0x74, 0x68, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x68, 
-    0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x31, 0x20, 0x20, 0x20, 
-    0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 
-    0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 
-    0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 
-    0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 
-    0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x39, 0x36, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x35, 0x30, 0x37, 
-    0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 
-    0x69, 0x64, 0x74, 0x68, 0x3D, 0x33, 0x20, 0x20, 0x20, 0x20, 
-    0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x33, 0x20, 0x20, 
-    0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 
-    0x32, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 
-    0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 
-    0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 
-    0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 
-    0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x39, 0x37, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x34, 0x32, 
-    0x33, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x37, 0x20, 0x20, 0x20, 
-    0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x35, 0x20, 
-    0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 
-    0x73, 0x65, 0x74, 0x3D, 0x32, 0x20, 0x20, 0x20, 0x20, 0x78, 
-    0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 
-    0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 
-    0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x39, 
-    0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x31, 
-    0x37, 0x37, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x37, 0x20, 0x20, 
-    0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 
-    0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 
-    0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 
-    0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 
-    0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 
-    0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 
-    0x39, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 
-    0x34, 0x33, 0x30, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x36, 0x20, 
-    0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 
-    0x35, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 
-    0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 
-    0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x32, 0x20, 0x20, 0x20, 
-    0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 
-    0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 
-    0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 
-    0x3D, 0x31, 0x30, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 
-    0x3D, 0x31, 0x38, 0x34, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x37, 
-    0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 
-    0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 
-    0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 
-    0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 
-    0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 
-    0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 
-    0x64, 0x3D, 0x31, 0x30, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x78, 0x3D, 0x34, 0x33, 0x36, 0x20, 0x20, 0x79, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 
-    0x36, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
-    0x74, 0x3D, 0x35, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 
-    0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x32, 0x20, 
-    0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 
-    0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 
-    0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 
-    0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 
-    0x69, 0x64, 0x3D, 0x31, 0x30, 0x32, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x78, 0x3D, 0x31, 0x39, 0x31, 0x20, 0x20, 0x79, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 
-    0x3D, 0x36, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 
-    0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 
-    0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 
-    0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 
-    0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 
-    0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 
-    0x20, 0x69, 0x64, 0x3D, 0x31, 0x30, 0x33, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x78, 0x3D, 0x33, 0x37, 0x37, 0x20, 0x20, 0x79, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 
-    0x68, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 
-    0x67, 0x68, 0x74, 0x3D, 0x36, 0x20, 0x20, 0x20, 0x20, 0x78, 
-    0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 
-    0x32, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 
-    0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 
-    0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 
-    0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 
-    0x72, 0x20, 0x69, 0x64, 0x3D, 0x31, 0x30, 0x34, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x78, 0x3D, 0x31, 0x39, 0x37, 0x20, 0x20, 
-    0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 
-    0x74, 0x68, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 
-    0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 
-    0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 
-    0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 
-    0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 
-    0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x31, 0x30, 0x35, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x32, 0x30, 0x34, 0x20, 
-    0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 
-    0x64, 0x74, 0x68, 0x3D, 0x34, 0x20, 0x20, 0x20, 0x20, 0x68, 
-    0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 
-    0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x31, 
-    0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 
-    0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 
-    0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 
-    0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 
-    0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x31, 0x30, 0x36, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 
-    0x69, 0x64, 0x74, 0x68, 0x3D, 0x36, 0x20, 0x20, 0x20, 0x20, 
-    0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x38, 0x20, 0x20, 
-    0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 
-    0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 
-    0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 
-    0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 
-    0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x31, 0x30, 
-    0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x32, 0x30, 
-    0x38, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x37, 0x20, 0x20, 0x20, 
-    0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 
-    0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 
-    0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 
-    0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 
-    0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 
-    0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x31, 
-    0x30, 0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x32, 
-    0x31, 0x35, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x34, 0x20, 0x20, 
-    0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 
-    0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 
-    0x74, 0x3D, 0x31, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 
-    0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 
-    0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 
-    0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 
-    0x31, 0x30, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 
-    0x34, 0x34, 0x32, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x37, 0x20, 
-    0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 
-    0x35, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 
-    0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 
-    0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x32, 0x20, 0x20, 0x20, 
-    0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 
-    0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 
-    0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 
-    0x3D, 0x31, 0x31, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 
-    0x3D, 0x34, 0x34, 0x39, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x36, 
-    0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 
-    0x3D, 0x35, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 
-    0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 
-    0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x32, 0x20, 0x20, 
-    0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 
-    0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 
-    0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 
-    0x64, 0x3D, 0x31, 0x31, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x78, 0x3D, 0x34, 0x35, 0x35, 0x20, 0x20, 0x79, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 
-    0x36, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
-    0x74, 0x3D, 0x35, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 
-    0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x32, 0x20, 
-    0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 
-    0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 
-    0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 
-    0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 
-    0x69, 0x64, 0x3D, 0x31, 0x31, 0x32, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x78, 0x3D, 0x33, 0x38, 0x34, 0x20, 0x20, 0x79, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 
-    0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 
-    0x68, 0x74, 0x3D, 0x36, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 
-    0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x32, 
-    0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 
-    0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 
-    0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 
-    0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 
-    0x20, 0x69, 0x64, 0x3D, 0x31, 0x31, 0x33, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x78, 0x3D, 0x33, 0x39, 0x31, 0x20, 0x20, 0x79, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 
-    0x68, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 
-    0x67, 0x68, 0x74, 0x3D, 0x36, 0x20, 0x20, 0x20, 0x20, 0x78, 
-    0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 
-    0x32, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 
-    0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 
-    0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 
-    0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 
-    0x72, 0x20, 0x69, 0x64, 0x3D, 0x31, 0x31, 0x34, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x78, 0x3D, 0x34, 0x36, 0x31, 0x20, 0x20, 
-    0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 
-    0x74, 0x68, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 
-    0x69, 0x67, 0x68, 0x74, 0x3D, 0x35, 0x20, 0x20, 0x20, 0x20, 
-    0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 
-    0x3D, 0x32, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 
-    0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 
-    0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 
-    0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x31, 0x31, 0x35, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x34, 0x36, 0x38, 0x20, 
-    0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 
-    0x64, 0x74, 0x68, 0x3D, 0x36, 0x20, 0x20, 0x20, 0x20, 0x68, 
-    0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x35, 0x20, 0x20, 0x20, 
-    0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 
-    0x74, 0x3D, 0x32, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 
-    0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 
-    0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 
-    0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x31, 0x31, 0x36, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x32, 0x31, 0x39, 
-    0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 
-    0x69, 0x64, 0x74, 0x68, 0x3D, 0x35, 0x20, 0x20, 0x20, 0x20, 
-    0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 
-    0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 
-    0x31, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 
-    0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 
-    0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 
-    0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 
-    0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x31, 0x31, 
-    0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x34, 0x37, 
-    0x34, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x37, 0x20, 0x20, 0x20, 
-    0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x35, 0x20, 
-    0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 
-    0x73, 0x65, 0x74, 0x3D, 0x32, 0x20, 0x20, 0x20, 0x20, 0x78, 
-    0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 
-    0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 
-    0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x31, 
-    0x31, 0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x34, 
-    0x38, 0x31, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x36, 0x20, 0x20, 
-    0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x35, 
-    0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 
-    0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 
-    0x66, 0x73, 0x65, 0x74, 0x3D, 0x32, 0x20, 0x20, 0x20, 0x20, 
-    0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 
-    0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 
-    0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 
-    0x31, 0x31, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 
-    0x34, 0x38, 0x37, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x37, 0x20, 
-    0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 
-    0x35, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 
-    0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 
-    0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x32, 0x20, 0x20, 0x20, 
-    0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 
-    0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 
-    0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 
-    0x3D, 0x31, 0x32, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 
-    0x3D, 0x34, 0x39, 0x34, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x37, 
-    0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 
-    0x3D, 0x35, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 
-    0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 
-    0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x32, 0x20, 0x20, 
-    0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 
-    0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 
-    0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 
-    0x64, 0x3D, 0x31, 0x32, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x78, 0x3D, 0x33, 0x39, 0x38, 0x20, 0x20, 0x79, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 
-    0x36, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
-    0x74, 0x3D, 0x36, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 
-    0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x32, 0x20, 
-    0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 
-    0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 
-    0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 
-    0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x20, 
-    0x69, 0x64, 0x3D, 0x31, 0x32, 0x32, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x78, 0x3D, 0x35, 0x30, 0x31, 0x20, 0x20, 0x79, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 
-    0x3D, 0x36, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 
-    0x68, 0x74, 0x3D, 0x35, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6F, 
-    0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x32, 
-    0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 0x6E, 
-    0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 
-    0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 
-    0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 0x72, 
-    0x20, 0x69, 0x64, 0x3D, 0x31, 0x32, 0x33, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x78, 0x3D, 0x33, 0x31, 0x32, 0x20, 0x20, 0x79, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 
-    0x68, 0x3D, 0x36, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 
-    0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 0x78, 
-    0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 0x61, 
-    0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x70, 
-    0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x63, 
-    0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 0x61, 
-    0x72, 0x20, 0x69, 0x64, 0x3D, 0x31, 0x32, 0x34, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x78, 0x3D, 0x33, 0x33, 0x34, 0x20, 0x20, 
-    0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 
-    0x74, 0x68, 0x3D, 0x32, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 
-    0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 
-    0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x33, 0x20, 
-    0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 0x76, 
-    0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 
-    0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 0x68, 
-    0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x31, 0x32, 0x35, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x33, 0x31, 0x38, 0x20, 
-    0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 
-    0x64, 0x74, 0x68, 0x3D, 0x36, 0x20, 0x20, 0x20, 0x20, 0x68, 
-    0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x37, 0x20, 0x20, 0x20, 
-    0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x30, 
-    0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 0x65, 
-    0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 0x64, 
-    0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 0x20, 
-    0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 0x20, 
-    0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 0x63, 
-    0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x31, 0x32, 0x36, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x33, 0x37, 0x20, 
-    0x20, 0x20, 0x79, 0x3D, 0x38, 0x20, 0x20, 0x20, 0x20, 0x77, 
-    0x69, 0x64, 0x74, 0x68, 0x3D, 0x37, 0x20, 0x20, 0x20, 0x20, 
-    0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x32, 0x20, 0x20, 
-    0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 
-    0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 0x73, 
-    0x65, 0x74, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x78, 0x61, 
-    0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 0x20, 
-    0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 0x20, 
-    0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 0x0A, 
-    0x63, 0x68, 0x61, 0x72, 0x20, 0x69, 0x64, 0x3D, 0x31, 0x32, 
-    0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x3D, 0x34, 0x31, 
-    0x36, 0x20, 0x20, 0x79, 0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 
-    0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x37, 0x20, 0x20, 0x20, 
-    0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x36, 0x20, 
-    0x20, 0x20, 0x20, 0x78, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 
-    0x3D, 0x30, 0x20, 0x20, 0x20, 0x20, 0x79, 0x6F, 0x66, 0x66, 
-    0x73, 0x65, 0x74, 0x3D, 0x31, 0x20, 0x20, 0x20, 0x20, 0x78, 
-    0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x3D, 0x38, 0x20, 
-    0x20, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x30, 0x20, 
-    0x20, 0x20, 0x20, 0x63, 0x68, 0x6E, 0x6C, 0x3D, 0x30, 0x20, 
-    0x0A, 0x6B, 0x65, 0x72, 0x6E, 0x69, 0x6E, 0x67, 0x73, 0x20, 
-    0x63, 0x6F, 0x75, 0x6E, 0x74, 0x3D, 0x30, 0x0A, 
-    0x52, 0x49, 0x46, 0x46, 0xE7, 0x21, 0x00, 0x00, 0x57, 0x41, 
-    0x56, 0x45, 0x66, 0x6D, 0x74, 0x20, 0x10, 0x00, 0x00, 0x00, 
-    0x01, 0x00, 0x01, 0x00, 0x44, 0xAC, 0x00, 0x00, 0x44, 0xAC, 
-    0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x64, 0x61, 0x74, 0x61, 
-    0xC3, 0x21, 0x00, 0x00, 0xC6, 0xC3, 0xC0, 0xBC, 0xB9, 0xB6, 
-    0xB3, 0xAF, 0xAC, 0xA9, 0xA6, 0xA3, 0x9F, 0x9C, 0x99, 0x96, 
-    0x93, 0x90, 0x8D, 0x8A, 0x87, 0x84, 0x81, 0x7E, 0x7B, 0x78, 
-    0x75, 0x72, 0x6F, 0x6C, 0x6A, 0x67, 0x64, 0x61, 0x5E, 0x5B, 
-    0x59, 0x56, 0x53, 0x50, 0x4E, 0x4B, 0x48, 0x46, 0x43, 0x40, 
-    0x3E, 0x3B, 0x38, 0xB5, 0xC4, 0xC1, 0xBE, 0xBC, 0xB9, 0xB6, 
-    0xB3, 0xB0, 0xAD, 0xAA, 0xA8, 0xA5, 0xA2, 0x9F, 0x9D, 0x9A, 
-    0x97, 0x95, 0x92, 0x8F, 0x8D, 0x8A, 0x87, 0x85, 0x82, 0x7F, 
-    0x7D, 0x7A, 0x78, 0x75, 0x73, 0x70, 0x6E, 0x6B, 0x69, 0x66, 
-    0x64, 0x62, 0x5F, 0x5D, 0x5B, 0x58, 0x56, 0x54, 0x51, 0x4F, 
-    0x4D, 0x4A, 0x48, 0x46, 0x44, 0x41, 0x3F, 0x3D, 0x3B, 0x39, 
-    0xB5, 0xC4, 0xC2, 0xBF, 0xBD, 0xBA, 0xB8, 0xB5, 0xB3, 0xB1, 
-    0xAE, 0xAC, 0xA9, 0xA7, 0xA5, 0xA2, 0xA0, 0x9E, 0x9B, 0x99, 
-    0x97, 0x94, 0x92, 0x90, 0x8E, 0x8B, 0x89, 0x87, 0x85, 0x83, 
-    0x80, 0x7E, 0x7C, 0x7A, 0x78, 0x76, 0x74, 0x72, 0x70, 0x6E, 
-    0x6C, 0x69, 0x68, 0x65, 0x63, 0x62, 0x60, 0x5E, 0x5C, 0x5A, 
-    0x58, 0x56, 0x54, 0x52, 0x50, 0x4E, 0x4C, 0x4A, 0x49, 0x47, 
-    0x45, 0x43, 0x41, 0x40, 0x3E, 0x3C, 0x3A, 0x5C, 0xC6, 0xC4, 
-    0xC1, 0xBF, 0xBD, 0xBB, 0xB9, 0xB7, 0xB5, 0xB3, 0xB1, 0xAF, 
-    0xAD, 0xAB, 0xA9, 0xA7, 0xA5, 0xA3, 0xA1, 0x9F, 0x9D, 0x9C, 
-    0x9A, 0x98, 0x96, 0x94, 0x92, 0x90, 0x8F, 0x8D, 0x8B, 0x89, 
-    0x87, 0x86, 0x84, 0x82, 0x80, 0x7F, 0x7D, 0x7B, 0x7A, 0x78, 
-    0x76, 0x74, 0x73, 0x71, 0x6F, 0x6E, 0x6C, 0x6B, 0x69, 0x67, 
-    0x66, 0x64, 0x63, 0x61, 0x60, 0x5E, 0x5C, 0x5B, 0x59, 0x58, 
-    0x56, 0x55, 0x53, 0x52, 0x50, 0x4F, 0x4E, 0x4C, 0x4B, 0x49, 
-    0x48, 0x46, 0x45, 0x44, 0x42, 0x41, 0x40, 0x3E, 0x3D, 0x3C, 
-    0x3A, 0x80, 0xC5, 0xC3, 0xC2, 0xC0, 0xBE, 0xBD, 0xBB, 0xB9, 
-    0xB8, 0xB6, 0xB4, 0xB3, 0xB1, 0xB0, 0xAE, 0xAC, 0xAB, 0xA9, 
-    0xA8, 0xA6, 0xA5, 0xA3, 0xA2, 0xA0, 0x9F, 0x9D, 0x9C, 0x9A, 
-    0x99, 0x97, 0x96, 0x94, 0x93, 0x92, 0x90, 0x8F, 0x8D, 0x8C, 
-    0x8B, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7F, 
-    0x7D, 0x7C, 0x7B, 0x79, 0x78, 0x77, 0x76, 0x74, 0x73, 0x72, 
-    0x71, 0x6F, 0x6E, 0x6D, 0x6C, 0x6B, 0x69, 0x68, 0x67, 0x66, 
-    0x65, 0x64, 0x62, 0x61, 0x60, 0x5F, 0x5E, 0x5D, 0x5C, 0x5B, 
-    0x5A, 0x58, 0x57, 0x56, 0x55, 0x54, 0x53, 0x52, 0x51, 0x50, 
-    0x4F, 0x4E, 0x4D, 0x4C, 0x4B, 0x4A, 0x49, 0x48, 0x47, 0x46, 
-    0x45, 0x44, 0x43, 0x42, 0x41, 0x40, 0x3F, 0x3E, 0x3E, 0x3D, 
-    0x3C, 0x3B, 0x6E, 0xC5, 0xC3, 0xC2, 0xC1, 0xC0, 0xBE, 0xBD, 
-    0xBC, 0xBB, 0xB9, 0xB8, 0xB7, 0xB6, 0xB5, 0xB4, 0xB2, 0xB1, 
-    0xB0, 0xAF, 0xAE, 0xAD, 0xAB, 0xAA, 0xA9, 0xA8, 0xA7, 0xA6, 
-    0xA5, 0xA4, 0xA3, 0xA2, 0xA0, 0x9F, 0x9E, 0x9D, 0x9C, 0x9B, 
-    0x9A, 0x99, 0x98, 0x97, 0x96, 0x95, 0x94, 0x93, 0x92, 0x91, 
-    0x90, 0x8F, 0x8E, 0x8D, 0x8C, 0x8B, 0x8A, 0x89, 0x88, 0x88, 
-    0x87, 0x86, 0x85, 0x84, 0x83, 0x82, 0x81, 0x80, 0x7F, 0x7F, 
-    0x7E, 0x7D, 0x7C, 0x7B, 0x7A, 0x79, 0x79, 0x78, 0x77, 0x76, 
-    0x75, 0x74, 0x74, 0x73, 0x72, 0x71, 0x70, 0x70, 0x6F, 0x6E, 
-    0x6D, 0x6D, 0x6C, 0x6B, 0x6A, 0x6A, 0x69, 0x68, 0x67, 0x67, 
-    0x66, 0x65, 0x64, 0x64, 0x63, 0x62, 0x62, 0x61, 0x60, 0x60, 
-    0x5F, 0x5E, 0x5E, 0x5D, 0x5C, 0x5C, 0x5B, 0x5A, 0x5A, 0x59, 
-    0x58, 0x58, 0x57, 0x56, 0x56, 0x55, 0x55, 0x54, 0x53, 0x53, 
-    0x52, 0x52, 0x51, 0x50, 0x50, 0x4F, 0x4F, 0x4E, 0x4E, 0x4D, 
-    0x4C, 0x4C, 0x4B, 0x4B, 0x4A, 0x4A, 0x49, 0x49, 0x48, 0x48, 
-    0x47, 0x47, 0x46, 0x46, 0x45, 0x45, 0x44, 0x44, 0x43, 0x43, 
-    0x42, 0x42, 0x41, 0x41, 0x40, 0x40, 0x3F, 0x3F, 0x3E, 0x3E, 
-    0x3D, 0x3D, 0x3D, 0x3C, 0x3C, 0x91, 0xC3, 0xC3, 0xC2, 0xC1, 
-    0xC0, 0xBF, 0xBF, 0xBE, 0xBD, 0xBC, 0xBC, 0xBB, 0xBA, 0xB9, 
-    0xB9, 0xB8, 0xB7, 0xB6, 0xB6, 0xB5, 0xB4, 0xB4, 0xB3, 0xB2, 
-    0xB1, 0xB1, 0xB0, 0xAF, 0xAF, 0xAE, 0xAD, 0xAD, 0xAC, 0xAB, 
-    0xAB, 0xAA, 0xA9, 0xA9, 0xA8, 0xA7, 0xA7, 0xA6, 0xA5, 0xA5, 
-    0xA4, 0xA3, 0xA3, 0xA2, 0xA2, 0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 
-    0x9E, 0x9D, 0x9D, 0x9C, 0x9C, 0x9B, 0x9A, 0x9A, 0x99, 0x99, 
-    0x98, 0x98, 0x97, 0x96, 0x96, 0x95, 0x95, 0x94, 0x94, 0x93, 
-    0x93, 0x92, 0x92, 0x91, 0x91, 0x90, 0x90, 0x8F, 0x8F, 0x8E, 
-    0x8E, 0x8D, 0x8D, 0x8C, 0x8C, 0x8B, 0x8B, 0x8A, 0x8A, 0x89, 
-    0x89, 0x88, 0x88, 0x87, 0x87, 0x86, 0x86, 0x86, 0x85, 0x85, 
-    0x84, 0x84, 0x83, 0x83, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 
-    0x80, 0x80, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7D, 0x7D, 0x7C, 
-    0x7C, 0x7C, 0x7B, 0x7B, 0x7A, 0x7A, 0x7A, 0x79, 0x79, 0x79, 
-    0x78, 0x78, 0x78, 0x77, 0x77, 0x76, 0x76, 0x76, 0x75, 0x75, 
-    0x75, 0x74, 0x74, 0x74, 0x73, 0x73, 0x73, 0x72, 0x72, 0x72, 
-    0x71, 0x71, 0x71, 0x71, 0x70, 0x70, 0x70, 0x6F, 0x6F, 0x6F, 
-    0x6E, 0x6E, 0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x6C, 0x6C, 0x6C, 
-    0x6C, 0x6B, 0x6B, 0x6B, 0x6B, 0x6A, 0x6A, 0x6A, 0x6A, 0x69, 
-    0x69, 0x69, 0x69, 0x68, 0x68, 0x68, 0x68, 0x67, 0x67, 0x67, 
-    0x67, 0x66, 0x66, 0x66, 0x66, 0x65, 0x65, 0x65, 0x65, 0x65, 
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x63, 0x63, 0x63, 0x63, 0x63, 
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x61, 0x61, 0x61, 0x61, 
-    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5F, 0x5F, 0x5F, 0x5F, 
-    0x5F, 0x5F, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5D, 
-    0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 
-    0x5C, 0x5C, 0x5C, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-    0x5B, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 
-    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 
-    0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 
-    0x58, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 
-    0x57, 0x57, 0x57, 0x57, 0x57, 0x56, 0x56, 0x56, 0x56, 0x56, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1E, 0x01, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x08, 0x00, 
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 
+    0x00, 0x00, 0x6B, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x65, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x99, 0x01, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x72, 0x01, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 
+    0x00, 0x00, 0x28, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x2C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x06, 0x00, 
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x08, 0x00, 
+    0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x23, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x50, 0x01, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x17, 0x01, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 
+    0x00, 0x00, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xF2, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 
+    0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x0B, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 0x01, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x97, 0x01, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x94, 0x01, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 
+    0x00, 0x00, 0x44, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x15, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x06, 0x00, 
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x49, 0x01, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x22, 0x01, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x57, 0x01, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 
+    0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x13, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 
+    0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x36, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 
+    0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x55, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 
+    0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x77, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 
+    0x00, 0x00, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x96, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x9D, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 
+    0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x30, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x5E, 0x01, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x34, 0x01, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x08, 0x00, 
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 
+    0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0xFB, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xA7, 0x01, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xB1, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0xAE, 0x01, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 
+    0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0xB4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xBF, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x79, 0x01, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x06, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 
+    0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xD0, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0xBA, 0x01, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 
+    0x00, 0x00, 0xC1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0xC7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x01, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x87, 0x01, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x06, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0xCD, 0x01, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 
+    0x00, 0x00, 0xD4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0xDB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xDA, 0x01, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xE1, 0x01, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0xE7, 0x01, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 
+    0x00, 0x00, 0xEE, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x8E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 
+    0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xF5, 0x01, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x4E, 0x01, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 
+    0x00, 0x00, 0x3E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x25, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xA0, 0x01, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x49, 
+    0x46, 0x46, 0xE7, 0x21, 0x00, 0x00, 0x57, 0x41, 0x56, 0x45, 
+    0x66, 0x6D, 0x74, 0x20, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 
+    0x01, 0x00, 0x44, 0xAC, 0x00, 0x00, 0x44, 0xAC, 0x00, 0x00, 
+    0x01, 0x00, 0x08, 0x00, 0x64, 0x61, 0x74, 0x61, 0xC3, 0x21, 
+    0x00, 0x00, 0xC6, 0xC3, 0xC0, 0xBC, 0xB9, 0xB6, 0xB3, 0xAF, 
+    0xAC, 0xA9, 0xA6, 0xA3, 0x9F, 0x9C, 0x99, 0x96, 0x93, 0x90, 
+    0x8D, 0x8A, 0x87, 0x84, 0x81, 0x7E, 0x7B, 0x78, 0x75, 0x72, 
+    0x6F, 0x6C, 0x6A, 0x67, 0x64, 0x61, 0x5E, 0x5B, 0x59, 0x56, 
+    0x53, 0x50, 0x4E, 0x4B, 0x48, 0x46, 0x43, 0x40, 0x3E, 0x3B, 
+    0x38, 0xB5, 0xC4, 0xC1, 0xBE, 0xBC, 0xB9, 0xB6, 0xB3, 0xB0, 
+    0xAD, 0xAA, 0xA8, 0xA5, 0xA2, 0x9F, 0x9D, 0x9A, 0x97, 0x95, 
+    0x92, 0x8F, 0x8D, 0x8A, 0x87, 0x85, 0x82, 0x7F, 0x7D, 0x7A, 
+    0x78, 0x75, 0x73, 0x70, 0x6E, 0x6B, 0x69, 0x66, 0x64, 0x62, 
+    0x5F, 0x5D, 0x5B, 0x58, 0x56, 0x54, 0x51, 0x4F, 0x4D, 0x4A, 
+    0x48, 0x46, 0x44, 0x41, 0x3F, 0x3D, 0x3B, 0x39, 0xB5, 0xC4, 
+    0xC2, 0xBF, 0xBD, 0xBA, 0xB8, 0xB5, 0xB3, 0xB1, 0xAE, 0xAC, 
+    0xA9, 0xA7, 0xA5, 0xA2, 0xA0, 0x9E, 0x9B, 0x99, 0x97, 0x94, 
+    0x92, 0x90, 0x8E, 0x8B, 0x89, 0x87, 0x85, 0x83, 0x80, 0x7E, 
+    0x7C, 0x7A, 0x78, 0x76, 0x74, 0x72, 0x70, 0x6E, 0x6C, 0x69, 
+    0x68, 0x65, 0x63, 0x62, 0x60, 0x5E, 0x5C, 0x5A, 0x58, 0x56, 
+    0x54, 0x52, 0x50, 0x4E, 0x4C, 0x4A, 0x49, 0x47, 0x45, 0x43, 
+    0x41, 0x40, 0x3E, 0x3C, 0x3A, 0x5C, 0xC6, 0xC4, 0xC1, 0xBF, 
+    0xBD, 0xBB, 0xB9, 0xB7, 0xB5, 0xB3, 0xB1, 0xAF, 0xAD, 0xAB, 
+    0xA9, 0xA7, 0xA5, 0xA3, 0xA1, 0x9F, 0x9D, 0x9C, 0x9A, 0x98, 
+    0x96, 0x94, 0x92, 0x90, 0x8F, 0x8D, 0x8B, 0x89, 0x87, 0x86, 
+    0x84, 0x82, 0x80, 0x7F, 0x7D, 0x7B, 0x7A, 0x78, 0x76, 0x74, 
+    0x73, 0x71, 0x6F, 0x6E, 0x6C, 0x6B, 0x69, 0x67, 0x66, 0x64, 
+    0x63, 0x61, 0x60, 0x5E, 0x5C, 0x5B, 0x59, 0x58, 0x56, 0x55, 
+    0x53, 0x52, 0x50, 0x4F, 0x4E, 0x4C, 0x4B, 0x49, 0x48, 0x46, 
+    0x45, 0x44, 0x42, 0x41, 0x40, 0x3E, 0x3D, 0x3C, 0x3A, 0x80, 
+    0xC5, 0xC3, 0xC2, 0xC0, 0xBE, 0xBD, 0xBB, 0xB9, 0xB8, 0xB6, 
+    0xB4, 0xB3, 0xB1, 0xB0, 0xAE, 0xAC, 0xAB, 0xA9, 0xA8, 0xA6, 
+    0xA5, 0xA3, 0xA2, 0xA0, 0x9F, 0x9D, 0x9C, 0x9A, 0x99, 0x97, 
+    0x96, 0x94, 0x93, 0x92, 0x90, 0x8F, 0x8D, 0x8C, 0x8B, 0x89, 
+    0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7F, 0x7D, 0x7C, 
+    0x7B, 0x79, 0x78, 0x77, 0x76, 0x74, 0x73, 0x72, 0x71, 0x6F, 
+    0x6E, 0x6D, 0x6C, 0x6B, 0x69, 0x68, 0x67, 0x66, 0x65, 0x64, 
+    0x62, 0x61, 0x60, 0x5F, 0x5E, 0x5D, 0x5C, 0x5B, 0x5A, 0x58, 
+    0x57, 0x56, 0x55, 0x54, 0x53, 0x52, 0x51, 0x50, 0x4F, 0x4E, 
+    0x4D, 0x4C, 0x4B, 0x4A, 0x49, 0x48, 0x47, 0x46, 0x45, 0x44, 
+    0x43, 0x42, 0x41, 0x40, 0x3F, 0x3E, 0x3E, 0x3D, 0x3C, 0x3B, 
+    0x6E, 0xC5, 0xC3, 0xC2, 0xC1, 0xC0, 0xBE, 0xBD, 0xBC, 0xBB, 
+    0xB9, 0xB8, 0xB7, 0xB6, 0xB5, 0xB4, 0xB2, 0xB1, 0xB0, 0xAF, 
+    0xAE, 0xAD, 0xAB, 0xAA, 0xA9, 0xA8, 0xA7, 0xA6, 0xA5, 0xA4, 
+    0xA3, 0xA2, 0xA0, 0x9F, 0x9E, 0x9D, 0x9C, 0x9B, 0x9A, 0x99, 
+    0x98, 0x97, 0x96, 0x95, 0x94, 0x93, 0x92, 0x91, 0x90, 0x8F, 
+    0x8E, 0x8D, 0x8C, 0x8B, 0x8A, 0x89, 0x88, 0x88, 0x87, 0x86, 
+    0x85, 0x84, 0x83, 0x82, 0x81, 0x80, 0x7F, 0x7F, 0x7E, 0x7D, 
+    0x7C, 0x7B, 0x7A, 0x79, 0x79, 0x78, 0x77, 0x76, 0x75, 0x74, 
+    0x74, 0x73, 0x72, 0x71, 0x70, 0x70, 0x6F, 0x6E, 0x6D, 0x6D, 
+    0x6C, 0x6B, 0x6A, 0x6A, 0x69, 0x68, 0x67, 0x67, 0x66, 0x65, 
+    0x64, 0x64, 0x63, 0x62, 0x62, 0x61, 0x60, 0x60, 0x5F, 0x5E, 
+    0x5E, 0x5D, 0x5C, 0x5C, 0x5B, 0x5A, 0x5A, 0x59, 0x58, 0x58, 
+    0x57, 0x56, 0x56, 0x55, 0x55, 0x54, 0x53, 0x53, 0x52, 0x52, 
+    0x51, 0x50, 0x50, 0x4F, 0x4F, 0x4E, 0x4E, 0x4D, 0x4C, 0x4C, 
+    0x4B, 0x4B, 0x4A, 0x4A, 0x49, 0x49, 0x48, 0x48, 0x47, 0x47, 
+    0x46, 0x46, 0x45, 0x45, 0x44, 0x44, 0x43, 0x43, 0x42, 0x42, 
+    0x41, 0x41, 0x40, 0x40, 0x3F, 0x3F, 0x3E, 0x3E, 0x3D, 0x3D, 
+    0x3D, 0x3C, 0x3C, 0x91, 0xC3, 0xC3, 0xC2, 0xC1, 0xC0, 0xBF, 
+    0xBF, 0xBE, 0xBD, 0xBC, 0xBC, 0xBB, 0xBA, 0xB9, 0xB9, 0xB8, 
+    0xB7, 0xB6, 0xB6, 0xB5, 0xB4, 0xB4, 0xB3, 0xB2, 0xB1, 0xB1, 
+    0xB0, 0xAF, 0xAF, 0xAE, 0xAD, 0xAD, 0xAC, 0xAB, 0xAB, 0xAA, 
+    0xA9, 0xA9, 0xA8, 0xA7, 0xA7, 0xA6, 0xA5, 0xA5, 0xA4, 0xA3, 
+    0xA3, 0xA2, 0xA2, 0xA1, 0xA0, 0xA0, 0x9F, 0x9F, 0x9E, 0x9D, 
+    0x9D, 0x9C, 0x9C, 0x9B, 0x9A, 0x9A, 0x99, 0x99, 0x98, 0x98, 
+    0x97, 0x96, 0x96, 0x95, 0x95, 0x94, 0x94, 0x93, 0x93, 0x92, 
+    0x92, 0x91, 0x91, 0x90, 0x90, 0x8F, 0x8F, 0x8E, 0x8E, 0x8D, 
+    0x8D, 0x8C, 0x8C, 0x8B, 0x8B, 0x8A, 0x8A, 0x89, 0x89, 0x88, 
+    0x88, 0x87, 0x87, 0x86, 0x86, 0x86, 0x85, 0x85, 0x84, 0x84, 
+    0x83, 0x83, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 
+    0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7D, 0x7D, 0x7C, 0x7C, 0x7C, 
+    0x7B, 0x7B, 0x7A, 0x7A, 0x7A, 0x79, 0x79, 0x79, 0x78, 0x78, 
+    0x78, 0x77, 0x77, 0x76, 0x76, 0x76, 0x75, 0x75, 0x75, 0x74, 
+    0x74, 0x74, 0x73, 0x73, 0x73, 0x72, 0x72, 0x72, 0x71, 0x71, 
+    0x71, 0x71, 0x70, 0x70, 0x70, 0x6F, 0x6F, 0x6F, 0x6E, 0x6E, 
+    0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x6C, 0x6C, 0x6C, 0x6C, 0x6B, 
+    0x6B, 0x6B, 0x6B, 0x6A, 0x6A, 0x6A, 0x6A, 0x69, 0x69, 0x69, 
+    0x69, 0x68, 0x68, 0x68, 0x68, 0x67, 0x67, 0x67, 0x67, 0x66, 
+    0x66, 0x66, 0x66, 0x65, 0x65, 0x65, 0x65, 0x65, 0x64, 0x64, 
+    0x64, 0x64, 0x64, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62, 0x62, 
+    0x62, 0x62, 0x62, 0x61, 0x61, 0x61, 0x61, 0x61, 0x60, 0x60, 
+    0x60, 0x60, 0x60, 0x60, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 
+    0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5D, 0x5D, 0x5D, 
+    0x5D, 0x5D, 0x5D, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 
+    0x5C, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5A, 
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x59, 0x59, 
+    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x58, 0x58, 
+    0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x57, 
+    0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 
+    0x57, 0x57, 0x57, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 
     0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 
-    0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
+    0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x54, 0x54, 
     0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 
     0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 
     0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 
-    0x54, 0x54, 0x54, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 
+    0x54, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-    0x55, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 
+    0x55, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 
     0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 
-    0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x57, 0x57, 0x57, 0x57, 
+    0x56, 0x56, 0x56, 0x56, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 
     0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 
-    0x57, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x58, 0x58, 0x58, 
-    0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 
-    0x58, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 
-    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5A, 0x5A, 0x5A, 0x5A, 
-    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 
-    0x5A, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-    0x5B, 0x5B, 0x5B, 0x5B, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 
-    0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5D, 0x5D, 0x5D, 0x5D, 
-    0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5E, 
-    0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 
+    0x57, 0x57, 0x57, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 
+    0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x59, 
+    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 
+    0x59, 0x59, 0x59, 0x59, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5B, 
+    0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
+    0x5B, 0x5B, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 
+    0x5C, 0x5C, 0x5C, 0x5C, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 
+    0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5E, 0x5E, 0x5E, 
+    0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5F, 0x5F, 
     0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 
-    0x5F, 0x5F, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 
-    0x60, 0x60, 0x60, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 
-    0x61, 0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x64, 0x64, 0x64, 0x64, 0x64, 
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x65, 0x65, 0x65, 0x65, 
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x66, 0x66, 0x66, 0x66, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x67, 0x67, 
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x68, 0x68, 0x68, 
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x69, 0x69, 0x69, 
-    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x6A, 0x6A, 0x6A, 
-    0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6B, 0x6B, 0x6B, 
-    0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6C, 0x6C, 0x6C, 
-    0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6D, 0x6D, 0x6D, 
-    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6E, 
-    0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6F, 0x6F, 0x6F, 
-    0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x70, 0x70, 0x70, 
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x71, 0x71, 0x71, 
-    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x72, 0x72, 0x72, 
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x73, 0x73, 0x73, 
-    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x74, 0x74, 0x74, 
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x75, 
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x77, 0x77, 0x77, 
-    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x78, 0x78, 
-    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x79, 0x79, 
-    0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7A, 0x7A, 
-    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7B, 0x7B, 
-    0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7C, 
-    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7D, 
-    0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 
-    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
-    0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
-    0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 
-    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x84, 0x84, 0x84, 
-    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x85, 
-    0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 
+    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 
+    0x60, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 
+    0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 
+    0x62, 0x62, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 
+    0x63, 0x63, 0x63, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 
+    0x64, 0x64, 0x64, 0x64, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 
+    0x65, 0x65, 0x65, 0x65, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
+    0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 
+    0x67, 0x67, 0x67, 0x67, 0x67, 0x68, 0x68, 0x68, 0x68, 0x68, 
+    0x68, 0x68, 0x68, 0x68, 0x68, 0x69, 0x69, 0x69, 0x69, 0x69, 
+    0x69, 0x69, 0x69, 0x69, 0x69, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 
+    0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 
+    0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 
+    0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 
+    0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 
+    0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x70, 0x70, 0x70, 0x70, 0x70, 
+    0x70, 0x70, 0x70, 0x70, 0x70, 0x71, 0x71, 0x71, 0x71, 0x71, 
+    0x71, 0x71, 0x71, 0x71, 0x71, 0x72, 0x72, 0x72, 0x72, 0x72, 
+    0x72, 0x72, 0x72, 0x72, 0x72, 0x73, 0x73, 0x73, 0x73, 0x73, 
+    0x73, 0x73, 0x73, 0x73, 0x73, 0x74, 0x74, 0x74, 0x74, 0x74, 
+    0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x75, 0x75, 0x75, 
+    0x75, 0x75, 0x75, 0x75, 0x75, 0x76, 0x76, 0x76, 0x76, 0x76, 
+    0x76, 0x76, 0x76, 0x76, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x78, 0x78, 0x78, 0x78, 
+    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x79, 0x79, 0x79, 0x79, 
+    0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7A, 0x7A, 0x7A, 0x7A, 
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7B, 0x7B, 0x7B, 0x7B, 
+    0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7C, 0x7C, 0x7C, 
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7D, 0x7D, 0x7D, 
+    0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7E, 0x7E, 
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
+    0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 
+    0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x84, 0x84, 0x84, 0x84, 0x84, 
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x85, 0x85, 0x85, 
+    0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x86, 0x86, 
     0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 
-    0x86, 0x86, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 
-    0x87, 0x87, 0x87, 0x87, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x89, 0x89, 
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 
+    0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 
+    0x87, 0x87, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x89, 0x89, 0x89, 0x89, 
+    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8A, 0x8A, 
     0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 
-    0x8A, 0x8A, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 
-    0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 
-    0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8D, 
+    0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 
+    0x8B, 0x8B, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 
+    0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8D, 0x8D, 0x8D, 
     0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 
-    0x8D, 0x8D, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 
-    0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8F, 0x8F, 0x8F, 0x8F, 
-    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 
+    0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 
+    0x8E, 0x8E, 0x8E, 0x8E, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x90, 0x90, 
     0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91, 0x91, 
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x92, 
+    0x90, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x92, 0x92, 0x92, 
     0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x93, 0x93, 0x93, 0x93, 0x93, 
-    0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 
+    0x92, 0x92, 0x92, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 
+    0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x94, 0x94, 
     0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 
-    0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x95, 0x95, 0x95, 0x95, 
+    0x94, 0x94, 0x94, 0x94, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 
     0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 
-    0x95, 0x95, 0x95, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 
+    0x95, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 
+    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 
     0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98, 
+    0x97, 0x97, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 
     0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x99, 0x99, 0x99, 0x99, 
+    0x98, 0x98, 0x98, 0x98, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
     0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 
+    0x99, 0x99, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 
     0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 
-    0x9A, 0x9A, 0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 
+    0x9A, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 
     0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 
+    0x9B, 0x9B, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 
     0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 
-    0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 
+    0x9C, 0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 
     0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 
-    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9E, 0x9E, 
-    0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 
+    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9E, 0x9E, 0x9E, 0x9E, 
     0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 
-    0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 
+    0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 
     0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xA0, 0xA0, 0xA0, 0xA0, 
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 
+    0x9F, 0x9F, 0x9F, 0x9F, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 
     0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 
     0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 
-    0xA0, 0xA0, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 
     0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 
     0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 
+    0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA2, 0xA2, 
     0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 
     0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 
-    0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 
+    0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA3, 0xA3, 
     0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 
     0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 
     0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 
-    0xA3, 0xA3, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 
     0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 
     0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 
-    0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA5, 0xA5, 
+    0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 
+    0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA5, 0xA5, 0xA5, 0xA5, 
     0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 
     0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 
     0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 
-    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6, 
-    0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 
     0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 
     0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 
     0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 
-    0xA6, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 
+    0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA7, 
     0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 
     0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 
     0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 
     0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 
     0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 
     0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 
-    0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 
+    0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 
+    0xA7, 0xA7, 0xA7, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 
     0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 
     0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 
     0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 
     0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 
     0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 
-    0xA6, 0xA6, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 
     0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 
     0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 
     0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 
     0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 
-    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA4, 
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA4, 0xA4, 0xA4, 
     0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 
     0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 
     0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 
     0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 
     0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 
-    0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA3, 0xA3, 0xA3, 
+    0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 
     0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 
     0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 
     0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 
     0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 
     0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 
-    0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA2, 0xA2, 0xA2, 0xA2, 
+    0xA3, 0xA3, 0xA3, 0xA3, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 
     0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 
     0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 
     0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 
     0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 
     0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 
-    0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA1, 0xA1, 0xA1, 0xA1, 
+    0xA2, 0xA2, 0xA2, 0xA2, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 
     0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 
     0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 
     0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 
     0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 
     0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 
-    0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA0, 0xA0, 0xA0, 
+    0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 
     0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 
     0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 
     0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 
     0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 
     0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 
-    0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x9F, 
+    0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x9F, 0x9F, 0x9F, 
     0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 
     0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 
     0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 
     0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 
     0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 
     0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 
-    0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 
     0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 
     0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 
     0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 
     0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 
     0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 
-    0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x9D, 0x9D, 
-    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 
+    0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 
+    0x9E, 0x9E, 0x9E, 0x9E, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 
     0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 
     0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 
     0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 
     0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 
     0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 
-    0x9D, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 
+    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9C, 
+    0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 
     0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 
     0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 
     0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 
     0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 
     0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 
-    0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9B, 0x9B, 
+    0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9B, 0x9B, 0x9B, 0x9B, 
     0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 
     0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 
     0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 
     0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 
     0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 
     0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 
+    0x9B, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 
     0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 
     0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 
     0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 
     0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 
     0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 
     0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 
-    0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x99, 
+    0x9A, 0x9A, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
     0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
     0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
     0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
     0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
     0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
     0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 
+    0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 
     0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 
     0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 
     0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 
     0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 
     0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 
     0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 
+    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 0x97, 0x97, 
     0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 
     0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 
     0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 
@@ -1859,14 +1209,14 @@ unsigned char res_data[] = {
     0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 
     0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 
     0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 
-    0x97, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 
     0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 
     0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 
     0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 
     0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 
     0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 
     0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x95, 0x95, 
+    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 
+    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x95, 0x95, 0x95, 0x95, 
     0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 
     0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 
     0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 
@@ -1874,7 +1224,7 @@ unsigned char res_data[] = {
     0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 
     0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 
     0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x94, 0x94, 0x94, 0x94, 0x94, 
+    0x95, 0x95, 0x95, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 
     0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 
     0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 
     0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 
@@ -1882,7 +1232,7 @@ unsigned char res_data[] = {
     0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 
     0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 
     0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 
-    0x94, 0x94, 0x94, 0x94, 0x94, 0x93, 0x93, 0x93, 0x93, 0x93, 
+    0x94, 0x94, 0x94, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 
     0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 
     0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 
     0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 
@@ -1890,8 +1240,7 @@ unsigned char res_data[] = {
     0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 
     0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 
     0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 
-    0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x92, 0x92, 
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 
+    0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 
     0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 
     0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 
     0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 
@@ -1899,6 +1248,7 @@ unsigned char res_data[] = {
     0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 
     0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 
     0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x91, 0x91, 
     0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 
     0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 
     0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 
@@ -1907,7 +1257,7 @@ unsigned char res_data[] = {
     0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 
     0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 
     0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x90, 0x90, 0x90, 0x90, 
+    0x91, 0x91, 0x91, 0x91, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 
     0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 
     0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 
     0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 
@@ -1916,7 +1266,7 @@ unsigned char res_data[] = {
     0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 
     0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 
     0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 
+    0x90, 0x90, 0x90, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 
     0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 
     0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 
     0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 
@@ -1925,7 +1275,7 @@ unsigned char res_data[] = {
     0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 
     0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 
     0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 
-    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8E, 0x8E, 0x8E, 0x8E, 
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 
     0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 
     0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 
     0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 
@@ -1934,8 +1284,7 @@ unsigned char res_data[] = {
     0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 
     0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 
     0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 
-    0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 
-    0x8E, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 
+    0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8D, 
     0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 
     0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 
     0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 
@@ -1944,8 +1293,8 @@ unsigned char res_data[] = {
     0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 
     0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 
     0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 
-    0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8C, 
-    0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 
+    0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 
+    0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8C, 0x8C, 0x8C, 
     0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 
     0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 
     0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 
@@ -1955,7 +1304,7 @@ unsigned char res_data[] = {
     0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 
     0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 
     0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 
-    0x8C, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 
+    0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 
     0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 
     0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 
     0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 
@@ -1965,7 +1314,8 @@ unsigned char res_data[] = {
     0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 
     0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 
     0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 
-    0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8A, 0x8A, 0x8A, 
+    0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 
+    0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 
     0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 
     0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 
     0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 
@@ -1976,7 +1326,7 @@ unsigned char res_data[] = {
     0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 
     0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 
     0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 
-    0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x89, 0x89, 0x89, 
+    0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x89, 0x89, 0x89, 0x89, 0x89, 
     0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 
     0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 
     0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 
@@ -1988,7 +1338,7 @@ unsigned char res_data[] = {
     0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 
     0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 
     0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 
-    0x89, 0x89, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
+    0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
     0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
     0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
     0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
@@ -2000,7 +1350,7 @@ unsigned char res_data[] = {
     0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
     0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
     0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 
+    0x88, 0x88, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 
     0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 
     0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 
     0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 
@@ -2013,8 +1363,7 @@ unsigned char res_data[] = {
     0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 
     0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 
     0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 
-    0x87, 0x87, 0x87, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 
-    0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 
+    0x87, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 
     0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 
     0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 
     0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 
@@ -2027,6 +1376,7 @@ unsigned char res_data[] = {
     0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 
     0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 
     0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 
+    0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x85, 0x85, 
     0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 
     0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 
     0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 
@@ -2041,7 +1391,7 @@ unsigned char res_data[] = {
     0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 
     0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 
     0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 
-    0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x84, 0x84, 0x84, 0x84, 
+    0x85, 0x85, 0x85, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 
     0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 
     0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 
     0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 
@@ -2057,7 +1407,7 @@ unsigned char res_data[] = {
     0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 
     0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 
     0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 
-    0x84, 0x84, 0x84, 0x84, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 
+    0x84, 0x84, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 
     0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 
     0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 
     0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 
@@ -2074,7 +1424,7 @@ unsigned char res_data[] = {
     0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 
     0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 
     0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 
-    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 
     0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 
     0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 
     0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 
@@ -2093,7 +1443,7 @@ unsigned char res_data[] = {
     0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 
     0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 
     0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 
+    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 
     0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
     0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
     0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
@@ -2115,8 +1465,7 @@ unsigned char res_data[] = {
     0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
     0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
     0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 
     0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
     0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
     0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
@@ -2142,7 +1491,7 @@ unsigned char res_data[] = {
     0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
     0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
     0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
@@ -2176,7 +1525,8 @@ unsigned char res_data[] = {
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
     0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
     0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
     0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
@@ -2244,7 +1594,7 @@ unsigned char res_data[] = {
     0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
     0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
     0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
-    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7D, 
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7D, 0x7D, 0x7D, 
     0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 
     0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 
     0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 
@@ -2285,7 +1635,7 @@ unsigned char res_data[] = {
     0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 
     0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 
     0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 
-    0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7E, 0x7E, 
+    0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7E, 0x7E, 0x7E, 0x7E, 
     0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
     0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
     0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
@@ -2357,7 +1707,7 @@ unsigned char res_data[] = {
     0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
     0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
     0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
-    0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
@@ -2394,457 +1744,457 @@ unsigned char res_data[] = {
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 
-    0x52, 0x49, 0x46, 0x46, 0x90, 0x1D, 0x00, 0x00, 0x57, 0x41, 
-    0x56, 0x45, 0x66, 0x6D, 0x74, 0x20, 0x10, 0x00, 0x00, 0x00, 
-    0x01, 0x00, 0x01, 0x00, 0x44, 0xAC, 0x00, 0x00, 0x44, 0xAC, 
-    0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x64, 0x61, 0x74, 0x61, 
-    0x6C, 0x1D, 0x00, 0x00, 0xAE, 0x61, 0x9C, 0x90, 0xC5, 0xAA, 
-    0xBB, 0x91, 0x71, 0xA3, 0xA5, 0x83, 0x83, 0x69, 0xB0, 0xA5, 
-    0xB5, 0x61, 0x9A, 0xB7, 0x85, 0x99, 0x9E, 0xA1, 0xA5, 0x78, 
-    0x6A, 0x68, 0x53, 0x67, 0x53, 0x86, 0x55, 0x7A, 0x44, 0x80, 
-    0x55, 0x98, 0x62, 0x5C, 0x6A, 0x79, 0xB5, 0x72, 0x5A, 0x44, 
-    0x85, 0xAE, 0xB2, 0x94, 0x87, 0xA8, 0xBE, 0xAA, 0x69, 0x95, 
-    0x82, 0x57, 0xA3, 0xB0, 0x8E, 0xAE, 0x92, 0xAB, 0x85, 0x70, 
-    0xAC, 0xA4, 0x7F, 0x9C, 0x9E, 0x80, 0xAF, 0x37, 0x49, 0xC4, 
-    0x6C, 0x5F, 0x4D, 0x46, 0x96, 0xB8, 0x8F, 0x62, 0x68, 0x7B, 
-    0x8F, 0x86, 0xB5, 0xB5, 0xB5, 0x9D, 0x77, 0x93, 0xC2, 0xBB, 
-    0xA0, 0x7C, 0x58, 0x89, 0x7F, 0x68, 0x67, 0x8E, 0x9E, 0x7F, 
-    0x78, 0x56, 0x4B, 0x6E, 0x4E, 0x8C, 0xB8, 0xB6, 0xA2, 0x79, 
-    0x73, 0xA4, 0x9E, 0x50, 0x89, 0x51, 0x6E, 0x71, 0x80, 0x93, 
-    0x8D, 0x76, 0x42, 0x7F, 0x90, 0x7A, 0x6D, 0x66, 0x66, 0x73, 
-    0x66, 0x4F, 0x3A, 0x9B, 0x5E, 0x6A, 0x92, 0xAC, 0xAB, 0x7B, 
-    0x69, 0x47, 0x6B, 0x97, 0x6F, 0x5C, 0x7B, 0x93, 0x6E, 0x3E, 
-    0x62, 0x58, 0x55, 0x5F, 0x5B, 0x47, 0xA7, 0x7F, 0x99, 0x7A, 
-    0x62, 0x63, 0x68, 0x89, 0x56, 0x4E, 0x75, 0x9F, 0x9E, 0x61, 
-    0x47, 0x43, 0x4B, 0x55, 0x64, 0x89, 0xAF, 0xA0, 0x5A, 0x8E, 
-    0x8A, 0x6B, 0x59, 0x63, 0x90, 0x4F, 0x73, 0xA2, 0x9F, 0x6B, 
-    0x51, 0xB8, 0x6C, 0x60, 0x52, 0x4E, 0x63, 0xC5, 0x56, 0x9F, 
-    0x8A, 0x7F, 0x9F, 0xC1, 0x71, 0x71, 0x88, 0xA9, 0xA9, 0x43, 
-    0x75, 0xA2, 0x82, 0x89, 0xC2, 0xBE, 0xB1, 0x5C, 0x60, 0x65, 
-    0x54, 0x39, 0x8E, 0x54, 0x56, 0x7B, 0xA5, 0xAB, 0x52, 0x45, 
-    0x71, 0x89, 0x4D, 0x95, 0x91, 0x8C, 0x79, 0x4F, 0x5B, 0x97, 
-    0x69, 0x61, 0x9B, 0xC5, 0x4B, 0x73, 0x93, 0x95, 0xC0, 0x94, 
-    0xA6, 0x98, 0x7A, 0x57, 0x68, 0x88, 0x8F, 0x6E, 0x41, 0x5D, 
-    0xB8, 0x85, 0x80, 0xAA, 0x54, 0x41, 0x44, 0x5C, 0x81, 0x88, 
-    0x8C, 0x9F, 0xAE, 0xB6, 0xBD, 0xAF, 0xA0, 0x95, 0x8E, 0x50, 
-    0x93, 0xBC, 0xB0, 0x8F, 0x9A, 0xA5, 0x9E, 0x77, 0x7F, 0x4B, 
-    0x48, 0x6B, 0xA8, 0x45, 0x82, 0x68, 0x3D, 0x46, 0x44, 0x72, 
-    0x87, 0x80, 0x98, 0xA6, 0x8E, 0x67, 0x47, 0x63, 0x4D, 0x54, 
-    0x7A, 0x50, 0x76, 0x8E, 0x9A, 0x63, 0x9D, 0xA5, 0x9F, 0xC0, 
-    0x81, 0x9D, 0xB1, 0x47, 0x50, 0x5D, 0x63, 0x5C, 0x41, 0x71, 
-    0x8D, 0x91, 0xAE, 0xA0, 0xA1, 0xA7, 0xAC, 0xAE, 0xB9, 0xC1, 
-    0xB9, 0xA4, 0xAD, 0xAA, 0x81, 0xAE, 0x76, 0x6D, 0xC1, 0xC0, 
-    0x9A, 0x67, 0x40, 0x96, 0x71, 0x42, 0x48, 0x56, 0x7E, 0xA0, 
-    0x82, 0x5B, 0x60, 0x7F, 0xBD, 0x86, 0x69, 0x74, 0x46, 0x40, 
-    0x41, 0x50, 0x55, 0x91, 0xA9, 0x85, 0xAB, 0x8F, 0x65, 0x4D, 
-    0x9F, 0x83, 0x58, 0x47, 0x6B, 0x6D, 0x5E, 0x78, 0x97, 0x92, 
-    0x4C, 0xAC, 0xAE, 0x9B, 0x69, 0x75, 0x72, 0x5B, 0xA6, 0x7D, 
-    0x70, 0xBC, 0xA4, 0x87, 0x66, 0x7D, 0x63, 0x4C, 0x77, 0x67, 
-    0x6D, 0x7F, 0xAD, 0x8C, 0x49, 0x9E, 0x68, 0x4E, 0x5F, 0x50, 
-    0x81, 0xB7, 0xC2, 0x6D, 0x4D, 0x43, 0x6B, 0x7F, 0x88, 0x62, 
-    0x66, 0x6F, 0x83, 0x95, 0x9E, 0xA2, 0x81, 0x6B, 0x58, 0x67, 
-    0x5A, 0x60, 0x7F, 0x79, 0x82, 0xA5, 0xA9, 0x9C, 0x8E, 0x51, 
-    0x4C, 0x53, 0xA6, 0x9D, 0x92, 0x71, 0x55, 0x50, 0x71, 0x4F, 
-    0x5F, 0x8B, 0x4E, 0x7E, 0xB6, 0xA7, 0x86, 0x6D, 0x4A, 0x5B, 
-    0x6A, 0x87, 0x74, 0x73, 0x80, 0x88, 0x7F, 0x6F, 0xB4, 0xB7, 
-    0xB1, 0x9B, 0x7F, 0x63, 0x67, 0x52, 0x3E, 0xC1, 0x7E, 0x3C, 
-    0x93, 0x67, 0x3C, 0x46, 0x79, 0x99, 0x70, 0x93, 0xB6, 0x6C, 
-    0x6F, 0x72, 0x5E, 0x5D, 0x5F, 0x85, 0x89, 0x88, 0x7A, 0x77, 
-    0x74, 0xA9, 0xB6, 0xBF, 0x64, 0x65, 0x7C, 0x8A, 0x7E, 0x66, 
-    0x7C, 0x83, 0x8A, 0x5E, 0x67, 0x7F, 0x8A, 0x8F, 0x93, 0x5E, 
-    0x55, 0x91, 0x89, 0x88, 0xA4, 0x65, 0x40, 0x48, 0x5D, 0x72, 
-    0xAB, 0x8B, 0x47, 0x4E, 0x6C, 0xBD, 0x96, 0x7E, 0x55, 0x81, 
-    0xAD, 0x75, 0x7F, 0x9C, 0x5B, 0x4A, 0x6C, 0x72, 0x72, 0x5A, 
-    0x88, 0xB5, 0x94, 0x89, 0x75, 0x99, 0xA2, 0xA9, 0xA5, 0x99, 
-    0x54, 0x7D, 0x96, 0xA5, 0x98, 0x83, 0x8B, 0x79, 0x3F, 0x74, 
-    0x86, 0xA9, 0x91, 0x7A, 0x61, 0x6D, 0x9F, 0xB4, 0xC0, 0xA2, 
-    0x9D, 0x95, 0x8D, 0x86, 0x5E, 0x7B, 0x98, 0x5A, 0x63, 0x97, 
-    0xAD, 0xBA, 0x7F, 0x77, 0x5E, 0x50, 0x50, 0x6E, 0x73, 0x77, 
-    0xB5, 0xA4, 0x56, 0x50, 0x4D, 0x8E, 0x7F, 0x67, 0xA7, 0xA7, 
-    0x69, 0x59, 0x48, 0x57, 0x57, 0x4F, 0x82, 0xA1, 0x7C, 0x79, 
-    0x75, 0x8A, 0x96, 0xC0, 0xAA, 0x85, 0x6C, 0x5D, 0x9E, 0x9A, 
-    0x92, 0x8F, 0x8D, 0xA7, 0xA0, 0x89, 0x6A, 0x58, 0x97, 0xA3, 
-    0xBA, 0xAC, 0x94, 0x87, 0x7F, 0x68, 0x87, 0xBB, 0xA9, 0x9E, 
-    0xA3, 0x91, 0x59, 0x8A, 0xBB, 0x5E, 0x6C, 0xBD, 0x8F, 0x61, 
-    0x90, 0x91, 0x64, 0x64, 0x64, 0x57, 0x52, 0x48, 0x5B, 0x7A, 
-    0x58, 0x44, 0xA2, 0xA0, 0x73, 0x7D, 0x88, 0x72, 0x64, 0x92, 
-    0x9D, 0xBF, 0x9D, 0x7C, 0x75, 0x72, 0x9E, 0xA9, 0xB7, 0x8D, 
-    0x46, 0x81, 0x94, 0x7D, 0x73, 0x42, 0x5A, 0x81, 0x9A, 0xB3, 
-    0xA5, 0xA0, 0xB7, 0xAB, 0x7B, 0x86, 0x90, 0xAF, 0xB9, 0x98, 
-    0x8C, 0x65, 0x5D, 0x56, 0x55, 0x54, 0x46, 0x5C, 0x9E, 0x7D, 
-    0x46, 0x4C, 0x4F, 0xB1, 0xBA, 0x96, 0x82, 0x45, 0x80, 0xBA, 
-    0x99, 0x8E, 0x6E, 0x70, 0x98, 0x9F, 0xB4, 0xAA, 0x9B, 0x72, 
-    0x5A, 0x4B, 0x46, 0x73, 0x76, 0x5C, 0x70, 0xAD, 0x98, 0x76, 
-    0x8A, 0x96, 0x91, 0x8E, 0x75, 0x6D, 0x4B, 0x4B, 0xBB, 0xA5, 
-    0x62, 0x74, 0x92, 0x89, 0x7F, 0x99, 0xA1, 0xB2, 0xB4, 0x86, 
-    0x8D, 0xA5, 0xAC, 0xB8, 0x83, 0x4F, 0x78, 0x86, 0x4B, 0x43, 
-    0x77, 0x75, 0x67, 0x68, 0x6A, 0x7F, 0xA3, 0xA5, 0xA7, 0x9E, 
-    0x99, 0x73, 0x67, 0x9F, 0xA7, 0x6C, 0x64, 0x9E, 0x9B, 0x85, 
-    0x8B, 0xB7, 0xAE, 0x93, 0x94, 0x97, 0x7C, 0x4F, 0x72, 0x94, 
-    0x95, 0x95, 0xB0, 0xC0, 0xA5, 0x94, 0x63, 0x46, 0x8C, 0xB7, 
-    0x9F, 0x97, 0x8A, 0x85, 0xA5, 0xB0, 0x83, 0x7D, 0x88, 0x89, 
-    0x91, 0x87, 0x43, 0x56, 0x91, 0x8C, 0x7D, 0x75, 0x69, 0x7B, 
-    0x9A, 0xAA, 0xBB, 0x9F, 0x82, 0x9E, 0xAE, 0x77, 0x55, 0x6F, 
-    0x7E, 0x94, 0xA0, 0xB7, 0xBE, 0x81, 0x5C, 0x83, 0x9A, 0x91, 
-    0x8B, 0x96, 0x9C, 0x96, 0x92, 0x82, 0x79, 0x64, 0x57, 0x7E, 
-    0xA5, 0xAE, 0xB4, 0xA0, 0x8D, 0x9A, 0xB1, 0x89, 0x47, 0x48, 
-    0x49, 0x52, 0x6D, 0x68, 0x46, 0x51, 0x9E, 0xA1, 0xB3, 0xB0, 
-    0x94, 0x90, 0x73, 0x6E, 0x4C, 0x4C, 0x51, 0x51, 0x7A, 0x7A, 
-    0x67, 0x67, 0x7E, 0x7E, 0x6C, 0x69, 0x7C, 0x7E, 0x6D, 0x68, 
-    0x5C, 0x58, 0x84, 0x93, 0x7B, 0x6D, 0x6B, 0x68, 0x84, 0xA0, 
-    0x8B, 0x67, 0x70, 0x8D, 0x88, 0x6A, 0x6A, 0x84, 0x84, 0xAC, 
-    0xB2, 0x85, 0x76, 0x89, 0x90, 0x65, 0x4C, 0x64, 0x8C, 0x7E, 
-    0x51, 0x51, 0xAC, 0xAC, 0x75, 0x6D, 0x57, 0x4A, 0x53, 0x5C, 
-    0x5F, 0x62, 0x6D, 0x8C, 0x87, 0x65, 0x65, 0x53, 0x53, 0x83, 
-    0x8A, 0x92, 0x94, 0x64, 0x46, 0x5C, 0x71, 0x8D, 0xBC, 0x9F, 
-    0x47, 0x48, 0x4D, 0x4D, 0x60, 0x60, 0x5D, 0x5C, 0x72, 0x7E, 
-    0x80, 0x83, 0x75, 0x4C, 0x55, 0x8F, 0x8F, 0xA1, 0xA4, 0x8C, 
-    0x7E, 0x9E, 0xBD, 0xA8, 0x69, 0x69, 0xA1, 0xA1, 0x84, 0x7B, 
-    0x69, 0x57, 0x53, 0x45, 0x46, 0x9D, 0x9D, 0x96, 0x94, 0x81, 
-    0x61, 0x5F, 0x51, 0x51, 0x43, 0x41, 0x65, 0x89, 0x7C, 0x57, 
-    0x57, 0x86, 0x8C, 0x6E, 0x5B, 0x57, 0x51, 0x5D, 0xAF, 0xAF, 
-    0x5B, 0x4F, 0x53, 0x56, 0x82, 0xAF, 0x9D, 0x66, 0x66, 0x53, 
-    0x50, 0x90, 0xA5, 0x86, 0x53, 0x56, 0x6F, 0x6F, 0x65, 0x63, 
-    0x5C, 0x57, 0x66, 0x93, 0x93, 0x86, 0x84, 0xA3, 0xB6, 0x9B, 
-    0x6F, 0x6F, 0x95, 0x9A, 0xA8, 0xB0, 0x9E, 0x67, 0x67, 0x95, 
-    0x9C, 0x82, 0x68, 0x65, 0x5B, 0x5B, 0x69, 0x6E, 0x81, 0xA1, 
-    0xA1, 0x43, 0x43, 0x65, 0x87, 0x84, 0x69, 0x69, 0x92, 0x9F, 
-    0x9B, 0x8F, 0x8F, 0x96, 0x97, 0x7E, 0x54, 0x54, 0x69, 0x6C, 
-    0x6A, 0x68, 0x67, 0x60, 0x60, 0x4E, 0x49, 0x5F, 0x84, 0x84, 
-    0x77, 0x77, 0x57, 0x44, 0x5E, 0xAB, 0xAB, 0x62, 0x58, 0x87, 
-    0xB6, 0xAA, 0x54, 0x54, 0x52, 0x51, 0x53, 0x59, 0x59, 0x68, 
-    0x6C, 0x6D, 0x70, 0x70, 0x89, 0x8D, 0x9E, 0xBA, 0xBA, 0x59, 
-    0x4B, 0x50, 0x5A, 0x5A, 0x62, 0x64, 0x67, 0x6E, 0x6E, 0xAE, 
-    0xB7, 0x8E, 0x48, 0x48, 0x91, 0xA9, 0xA3, 0x92, 0x92, 0x6C, 
-    0x55, 0x5D, 0x99, 0x99, 0xA7, 0xAF, 0xAF, 0x97, 0x94, 0x94, 
-    0x95, 0x95, 0x94, 0x93, 0x8D, 0x60, 0x60, 0x73, 0x86, 0x86, 
-    0x4A, 0x4A, 0x61, 0x78, 0x78, 0x62, 0x62, 0x67, 0x6D, 0x6D, 
-    0xA4, 0xAC, 0x94, 0x6D, 0x6D, 0x54, 0x51, 0x67, 0x8D, 0x8D, 
-    0xAD, 0xB7, 0xB6, 0xAD, 0xAD, 0xA5, 0xA1, 0xA1, 0xAE, 0xAE, 
-    0x88, 0x49, 0x49, 0x58, 0x5D, 0x66, 0xA3, 0xA3, 0xA1, 0x9F, 
-    0x9F, 0xB6, 0xB9, 0xA3, 0x61, 0x61, 0x80, 0x92, 0x92, 0x50, 
-    0x46, 0x59, 0x90, 0x90, 0x6E, 0x4C, 0x4C, 0x5F, 0x65, 0x67, 
-    0x72, 0x72, 0x69, 0x4C, 0x4C, 0x78, 0x92, 0x92, 0x7E, 0x77, 
-    0x77, 0x68, 0x68, 0x68, 0x68, 0x68, 0x88, 0xA9, 0xA9, 0x6A, 
-    0x55, 0x55, 0x54, 0x54, 0x58, 0x78, 0x78, 0x90, 0xA8, 0xA8, 
-    0x77, 0x70, 0x76, 0x9F, 0x9F, 0xA5, 0xAB, 0xAB, 0x60, 0x47, 
-    0x47, 0x73, 0x73, 0x63, 0x48, 0x48, 0x8E, 0xB8, 0xB8, 0x78, 
-    0x6F, 0x72, 0x8B, 0x8B, 0x74, 0x4C, 0x4C, 0x64, 0x7C, 0x7C, 
-    0x86, 0x8A, 0x8A, 0x71, 0x6D, 0x73, 0x9F, 0x9F, 0x88, 0x45, 
-    0x45, 0x4F, 0x58, 0x58, 0x7B, 0x8F, 0x8F, 0x84, 0x81, 0x81, 
-    0xAF, 0xB6, 0xB6, 0x94, 0x90, 0x90, 0x6F, 0x6F, 0x74, 0x9A, 
-    0x9A, 0x97, 0x7C, 0x7C, 0x7F, 0x87, 0x87, 0x7C, 0x5D, 0x5D, 
-    0x60, 0x6B, 0x6B, 0x60, 0x4D, 0x4D, 0x63, 0x87, 0x87, 0x77, 
-    0x47, 0x47, 0x56, 0x6E, 0x6E, 0x89, 0xA4, 0xA4, 0xA9, 0xAC, 
-    0xAC, 0xA6, 0xA5, 0xA5, 0x9D, 0x9B, 0x9B, 0x55, 0x55, 0x5C, 
-    0x8A, 0x8A, 0x7D, 0x57, 0x57, 0x6C, 0xAB, 0xAB, 0x9A, 0x7E, 
-    0x7E, 0x8E, 0xA9, 0xA9, 0x94, 0x72, 0x72, 0x81, 0x90, 0x90, 
-    0x9E, 0xB6, 0xB6, 0xA4, 0x92, 0x92, 0x95, 0x9B, 0x9B, 0x82, 
-    0x57, 0x57, 0x68, 0x84, 0x84, 0x92, 0xB9, 0xB9, 0x9D, 0x47, 
-    0x47, 0x4D, 0x74, 0x74, 0x74, 0x7C, 0x7C, 0x7C, 0x84, 0x86, 
-    0x86, 0x78, 0x74, 0x74, 0x65, 0x5C, 0x5C, 0x56, 0x4C, 0x4C, 
-    0x4F, 0x56, 0x56, 0x5D, 0x92, 0x92, 0x92, 0x95, 0x96, 0x96, 
-    0xA2, 0xAA, 0xAA, 0x98, 0x7A, 0x7A, 0x82, 0xBA, 0xBA, 0xBA, 
-    0x6F, 0x64, 0x64, 0x63, 0x62, 0x62, 0x4D, 0x45, 0x46, 0x70, 
-    0x89, 0x89, 0x7F, 0x74, 0x74, 0x7C, 0x88, 0x88, 0x94, 0xB9, 
-    0xB9, 0xB9, 0xBA, 0xBA, 0xBA, 0x5C, 0x5D, 0x5D, 0x4F, 0x4B, 
-    0x4B, 0x76, 0x90, 0x90, 0x94, 0x9D, 0x9D, 0xA0, 0xAC, 0xAC, 
-    0xAC, 0x86, 0x81, 0x81, 0x82, 0x83, 0x83, 0x7A, 0x71, 0x71, 
-    0x72, 0x74, 0x74, 0x74, 0x6E, 0x6D, 0x6D, 0x92, 0xB7, 0xB7, 
-    0x9E, 0x55, 0x55, 0x55, 0x8D, 0x95, 0x95, 0x6E, 0x47, 0x47, 
-    0x48, 0x4D, 0x4D, 0x4D, 0x5C, 0x61, 0x61, 0x71, 0xA3, 0xA3, 
-    0xA3, 0x77, 0x71, 0x71, 0x84, 0xA6, 0xA5, 0xA5, 0x8A, 0x86, 
-    0x86, 0x87, 0x89, 0x89, 0x89, 0xA8, 0xAD, 0xAD, 0x93, 0x69, 
-    0x69, 0x69, 0x81, 0x89, 0x89, 0x91, 0xA9, 0xA9, 0xA9, 0xB2, 
-    0xB4, 0xB4, 0x90, 0x6C, 0x6C, 0x63, 0x48, 0x48, 0x48, 0x7C, 
-    0x84, 0x84, 0x78, 0x6C, 0x6C, 0x6B, 0x65, 0x65, 0x65, 0x89, 
-    0x9F, 0x9F, 0x96, 0x7B, 0x7B, 0x7B, 0x68, 0x62, 0x62, 0x5E, 
-    0x58, 0x58, 0x58, 0x56, 0x56, 0x56, 0x6F, 0x99, 0x99, 0x99, 
-    0x75, 0x6A, 0x6A, 0x63, 0x4F, 0x4F, 0x4F, 0x54, 0x57, 0x57, 
-    0x61, 0xAD, 0xAD, 0xAD, 0x85, 0x5E, 0x5E, 0x5E, 0x61, 0x61, 
-    0x61, 0x72, 0xA3, 0xA3, 0xA3, 0xAD, 0xB2, 0xB2, 0xB2, 0x83, 
-    0x7D, 0x7D, 0x71, 0x4D, 0x4D, 0x4D, 0x4F, 0x51, 0x51, 0x51, 
-    0x60, 0x65, 0x65, 0x65, 0x83, 0x87, 0x87, 0x84, 0x70, 0x70, 
-    0x70, 0x61, 0x47, 0x47, 0x48, 0x61, 0x7B, 0x7B, 0x7B, 0x68, 
-    0x5C, 0x5C, 0x5C, 0x60, 0x61, 0x61, 0x61, 0xAC, 0xB6, 0xB6, 
-    0xB6, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x68, 0x72, 
-    0x72, 0x72, 0x8E, 0x8E, 0x8E, 0x80, 0x68, 0x68, 0x68, 0x7C, 
-    0x88, 0x88, 0x88, 0x7B, 0x7B, 0x7B, 0x73, 0x5C, 0x5C, 0x5C, 
-    0x84, 0xAC, 0xAC, 0xAC, 0x7D, 0x61, 0x61, 0x61, 0x81, 0x86, 
-    0x86, 0x80, 0x54, 0x54, 0x54, 0x60, 0x82, 0x82, 0x82, 0x6E, 
-    0x4D, 0x4D, 0x4D, 0x73, 0x98, 0x98, 0x98, 0x73, 0x5E, 0x5E, 
-    0x5E, 0x57, 0x53, 0x53, 0x53, 0x8B, 0xAD, 0xAD, 0xAD, 0x91, 
-    0x7F, 0x7F, 0x7F, 0x94, 0xA1, 0xA1, 0xA1, 0xAA, 0xB0, 0xB0, 
-    0xB0, 0xA0, 0x90, 0x90, 0x90, 0x8D, 0x89, 0x89, 0x89, 0x92, 
-    0xA0, 0xA0, 0xA0, 0x94, 0x70, 0x70, 0x70, 0x6C, 0x52, 0x52, 
-    0x52, 0x52, 0x82, 0x89, 0x89, 0x89, 0x98, 0xA1, 0xA1, 0xA1, 
-    0xA7, 0xB3, 0xB3, 0xB3, 0xAE, 0x8C, 0x8C, 0x8C, 0x8C, 0xAB, 
-    0xAF, 0xAF, 0xAF, 0x89, 0x63, 0x63, 0x63, 0x71, 0x98, 0x98, 
-    0x98, 0x89, 0x5C, 0x5C, 0x5C, 0x62, 0x76, 0x76, 0x76, 0x78, 
-    0x7D, 0x7D, 0x7D, 0x77, 0x49, 0x49, 0x49, 0x51, 0x8D, 0x8D, 
-    0x8D, 0x8D, 0x69, 0x69, 0x69, 0x69, 0x50, 0x4C, 0x4C, 0x4C, 
-    0x97, 0xAF, 0xAF, 0xAF, 0xA5, 0x9B, 0x9B, 0x9B, 0x8C, 0x71, 
-    0x71, 0x71, 0x6D, 0x4D, 0x4D, 0x4D, 0x4D, 0x90, 0xA6, 0xA6, 
-    0xA6, 0xA1, 0x9C, 0x9C, 0x9C, 0x8A, 0x53, 0x53, 0x53, 0x53, 
-    0x5B, 0x5D, 0x5D, 0x5D, 0x57, 0x52, 0x52, 0x52, 0x57, 0x7B, 
-    0x7B, 0x7B, 0x7B, 0x67, 0x5B, 0x5B, 0x5B, 0x5D, 0x6C, 0x6C, 
-    0x6C, 0x6C, 0x84, 0x92, 0x92, 0x92, 0x8E, 0x72, 0x72, 0x72, 
-    0x72, 0x91, 0xA3, 0xA3, 0xA3, 0xA3, 0x73, 0x73, 0x73, 0x73, 
-    0x7B, 0x88, 0x88, 0x88, 0x88, 0x8E, 0x92, 0x92, 0x92, 0x8F, 
-    0x7B, 0x7B, 0x7B, 0x7B, 0x7F, 0x85, 0x85, 0x85, 0x85, 0x7A, 
-    0x70, 0x70, 0x70, 0x70, 0x68, 0x64, 0x64, 0x64, 0x64, 0xAB, 
-    0xB5, 0xB5, 0xB5, 0xAB, 0x68, 0x68, 0x68, 0x68, 0x70, 0xA5, 
-    0xA5, 0xA5, 0xA5, 0xAB, 0xAF, 0xAF, 0xAF, 0xA2, 0x7B, 0x7B, 
-    0x7B, 0x7B, 0x84, 0x87, 0x87, 0x87, 0x81, 0x6E, 0x6E, 0x6E, 
-    0x6E, 0x91, 0xA5, 0xA5, 0xA5, 0x9D, 0x63, 0x63, 0x63, 0x63, 
-    0x6D, 0x76, 0x76, 0x76, 0x76, 0x9B, 0xA7, 0xA7, 0xA7, 0xA9, 
-    0xB4, 0xB4, 0xB4, 0xB4, 0x95, 0x60, 0x60, 0x60, 0x60, 0x54, 
-    0x4C, 0x4C, 0x4C, 0x4C, 0x69, 0x6E, 0x6E, 0x6E, 0x71, 0x86, 
-    0x86, 0x86, 0x86, 0x84, 0x7C, 0x7C, 0x7C, 0x7C, 0x83, 0x8E, 
-    0x8E, 0x8E, 0x8E, 0x89, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x6D, 0x4E, 0x4E, 0x4E, 0x4E, 0x52, 0x59, 
-    0x59, 0x59, 0x59, 0x5A, 0x5D, 0x5D, 0x5D, 0x5D, 0x6C, 0x98, 
-    0x98, 0x98, 0x98, 0x98, 0x87, 0x87, 0x87, 0x87, 0x87, 0x92, 
-    0x95, 0x95, 0x95, 0x95, 0x6A, 0x50, 0x50, 0x50, 0x50, 0x5F, 
-    0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x62, 0x5C, 0x5C, 0x5C, 0x5C, 
-    0x60, 0x64, 0x64, 0x64, 0x64, 0x66, 0x73, 0x73, 0x73, 0x73, 
-    0x73, 0x78, 0x7D, 0x7D, 0x7D, 0x7D, 0x81, 0x9D, 0x9D, 0x9D, 
-    0x9D, 0x9D, 0x7A, 0x57, 0x57, 0x57, 0x57, 0x57, 0x5A, 0x5A, 
-    0x5A, 0x5A, 0x5A, 0x79, 0x7E, 0x7E, 0x7E, 0x7E, 0x6D, 0x68, 
-    0x68, 0x68, 0x68, 0x82, 0x8A, 0x8A, 0x8A, 0x8A, 0x67, 0x52, 
-    0x52, 0x52, 0x52, 0x5C, 0x66, 0x66, 0x66, 0x66, 0x6A, 0x75, 
-    0x75, 0x75, 0x75, 0x75, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0xA4, 
-    0xAC, 0xAC, 0xAC, 0xAC, 0xAA, 0xA9, 0xA9, 0xA9, 0xA9, 0xA4, 
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x66, 0x56, 0x56, 0x56, 0x57, 
-    0x61, 0x82, 0x82, 0x82, 0x82, 0x82, 0x86, 0x87, 0x87, 0x87, 
-    0x87, 0x85, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x69, 0x5B, 0x5B, 
-    0x5B, 0x5B, 0x5B, 0x7E, 0x83, 0x83, 0x83, 0x83, 0x8E, 0xAD, 
-    0xAD, 0xAD, 0xAD, 0xAD, 0x91, 0x75, 0x75, 0x75, 0x75, 0x75, 
-    0x8E, 0x97, 0x97, 0x97, 0x97, 0x97, 0x92, 0x91, 0x91, 0x91, 
-    0x91, 0x91, 0x62, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x62, 0x63, 
-    0x63, 0x63, 0x63, 0x63, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 
-    0x9C, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA6, 0xA8, 0xA8, 0xA8, 
-    0xA8, 0xA8, 0x87, 0x65, 0x65, 0x65, 0x65, 0x65, 0x78, 0xB1, 
-    0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0x63, 0x58, 0x58, 0x58, 0x58, 
-    0x58, 0x8E, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xA5, 0x6A, 0x6A, 
-    0x6A, 0x6A, 0x6A, 0x6A, 0x90, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 
-    0xA0, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x7F, 0xA1, 0xA1, 0xA1, 
-    0xA1, 0xA1, 0x98, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x80, 0x7B, 
-    0x7B, 0x7B, 0x7B, 0x7B, 0xA0, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 
-    0x85, 0x80, 0x80, 0x80, 0x80, 0x80, 0x58, 0x52, 0x52, 0x52, 
-    0x52, 0x52, 0x8C, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x69, 0x57, 
-    0x57, 0x57, 0x57, 0x58, 0x57, 0x56, 0x56, 0x56, 0x56, 0x56, 
-    0x5F, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0xA6, 0xA6, 0xA6, 
-    0xA6, 0xA6, 0xA6, 0x85, 0x72, 0x72, 0x72, 0x72, 0x72, 0x73, 
-    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x79, 0x7A, 0x7A, 0x7A, 
-    0x7A, 0x7A, 0x72, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x89, 
-    0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0x66, 0x5D, 0x5D, 0x5D, 
-    0x5D, 0x5D, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x72, 
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0xA4, 0xB0, 0xB0, 0xB0, 
-    0xB0, 0xB0, 0xB0, 0xA0, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 
-    0x8C, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x74, 0x74, 
-    0x74, 0x74, 0x74, 0x75, 0x75, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 
-    0xB1, 0xB1, 0x92, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x88, 
-    0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0xA8, 0xAB, 0xAB, 
-    0xAB, 0xAB, 0xAB, 0xAB, 0x8E, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 
-    0x5D, 0x5D, 0x82, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 
-    0x99, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0xA4, 0xA6, 
-    0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA8, 0xA8, 0xA8, 0xA8, 
-    0xA8, 0xA8, 0x9E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x93, 
-    0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0x76, 0x5A, 0x5A, 0x5A, 
-    0x5A, 0x5A, 0x5A, 0x61, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 
-    0x73, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x90, 0x9F, 0x9F, 
-    0x9F, 0x9F, 0x9F, 0x9F, 0x98, 0x84, 0x84, 0x84, 0x84, 0x84, 
-    0x84, 0x84, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x8B, 
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x84, 0x9D, 0x9D, 0x9D, 
-    0x9D, 0x9D, 0x9D, 0x9D, 0x8A, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xA6, 
-    0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x7D, 0x6D, 0x6D, 
-    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x74, 0x7B, 0x7B, 0x7B, 0x7B, 
-    0x7B, 0x7B, 0x7B, 0x85, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 
-    0x90, 0x79, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x58, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x8F, 0x9D, 
-    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x96, 0x8B, 0x8B, 0x8B, 
-    0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x98, 0x9C, 0x9C, 0x9C, 0x9C, 
-    0x9C, 0x9C, 0x9C, 0x9E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0x8B, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 
-    0x59, 0x5A, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 
-    0x7A, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xA4, 
-    0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x67, 
-    0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x60, 0x6D, 
-    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x75, 0x7A, 
-    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x5D, 0x54, 
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x6D, 0x71, 
-    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x68, 0x65, 
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x6D, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x7C, 0xAA, 0xAA, 0xAA, 0xA9, 0xA9, 
-    0xA9, 0xA9, 0xA9, 0x8A, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
-    0x77, 0x7D, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 
-    0xA5, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0x9C, 
-    0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x94, 0x95, 
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x75, 0x62, 0x62, 
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x65, 0x6A, 0x6A, 0x6A, 
-    0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6F, 0x8E, 0x8E, 0x8E, 0x8E, 
-    0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x92, 0x95, 0x95, 0x95, 0x95, 
-    0x95, 0x95, 0x95, 0x95, 0x92, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x7E, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 
-    0x7A, 0x7A, 0x7A, 0x7A, 0x7F, 0x89, 0x89, 0x89, 0x89, 0x89, 
-    0x89, 0x89, 0x89, 0x89, 0x87, 0x85, 0x85, 0x85, 0x85, 0x85, 
-    0x85, 0x85, 0x85, 0x85, 0x7F, 0x70, 0x70, 0x70, 0x70, 0x70, 
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x68, 0x65, 0x65, 0x65, 0x65, 
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x68, 0x6F, 0x6F, 0x6F, 0x6F, 
-    0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x7E, 0x98, 0x98, 0x98, 
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x8D, 0x81, 0x81, 
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x78, 0x6A, 
-    0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x71, 
-    0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 
-    0xA1, 0x8E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 
-    0x6E, 0x6E, 0x6E, 0x8C, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 
-    0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0xA3, 0xA6, 0xA6, 0xA6, 0xA6, 
-    0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA3, 0x9F, 0x9F, 
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 
-    0x9E, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 
-    0x9D, 0x9D, 0x9E, 0xA2, 0xA3, 0xA3, 0xA2, 0xA2, 0xA2, 0xA2, 
-    0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0x6C, 0x5A, 0x5A, 0x5A, 
-    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x67, 
-    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 
-    0x73, 0x73, 0x73, 0x60, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5D, 0x62, 0x62, 
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x74, 0x77, 
-    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 
-    0xA1, 0x6E, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 
-    0x5D, 0x5D, 0x79, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 
-    0xA7, 0xA7, 0xA7, 0xA7, 0x8C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 
-    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x79, 0x79, 0x79, 0x79, 
-    0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x78, 0x78, 
-    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 
-    0x6D, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 
-    0x62, 0x62, 0x62, 0x7C, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x75, 0x75, 0x75, 0x75, 
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x73, 0x66, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x66, 0x66, 0x68, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 
-    0x69, 0x69, 0x69, 0x69, 0x69, 0x6D, 0x87, 0x87, 0x87, 0x87, 
-    0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x85, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x00, 0x52, 0x49, 0x46, 0x46, 
+    0x90, 0x1D, 0x00, 0x00, 0x57, 0x41, 0x56, 0x45, 0x66, 0x6D, 
+    0x74, 0x20, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 
+    0x44, 0xAC, 0x00, 0x00, 0x44, 0xAC, 0x00, 0x00, 0x01, 0x00, 
+    0x08, 0x00, 0x64, 0x61, 0x74, 0x61, 0x6C, 0x1D, 0x00, 0x00, 
+    0xAE, 0x61, 0x9C, 0x90, 0xC5, 0xAA, 0xBB, 0x91, 0x71, 0xA3, 
+    0xA5, 0x83, 0x83, 0x69, 0xB0, 0xA5, 0xB5, 0x61, 0x9A, 0xB7, 
+    0x85, 0x99, 0x9E, 0xA1, 0xA5, 0x78, 0x6A, 0x68, 0x53, 0x67, 
+    0x53, 0x86, 0x55, 0x7A, 0x44, 0x80, 0x55, 0x98, 0x62, 0x5C, 
+    0x6A, 0x79, 0xB5, 0x72, 0x5A, 0x44, 0x85, 0xAE, 0xB2, 0x94, 
+    0x87, 0xA8, 0xBE, 0xAA, 0x69, 0x95, 0x82, 0x57, 0xA3, 0xB0, 
+    0x8E, 0xAE, 0x92, 0xAB, 0x85, 0x70, 0xAC, 0xA4, 0x7F, 0x9C, 
+    0x9E, 0x80, 0xAF, 0x37, 0x49, 0xC4, 0x6C, 0x5F, 0x4D, 0x46, 
+    0x96, 0xB8, 0x8F, 0x62, 0x68, 0x7B, 0x8F, 0x86, 0xB5, 0xB5, 
+    0xB5, 0x9D, 0x77, 0x93, 0xC2, 0xBB, 0xA0, 0x7C, 0x58, 0x89, 
+    0x7F, 0x68, 0x67, 0x8E, 0x9E, 0x7F, 0x78, 0x56, 0x4B, 0x6E, 
+    0x4E, 0x8C, 0xB8, 0xB6, 0xA2, 0x79, 0x73, 0xA4, 0x9E, 0x50, 
+    0x89, 0x51, 0x6E, 0x71, 0x80, 0x93, 0x8D, 0x76, 0x42, 0x7F, 
+    0x90, 0x7A, 0x6D, 0x66, 0x66, 0x73, 0x66, 0x4F, 0x3A, 0x9B, 
+    0x5E, 0x6A, 0x92, 0xAC, 0xAB, 0x7B, 0x69, 0x47, 0x6B, 0x97, 
+    0x6F, 0x5C, 0x7B, 0x93, 0x6E, 0x3E, 0x62, 0x58, 0x55, 0x5F, 
+    0x5B, 0x47, 0xA7, 0x7F, 0x99, 0x7A, 0x62, 0x63, 0x68, 0x89, 
+    0x56, 0x4E, 0x75, 0x9F, 0x9E, 0x61, 0x47, 0x43, 0x4B, 0x55, 
+    0x64, 0x89, 0xAF, 0xA0, 0x5A, 0x8E, 0x8A, 0x6B, 0x59, 0x63, 
+    0x90, 0x4F, 0x73, 0xA2, 0x9F, 0x6B, 0x51, 0xB8, 0x6C, 0x60, 
+    0x52, 0x4E, 0x63, 0xC5, 0x56, 0x9F, 0x8A, 0x7F, 0x9F, 0xC1, 
+    0x71, 0x71, 0x88, 0xA9, 0xA9, 0x43, 0x75, 0xA2, 0x82, 0x89, 
+    0xC2, 0xBE, 0xB1, 0x5C, 0x60, 0x65, 0x54, 0x39, 0x8E, 0x54, 
+    0x56, 0x7B, 0xA5, 0xAB, 0x52, 0x45, 0x71, 0x89, 0x4D, 0x95, 
+    0x91, 0x8C, 0x79, 0x4F, 0x5B, 0x97, 0x69, 0x61, 0x9B, 0xC5, 
+    0x4B, 0x73, 0x93, 0x95, 0xC0, 0x94, 0xA6, 0x98, 0x7A, 0x57, 
+    0x68, 0x88, 0x8F, 0x6E, 0x41, 0x5D, 0xB8, 0x85, 0x80, 0xAA, 
+    0x54, 0x41, 0x44, 0x5C, 0x81, 0x88, 0x8C, 0x9F, 0xAE, 0xB6, 
+    0xBD, 0xAF, 0xA0, 0x95, 0x8E, 0x50, 0x93, 0xBC, 0xB0, 0x8F, 
+    0x9A, 0xA5, 0x9E, 0x77, 0x7F, 0x4B, 0x48, 0x6B, 0xA8, 0x45, 
+    0x82, 0x68, 0x3D, 0x46, 0x44, 0x72, 0x87, 0x80, 0x98, 0xA6, 
+    0x8E, 0x67, 0x47, 0x63, 0x4D, 0x54, 0x7A, 0x50, 0x76, 0x8E, 
+    0x9A, 0x63, 0x9D, 0xA5, 0x9F, 0xC0, 0x81, 0x9D, 0xB1, 0x47, 
+    0x50, 0x5D, 0x63, 0x5C, 0x41, 0x71, 0x8D, 0x91, 0xAE, 0xA0, 
+    0xA1, 0xA7, 0xAC, 0xAE, 0xB9, 0xC1, 0xB9, 0xA4, 0xAD, 0xAA, 
+    0x81, 0xAE, 0x76, 0x6D, 0xC1, 0xC0, 0x9A, 0x67, 0x40, 0x96, 
+    0x71, 0x42, 0x48, 0x56, 0x7E, 0xA0, 0x82, 0x5B, 0x60, 0x7F, 
+    0xBD, 0x86, 0x69, 0x74, 0x46, 0x40, 0x41, 0x50, 0x55, 0x91, 
+    0xA9, 0x85, 0xAB, 0x8F, 0x65, 0x4D, 0x9F, 0x83, 0x58, 0x47, 
+    0x6B, 0x6D, 0x5E, 0x78, 0x97, 0x92, 0x4C, 0xAC, 0xAE, 0x9B, 
+    0x69, 0x75, 0x72, 0x5B, 0xA6, 0x7D, 0x70, 0xBC, 0xA4, 0x87, 
+    0x66, 0x7D, 0x63, 0x4C, 0x77, 0x67, 0x6D, 0x7F, 0xAD, 0x8C, 
+    0x49, 0x9E, 0x68, 0x4E, 0x5F, 0x50, 0x81, 0xB7, 0xC2, 0x6D, 
+    0x4D, 0x43, 0x6B, 0x7F, 0x88, 0x62, 0x66, 0x6F, 0x83, 0x95, 
+    0x9E, 0xA2, 0x81, 0x6B, 0x58, 0x67, 0x5A, 0x60, 0x7F, 0x79, 
+    0x82, 0xA5, 0xA9, 0x9C, 0x8E, 0x51, 0x4C, 0x53, 0xA6, 0x9D, 
+    0x92, 0x71, 0x55, 0x50, 0x71, 0x4F, 0x5F, 0x8B, 0x4E, 0x7E, 
+    0xB6, 0xA7, 0x86, 0x6D, 0x4A, 0x5B, 0x6A, 0x87, 0x74, 0x73, 
+    0x80, 0x88, 0x7F, 0x6F, 0xB4, 0xB7, 0xB1, 0x9B, 0x7F, 0x63, 
+    0x67, 0x52, 0x3E, 0xC1, 0x7E, 0x3C, 0x93, 0x67, 0x3C, 0x46, 
+    0x79, 0x99, 0x70, 0x93, 0xB6, 0x6C, 0x6F, 0x72, 0x5E, 0x5D, 
+    0x5F, 0x85, 0x89, 0x88, 0x7A, 0x77, 0x74, 0xA9, 0xB6, 0xBF, 
+    0x64, 0x65, 0x7C, 0x8A, 0x7E, 0x66, 0x7C, 0x83, 0x8A, 0x5E, 
+    0x67, 0x7F, 0x8A, 0x8F, 0x93, 0x5E, 0x55, 0x91, 0x89, 0x88, 
+    0xA4, 0x65, 0x40, 0x48, 0x5D, 0x72, 0xAB, 0x8B, 0x47, 0x4E, 
+    0x6C, 0xBD, 0x96, 0x7E, 0x55, 0x81, 0xAD, 0x75, 0x7F, 0x9C, 
+    0x5B, 0x4A, 0x6C, 0x72, 0x72, 0x5A, 0x88, 0xB5, 0x94, 0x89, 
+    0x75, 0x99, 0xA2, 0xA9, 0xA5, 0x99, 0x54, 0x7D, 0x96, 0xA5, 
+    0x98, 0x83, 0x8B, 0x79, 0x3F, 0x74, 0x86, 0xA9, 0x91, 0x7A, 
+    0x61, 0x6D, 0x9F, 0xB4, 0xC0, 0xA2, 0x9D, 0x95, 0x8D, 0x86, 
+    0x5E, 0x7B, 0x98, 0x5A, 0x63, 0x97, 0xAD, 0xBA, 0x7F, 0x77, 
+    0x5E, 0x50, 0x50, 0x6E, 0x73, 0x77, 0xB5, 0xA4, 0x56, 0x50, 
+    0x4D, 0x8E, 0x7F, 0x67, 0xA7, 0xA7, 0x69, 0x59, 0x48, 0x57, 
+    0x57, 0x4F, 0x82, 0xA1, 0x7C, 0x79, 0x75, 0x8A, 0x96, 0xC0, 
+    0xAA, 0x85, 0x6C, 0x5D, 0x9E, 0x9A, 0x92, 0x8F, 0x8D, 0xA7, 
+    0xA0, 0x89, 0x6A, 0x58, 0x97, 0xA3, 0xBA, 0xAC, 0x94, 0x87, 
+    0x7F, 0x68, 0x87, 0xBB, 0xA9, 0x9E, 0xA3, 0x91, 0x59, 0x8A, 
+    0xBB, 0x5E, 0x6C, 0xBD, 0x8F, 0x61, 0x90, 0x91, 0x64, 0x64, 
+    0x64, 0x57, 0x52, 0x48, 0x5B, 0x7A, 0x58, 0x44, 0xA2, 0xA0, 
+    0x73, 0x7D, 0x88, 0x72, 0x64, 0x92, 0x9D, 0xBF, 0x9D, 0x7C, 
+    0x75, 0x72, 0x9E, 0xA9, 0xB7, 0x8D, 0x46, 0x81, 0x94, 0x7D, 
+    0x73, 0x42, 0x5A, 0x81, 0x9A, 0xB3, 0xA5, 0xA0, 0xB7, 0xAB, 
+    0x7B, 0x86, 0x90, 0xAF, 0xB9, 0x98, 0x8C, 0x65, 0x5D, 0x56, 
+    0x55, 0x54, 0x46, 0x5C, 0x9E, 0x7D, 0x46, 0x4C, 0x4F, 0xB1, 
+    0xBA, 0x96, 0x82, 0x45, 0x80, 0xBA, 0x99, 0x8E, 0x6E, 0x70, 
+    0x98, 0x9F, 0xB4, 0xAA, 0x9B, 0x72, 0x5A, 0x4B, 0x46, 0x73, 
+    0x76, 0x5C, 0x70, 0xAD, 0x98, 0x76, 0x8A, 0x96, 0x91, 0x8E, 
+    0x75, 0x6D, 0x4B, 0x4B, 0xBB, 0xA5, 0x62, 0x74, 0x92, 0x89, 
+    0x7F, 0x99, 0xA1, 0xB2, 0xB4, 0x86, 0x8D, 0xA5, 0xAC, 0xB8, 
+    0x83, 0x4F, 0x78, 0x86, 0x4B, 0x43, 0x77, 0x75, 0x67, 0x68, 
+    0x6A, 0x7F, 0xA3, 0xA5, 0xA7, 0x9E, 0x99, 0x73, 0x67, 0x9F, 
+    0xA7, 0x6C, 0x64, 0x9E, 0x9B, 0x85, 0x8B, 0xB7, 0xAE, 0x93, 
+    0x94, 0x97, 0x7C, 0x4F, 0x72, 0x94, 0x95, 0x95, 0xB0, 0xC0, 
+    0xA5, 0x94, 0x63, 0x46, 0x8C, 0xB7, 0x9F, 0x97, 0x8A, 0x85, 
+    0xA5, 0xB0, 0x83, 0x7D, 0x88, 0x89, 0x91, 0x87, 0x43, 0x56, 
+    0x91, 0x8C, 0x7D, 0x75, 0x69, 0x7B, 0x9A, 0xAA, 0xBB, 0x9F, 
+    0x82, 0x9E, 0xAE, 0x77, 0x55, 0x6F, 0x7E, 0x94, 0xA0, 0xB7, 
+    0xBE, 0x81, 0x5C, 0x83, 0x9A, 0x91, 0x8B, 0x96, 0x9C, 0x96, 
+    0x92, 0x82, 0x79, 0x64, 0x57, 0x7E, 0xA5, 0xAE, 0xB4, 0xA0, 
+    0x8D, 0x9A, 0xB1, 0x89, 0x47, 0x48, 0x49, 0x52, 0x6D, 0x68, 
+    0x46, 0x51, 0x9E, 0xA1, 0xB3, 0xB0, 0x94, 0x90, 0x73, 0x6E, 
+    0x4C, 0x4C, 0x51, 0x51, 0x7A, 0x7A, 0x67, 0x67, 0x7E, 0x7E, 
+    0x6C, 0x69, 0x7C, 0x7E, 0x6D, 0x68, 0x5C, 0x58, 0x84, 0x93, 
+    0x7B, 0x6D, 0x6B, 0x68, 0x84, 0xA0, 0x8B, 0x67, 0x70, 0x8D, 
+    0x88, 0x6A, 0x6A, 0x84, 0x84, 0xAC, 0xB2, 0x85, 0x76, 0x89, 
+    0x90, 0x65, 0x4C, 0x64, 0x8C, 0x7E, 0x51, 0x51, 0xAC, 0xAC, 
+    0x75, 0x6D, 0x57, 0x4A, 0x53, 0x5C, 0x5F, 0x62, 0x6D, 0x8C, 
+    0x87, 0x65, 0x65, 0x53, 0x53, 0x83, 0x8A, 0x92, 0x94, 0x64, 
+    0x46, 0x5C, 0x71, 0x8D, 0xBC, 0x9F, 0x47, 0x48, 0x4D, 0x4D, 
+    0x60, 0x60, 0x5D, 0x5C, 0x72, 0x7E, 0x80, 0x83, 0x75, 0x4C, 
+    0x55, 0x8F, 0x8F, 0xA1, 0xA4, 0x8C, 0x7E, 0x9E, 0xBD, 0xA8, 
+    0x69, 0x69, 0xA1, 0xA1, 0x84, 0x7B, 0x69, 0x57, 0x53, 0x45, 
+    0x46, 0x9D, 0x9D, 0x96, 0x94, 0x81, 0x61, 0x5F, 0x51, 0x51, 
+    0x43, 0x41, 0x65, 0x89, 0x7C, 0x57, 0x57, 0x86, 0x8C, 0x6E, 
+    0x5B, 0x57, 0x51, 0x5D, 0xAF, 0xAF, 0x5B, 0x4F, 0x53, 0x56, 
+    0x82, 0xAF, 0x9D, 0x66, 0x66, 0x53, 0x50, 0x90, 0xA5, 0x86, 
+    0x53, 0x56, 0x6F, 0x6F, 0x65, 0x63, 0x5C, 0x57, 0x66, 0x93, 
+    0x93, 0x86, 0x84, 0xA3, 0xB6, 0x9B, 0x6F, 0x6F, 0x95, 0x9A, 
+    0xA8, 0xB0, 0x9E, 0x67, 0x67, 0x95, 0x9C, 0x82, 0x68, 0x65, 
+    0x5B, 0x5B, 0x69, 0x6E, 0x81, 0xA1, 0xA1, 0x43, 0x43, 0x65, 
+    0x87, 0x84, 0x69, 0x69, 0x92, 0x9F, 0x9B, 0x8F, 0x8F, 0x96, 
+    0x97, 0x7E, 0x54, 0x54, 0x69, 0x6C, 0x6A, 0x68, 0x67, 0x60, 
+    0x60, 0x4E, 0x49, 0x5F, 0x84, 0x84, 0x77, 0x77, 0x57, 0x44, 
+    0x5E, 0xAB, 0xAB, 0x62, 0x58, 0x87, 0xB6, 0xAA, 0x54, 0x54, 
+    0x52, 0x51, 0x53, 0x59, 0x59, 0x68, 0x6C, 0x6D, 0x70, 0x70, 
+    0x89, 0x8D, 0x9E, 0xBA, 0xBA, 0x59, 0x4B, 0x50, 0x5A, 0x5A, 
+    0x62, 0x64, 0x67, 0x6E, 0x6E, 0xAE, 0xB7, 0x8E, 0x48, 0x48, 
+    0x91, 0xA9, 0xA3, 0x92, 0x92, 0x6C, 0x55, 0x5D, 0x99, 0x99, 
+    0xA7, 0xAF, 0xAF, 0x97, 0x94, 0x94, 0x95, 0x95, 0x94, 0x93, 
+    0x8D, 0x60, 0x60, 0x73, 0x86, 0x86, 0x4A, 0x4A, 0x61, 0x78, 
+    0x78, 0x62, 0x62, 0x67, 0x6D, 0x6D, 0xA4, 0xAC, 0x94, 0x6D, 
+    0x6D, 0x54, 0x51, 0x67, 0x8D, 0x8D, 0xAD, 0xB7, 0xB6, 0xAD, 
+    0xAD, 0xA5, 0xA1, 0xA1, 0xAE, 0xAE, 0x88, 0x49, 0x49, 0x58, 
+    0x5D, 0x66, 0xA3, 0xA3, 0xA1, 0x9F, 0x9F, 0xB6, 0xB9, 0xA3, 
+    0x61, 0x61, 0x80, 0x92, 0x92, 0x50, 0x46, 0x59, 0x90, 0x90, 
+    0x6E, 0x4C, 0x4C, 0x5F, 0x65, 0x67, 0x72, 0x72, 0x69, 0x4C, 
+    0x4C, 0x78, 0x92, 0x92, 0x7E, 0x77, 0x77, 0x68, 0x68, 0x68, 
+    0x68, 0x68, 0x88, 0xA9, 0xA9, 0x6A, 0x55, 0x55, 0x54, 0x54, 
+    0x58, 0x78, 0x78, 0x90, 0xA8, 0xA8, 0x77, 0x70, 0x76, 0x9F, 
+    0x9F, 0xA5, 0xAB, 0xAB, 0x60, 0x47, 0x47, 0x73, 0x73, 0x63, 
+    0x48, 0x48, 0x8E, 0xB8, 0xB8, 0x78, 0x6F, 0x72, 0x8B, 0x8B, 
+    0x74, 0x4C, 0x4C, 0x64, 0x7C, 0x7C, 0x86, 0x8A, 0x8A, 0x71, 
+    0x6D, 0x73, 0x9F, 0x9F, 0x88, 0x45, 0x45, 0x4F, 0x58, 0x58, 
+    0x7B, 0x8F, 0x8F, 0x84, 0x81, 0x81, 0xAF, 0xB6, 0xB6, 0x94, 
+    0x90, 0x90, 0x6F, 0x6F, 0x74, 0x9A, 0x9A, 0x97, 0x7C, 0x7C, 
+    0x7F, 0x87, 0x87, 0x7C, 0x5D, 0x5D, 0x60, 0x6B, 0x6B, 0x60, 
+    0x4D, 0x4D, 0x63, 0x87, 0x87, 0x77, 0x47, 0x47, 0x56, 0x6E, 
+    0x6E, 0x89, 0xA4, 0xA4, 0xA9, 0xAC, 0xAC, 0xA6, 0xA5, 0xA5, 
+    0x9D, 0x9B, 0x9B, 0x55, 0x55, 0x5C, 0x8A, 0x8A, 0x7D, 0x57, 
+    0x57, 0x6C, 0xAB, 0xAB, 0x9A, 0x7E, 0x7E, 0x8E, 0xA9, 0xA9, 
+    0x94, 0x72, 0x72, 0x81, 0x90, 0x90, 0x9E, 0xB6, 0xB6, 0xA4, 
+    0x92, 0x92, 0x95, 0x9B, 0x9B, 0x82, 0x57, 0x57, 0x68, 0x84, 
+    0x84, 0x92, 0xB9, 0xB9, 0x9D, 0x47, 0x47, 0x4D, 0x74, 0x74, 
+    0x74, 0x7C, 0x7C, 0x7C, 0x84, 0x86, 0x86, 0x78, 0x74, 0x74, 
+    0x65, 0x5C, 0x5C, 0x56, 0x4C, 0x4C, 0x4F, 0x56, 0x56, 0x5D, 
+    0x92, 0x92, 0x92, 0x95, 0x96, 0x96, 0xA2, 0xAA, 0xAA, 0x98, 
+    0x7A, 0x7A, 0x82, 0xBA, 0xBA, 0xBA, 0x6F, 0x64, 0x64, 0x63, 
+    0x62, 0x62, 0x4D, 0x45, 0x46, 0x70, 0x89, 0x89, 0x7F, 0x74, 
+    0x74, 0x7C, 0x88, 0x88, 0x94, 0xB9, 0xB9, 0xB9, 0xBA, 0xBA, 
+    0xBA, 0x5C, 0x5D, 0x5D, 0x4F, 0x4B, 0x4B, 0x76, 0x90, 0x90, 
+    0x94, 0x9D, 0x9D, 0xA0, 0xAC, 0xAC, 0xAC, 0x86, 0x81, 0x81, 
+    0x82, 0x83, 0x83, 0x7A, 0x71, 0x71, 0x72, 0x74, 0x74, 0x74, 
+    0x6E, 0x6D, 0x6D, 0x92, 0xB7, 0xB7, 0x9E, 0x55, 0x55, 0x55, 
+    0x8D, 0x95, 0x95, 0x6E, 0x47, 0x47, 0x48, 0x4D, 0x4D, 0x4D, 
+    0x5C, 0x61, 0x61, 0x71, 0xA3, 0xA3, 0xA3, 0x77, 0x71, 0x71, 
+    0x84, 0xA6, 0xA5, 0xA5, 0x8A, 0x86, 0x86, 0x87, 0x89, 0x89, 
+    0x89, 0xA8, 0xAD, 0xAD, 0x93, 0x69, 0x69, 0x69, 0x81, 0x89, 
+    0x89, 0x91, 0xA9, 0xA9, 0xA9, 0xB2, 0xB4, 0xB4, 0x90, 0x6C, 
+    0x6C, 0x63, 0x48, 0x48, 0x48, 0x7C, 0x84, 0x84, 0x78, 0x6C, 
+    0x6C, 0x6B, 0x65, 0x65, 0x65, 0x89, 0x9F, 0x9F, 0x96, 0x7B, 
+    0x7B, 0x7B, 0x68, 0x62, 0x62, 0x5E, 0x58, 0x58, 0x58, 0x56, 
+    0x56, 0x56, 0x6F, 0x99, 0x99, 0x99, 0x75, 0x6A, 0x6A, 0x63, 
+    0x4F, 0x4F, 0x4F, 0x54, 0x57, 0x57, 0x61, 0xAD, 0xAD, 0xAD, 
+    0x85, 0x5E, 0x5E, 0x5E, 0x61, 0x61, 0x61, 0x72, 0xA3, 0xA3, 
+    0xA3, 0xAD, 0xB2, 0xB2, 0xB2, 0x83, 0x7D, 0x7D, 0x71, 0x4D, 
+    0x4D, 0x4D, 0x4F, 0x51, 0x51, 0x51, 0x60, 0x65, 0x65, 0x65, 
+    0x83, 0x87, 0x87, 0x84, 0x70, 0x70, 0x70, 0x61, 0x47, 0x47, 
+    0x48, 0x61, 0x7B, 0x7B, 0x7B, 0x68, 0x5C, 0x5C, 0x5C, 0x60, 
+    0x61, 0x61, 0x61, 0xAC, 0xB6, 0xB6, 0xB6, 0x4A, 0x4A, 0x4A, 
+    0x4A, 0x4A, 0x4A, 0x4A, 0x68, 0x72, 0x72, 0x72, 0x8E, 0x8E, 
+    0x8E, 0x80, 0x68, 0x68, 0x68, 0x7C, 0x88, 0x88, 0x88, 0x7B, 
+    0x7B, 0x7B, 0x73, 0x5C, 0x5C, 0x5C, 0x84, 0xAC, 0xAC, 0xAC, 
+    0x7D, 0x61, 0x61, 0x61, 0x81, 0x86, 0x86, 0x80, 0x54, 0x54, 
+    0x54, 0x60, 0x82, 0x82, 0x82, 0x6E, 0x4D, 0x4D, 0x4D, 0x73, 
+    0x98, 0x98, 0x98, 0x73, 0x5E, 0x5E, 0x5E, 0x57, 0x53, 0x53, 
+    0x53, 0x8B, 0xAD, 0xAD, 0xAD, 0x91, 0x7F, 0x7F, 0x7F, 0x94, 
+    0xA1, 0xA1, 0xA1, 0xAA, 0xB0, 0xB0, 0xB0, 0xA0, 0x90, 0x90, 
+    0x90, 0x8D, 0x89, 0x89, 0x89, 0x92, 0xA0, 0xA0, 0xA0, 0x94, 
+    0x70, 0x70, 0x70, 0x6C, 0x52, 0x52, 0x52, 0x52, 0x82, 0x89, 
+    0x89, 0x89, 0x98, 0xA1, 0xA1, 0xA1, 0xA7, 0xB3, 0xB3, 0xB3, 
+    0xAE, 0x8C, 0x8C, 0x8C, 0x8C, 0xAB, 0xAF, 0xAF, 0xAF, 0x89, 
+    0x63, 0x63, 0x63, 0x71, 0x98, 0x98, 0x98, 0x89, 0x5C, 0x5C, 
+    0x5C, 0x62, 0x76, 0x76, 0x76, 0x78, 0x7D, 0x7D, 0x7D, 0x77, 
+    0x49, 0x49, 0x49, 0x51, 0x8D, 0x8D, 0x8D, 0x8D, 0x69, 0x69, 
+    0x69, 0x69, 0x50, 0x4C, 0x4C, 0x4C, 0x97, 0xAF, 0xAF, 0xAF, 
+    0xA5, 0x9B, 0x9B, 0x9B, 0x8C, 0x71, 0x71, 0x71, 0x6D, 0x4D, 
+    0x4D, 0x4D, 0x4D, 0x90, 0xA6, 0xA6, 0xA6, 0xA1, 0x9C, 0x9C, 
+    0x9C, 0x8A, 0x53, 0x53, 0x53, 0x53, 0x5B, 0x5D, 0x5D, 0x5D, 
+    0x57, 0x52, 0x52, 0x52, 0x57, 0x7B, 0x7B, 0x7B, 0x7B, 0x67, 
+    0x5B, 0x5B, 0x5B, 0x5D, 0x6C, 0x6C, 0x6C, 0x6C, 0x84, 0x92, 
+    0x92, 0x92, 0x8E, 0x72, 0x72, 0x72, 0x72, 0x91, 0xA3, 0xA3, 
+    0xA3, 0xA3, 0x73, 0x73, 0x73, 0x73, 0x7B, 0x88, 0x88, 0x88, 
+    0x88, 0x8E, 0x92, 0x92, 0x92, 0x8F, 0x7B, 0x7B, 0x7B, 0x7B, 
+    0x7F, 0x85, 0x85, 0x85, 0x85, 0x7A, 0x70, 0x70, 0x70, 0x70, 
+    0x68, 0x64, 0x64, 0x64, 0x64, 0xAB, 0xB5, 0xB5, 0xB5, 0xAB, 
+    0x68, 0x68, 0x68, 0x68, 0x70, 0xA5, 0xA5, 0xA5, 0xA5, 0xAB, 
+    0xAF, 0xAF, 0xAF, 0xA2, 0x7B, 0x7B, 0x7B, 0x7B, 0x84, 0x87, 
+    0x87, 0x87, 0x81, 0x6E, 0x6E, 0x6E, 0x6E, 0x91, 0xA5, 0xA5, 
+    0xA5, 0x9D, 0x63, 0x63, 0x63, 0x63, 0x6D, 0x76, 0x76, 0x76, 
+    0x76, 0x9B, 0xA7, 0xA7, 0xA7, 0xA9, 0xB4, 0xB4, 0xB4, 0xB4, 
+    0x95, 0x60, 0x60, 0x60, 0x60, 0x54, 0x4C, 0x4C, 0x4C, 0x4C, 
+    0x69, 0x6E, 0x6E, 0x6E, 0x71, 0x86, 0x86, 0x86, 0x86, 0x84, 
+    0x7C, 0x7C, 0x7C, 0x7C, 0x83, 0x8E, 0x8E, 0x8E, 0x8E, 0x89, 
+    0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x6D, 
+    0x4E, 0x4E, 0x4E, 0x4E, 0x52, 0x59, 0x59, 0x59, 0x59, 0x5A, 
+    0x5D, 0x5D, 0x5D, 0x5D, 0x6C, 0x98, 0x98, 0x98, 0x98, 0x98, 
+    0x87, 0x87, 0x87, 0x87, 0x87, 0x92, 0x95, 0x95, 0x95, 0x95, 
+    0x6A, 0x50, 0x50, 0x50, 0x50, 0x5F, 0x8D, 0x8D, 0x8D, 0x8D, 
+    0x8D, 0x62, 0x5C, 0x5C, 0x5C, 0x5C, 0x60, 0x64, 0x64, 0x64, 
+    0x64, 0x66, 0x73, 0x73, 0x73, 0x73, 0x73, 0x78, 0x7D, 0x7D, 
+    0x7D, 0x7D, 0x81, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x7A, 0x57, 
+    0x57, 0x57, 0x57, 0x57, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x79, 
+    0x7E, 0x7E, 0x7E, 0x7E, 0x6D, 0x68, 0x68, 0x68, 0x68, 0x82, 
+    0x8A, 0x8A, 0x8A, 0x8A, 0x67, 0x52, 0x52, 0x52, 0x52, 0x5C, 
+    0x66, 0x66, 0x66, 0x66, 0x6A, 0x75, 0x75, 0x75, 0x75, 0x75, 
+    0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0xA4, 0xAC, 0xAC, 0xAC, 0xAC, 
+    0xAA, 0xA9, 0xA9, 0xA9, 0xA9, 0xA4, 0x81, 0x81, 0x81, 0x81, 
+    0x81, 0x66, 0x56, 0x56, 0x56, 0x57, 0x61, 0x82, 0x82, 0x82, 
+    0x82, 0x82, 0x86, 0x87, 0x87, 0x87, 0x87, 0x85, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x69, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x7E, 
+    0x83, 0x83, 0x83, 0x83, 0x8E, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 
+    0x91, 0x75, 0x75, 0x75, 0x75, 0x75, 0x8E, 0x97, 0x97, 0x97, 
+    0x97, 0x97, 0x92, 0x91, 0x91, 0x91, 0x91, 0x91, 0x62, 0x5B, 
+    0x5B, 0x5B, 0x5B, 0x5B, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x9C, 0xA0, 0xA0, 0xA0, 
+    0xA0, 0xA0, 0xA6, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0x87, 0x65, 
+    0x65, 0x65, 0x65, 0x65, 0x78, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 
+    0xB1, 0x63, 0x58, 0x58, 0x58, 0x58, 0x58, 0x8E, 0xAD, 0xAD, 
+    0xAD, 0xAD, 0xAD, 0xA5, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 
+    0x90, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA0, 0x6A, 0x6A, 0x6A, 
+    0x6A, 0x6A, 0x7F, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0x98, 0x8F, 
+    0x8F, 0x8F, 0x8F, 0x8F, 0x80, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 
+    0xA0, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0x85, 0x80, 0x80, 0x80, 
+    0x80, 0x80, 0x58, 0x52, 0x52, 0x52, 0x52, 0x52, 0x8C, 0x9F, 
+    0x9F, 0x9F, 0x9F, 0x9F, 0x69, 0x57, 0x57, 0x57, 0x57, 0x58, 
+    0x57, 0x56, 0x56, 0x56, 0x56, 0x56, 0x5F, 0x7B, 0x7B, 0x7B, 
+    0x7B, 0x7B, 0x7B, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0x85, 
+    0x72, 0x72, 0x72, 0x72, 0x72, 0x73, 0x77, 0x77, 0x77, 0x77, 
+    0x77, 0x77, 0x79, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x72, 0x58, 
+    0x58, 0x58, 0x58, 0x58, 0x58, 0x89, 0xA6, 0xA6, 0xA6, 0xA6, 
+    0xA6, 0xA6, 0x66, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5C, 0x5C, 
+    0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x72, 0x98, 0x98, 0x98, 0x98, 
+    0x98, 0x98, 0xA4, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xA0, 
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x8C, 0x99, 0x99, 0x99, 
+    0x99, 0x99, 0x99, 0x90, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 
+    0x75, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0x92, 0x80, 
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x88, 0x9E, 0x9E, 0x9E, 0x9E, 
+    0x9E, 0x9E, 0x9E, 0xA8, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 
+    0x8E, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x82, 0xA8, 
+    0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0x99, 0x94, 0x94, 0x94, 
+    0x94, 0x94, 0x94, 0x94, 0xA4, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 
+    0xA6, 0xA6, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0x9E, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x93, 0xA6, 0xA6, 0xA6, 0xA6, 
+    0xA6, 0xA6, 0x76, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x61, 
+    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x73, 0x81, 0x81, 0x81, 
+    0x81, 0x81, 0x81, 0x90, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 
+    0x98, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x9B, 0x9B, 
+    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x8B, 0x81, 0x81, 0x81, 0x81, 
+    0x81, 0x81, 0x84, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 
+    0x8A, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xAF, 0xAF, 
+    0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xA6, 0x8C, 0x8C, 0x8C, 0x8C, 
+    0x8C, 0x8C, 0x8C, 0x7D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 
+    0x6D, 0x74, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x85, 
+    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x79, 0x54, 0x54, 
+    0x54, 0x54, 0x54, 0x54, 0x54, 0x58, 0x66, 0x66, 0x66, 0x66, 
+    0x66, 0x66, 0x66, 0x66, 0x8F, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 
+    0x9D, 0x9D, 0x96, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 
+    0x8B, 0x98, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9E, 
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x8B, 0x59, 
+    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5A, 0x5C, 0x5C, 
+    0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x7A, 0xAC, 0xAC, 0xAC, 
+    0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xA4, 0x8A, 0x8A, 0x8A, 0x8A, 
+    0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x67, 0x5B, 0x5B, 0x5B, 0x5B, 
+    0x5B, 0x5B, 0x5B, 0x5B, 0x60, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 
+    0x6D, 0x6D, 0x6D, 0x6D, 0x75, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 
+    0x7A, 0x7A, 0x7A, 0x7A, 0x5D, 0x54, 0x54, 0x54, 0x54, 0x54, 
+    0x54, 0x54, 0x54, 0x54, 0x6D, 0x71, 0x71, 0x71, 0x71, 0x71, 
+    0x71, 0x71, 0x71, 0x71, 0x68, 0x65, 0x65, 0x65, 0x65, 0x65, 
+    0x65, 0x65, 0x6D, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
+    0x7C, 0xAA, 0xAA, 0xAA, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0x8A, 
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7D, 0xA6, 0xA6, 
+    0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA5, 0xA4, 0xA4, 0xA4, 
+    0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0x9C, 0x93, 0x93, 0x93, 0x93, 
+    0x93, 0x93, 0x93, 0x93, 0x94, 0x95, 0x95, 0x95, 0x95, 0x95, 
+    0x95, 0x95, 0x95, 0x75, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 
+    0x62, 0x62, 0x65, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 
+    0x6A, 0x6F, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 
+    0x8E, 0x92, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 
+    0x92, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x7E, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 
+    0x7F, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 
+    0x87, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 
+    0x7F, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 
+    0x70, 0x68, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 
+    0x65, 0x68, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 
+    0x6F, 0x6F, 0x7E, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 
+    0x98, 0x98, 0x98, 0x8D, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
+    0x81, 0x81, 0x81, 0x81, 0x78, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 
+    0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x71, 0xA1, 0xA1, 0xA1, 0xA1, 
+    0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0x8E, 0x6E, 0x6E, 
+    0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x8C, 
+    0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 
+    0x9E, 0xA3, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 
+    0xA6, 0xA6, 0xA6, 0xA3, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9D, 0x9D, 0x9D, 
+    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9E, 0xA2, 
+    0xA3, 0xA3, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 
+    0xA2, 0xA2, 0x6C, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x67, 0x73, 0x73, 0x73, 0x73, 
+    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x60, 
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
+    0x55, 0x55, 0x55, 0x5D, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 
+    0x62, 0x62, 0x62, 0x62, 0x74, 0x77, 0x77, 0x77, 0x77, 0x77, 
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x99, 0x99, 0x99, 0x99, 0x99, 
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xA1, 0xA1, 0xA1, 0xA1, 
+    0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0x6E, 0x5D, 0x5D, 
+    0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x79, 0xA7, 
+    0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 
+    0x8C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 
+    0x7C, 0x7C, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 
+    0x79, 0x79, 0x79, 0x79, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 
+    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x6D, 0x62, 0x62, 0x62, 
+    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x7C, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7E, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 
+    0x75, 0x75, 0x75, 0x75, 0x73, 0x66, 0x66, 0x66, 0x66, 0x66, 
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x68, 0x69, 
+    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 
+    0x69, 0x6D, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 
+    0x87, 0x87, 0x87, 0x87, 0x87, 0x85, 0x75, 0x75, 0x75, 0x75, 
     0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 
-    0x75, 0x75, 0x75, 0x75, 0x6A, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x70, 0x8C, 
-    0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 
-    0x8C, 0x8C, 0x8C, 0x85, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x7F, 
+    0x6A, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
+    0x66, 0x66, 0x66, 0x66, 0x70, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 
+    0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x85, 
+    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 
+    0x70, 0x70, 0x70, 0x70, 0x70, 0x7F, 0x84, 0x84, 0x84, 0x84, 
     0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 
-    0x84, 0x84, 0x84, 0x84, 0x82, 0x76, 0x74, 0x74, 0x74, 0x74, 
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 
-    0x74, 0x97, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 
-    0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA3, 0xA4, 0xA4, 
+    0x82, 0x76, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 
+    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x97, 0xA2, 0xA2, 
+    0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 
+    0xA2, 0xA2, 0xA2, 0xA3, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 
     0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 
-    0xA4, 0xA4, 0xA4, 0xA4, 0x9C, 0x6C, 0x64, 0x64, 0x64, 0x64, 
+    0x9C, 0x6C, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 
     0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 
     0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 
-    0x6A, 0x89, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 
-    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x85, 
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x6A, 0x89, 0x8F, 0x8F, 
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x85, 0x6A, 0x6A, 0x6A, 0x6A, 
     0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 
-    0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x83, 
+    0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x83, 0x9C, 0x9C, 0x9C, 0x9C, 
     0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 
-    0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x88, 
+    0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x88, 0x68, 0x68, 0x68, 0x68, 
     0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 
-    0x64, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 
+    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x64, 0x5E, 0x5E, 0x5E, 
     0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 
-    0x5E, 0x5E, 0x63, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 
+    0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x63, 0x6D, 
     0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 
-    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x79, 0x85, 0x85, 0x85, 0x85, 
-    0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 
-    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x8D, 
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 
+    0x6D, 0x79, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 
+    0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x84, 0x84, 0x84, 0x84, 
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x8D, 0x92, 0x92, 0x92, 0x92, 
     0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x75, 0x75, 0x75, 0x75, 0x75, 
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 
-    0x76, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 
-    0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x97, 0xA0, 0xA0, 
+    0x92, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 
+    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x76, 0x79, 0x79, 0x79, 
+    0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 
+    0x79, 0x79, 0x79, 0x97, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 
     0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 
-    0xA0, 0xA0, 0xA0, 0xA0, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 
-    0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 
-    0x8C, 0x68, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 
-    0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5D, 0x5E, 0x65, 
+    0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8C, 0x8C, 0x8C, 0x8C, 
+    0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x68, 0x5C, 0x5C, 
+    0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 
+    0x5C, 0x5C, 0x5C, 0x5D, 0x5E, 0x65, 0x65, 0x65, 0x65, 0x65, 
     0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x66, 0x66, 0x66, 
+    0x65, 0x65, 0x65, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
     0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x65, 0x62, 0x62, 0x62, 0x62, 
+    0x66, 0x65, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 
     0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x7E, 0x81, 0x81, 0x81, 0x81, 
+    0x62, 0x7E, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
     0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x92, 0x94, 0x94, 0x94, 0x94, 
+    0x81, 0x92, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 
     0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 
-    0x94, 0x94, 0x94, 0x94, 0x94, 0x92, 0x8F, 0x8F, 0x8F, 0x8F, 
-    0x8F, 0x8F, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 
-    0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x91, 0xA0, 0xA0, 0xA0, 
-    0xA0, 0xA0, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9A, 0x7A, 
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 
+    0x94, 0x92, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8E, 0x8E, 
+    0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 
+    0x8E, 0x8E, 0x91, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x9F, 0x9F, 
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9A, 0x7A, 0x75, 0x75, 0x75, 0x75, 
     0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 
-    0x75, 0x76, 0x7B, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 
+    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x76, 0x7B, 0x7C, 
     0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 
-    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x76, 0x66, 0x66, 0x66, 0x66, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 
+    0x7C, 0x76, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
     0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x63, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x63, 0x5D, 0x5D, 0x5D, 
     0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 
-    0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x64, 0x7A, 0x7A, 0x7A, 
-    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 
+    0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 
+    0x5D, 0x5D, 0x64, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 
     0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 
-    0x7A, 0x7A, 0x7A, 0x77, 0x67, 0x60, 0x60, 0x60, 0x60, 0x60, 
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x77, 
+    0x67, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 
     0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 
-    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 
-    0x60, 0x60, 0x67, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 
+    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x67, 0x7C, 
     0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 
     0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 
-    0x7C, 0x7C, 0x78, 0x68, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x78, 0x68, 
+    0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 
     0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 
     0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 
-    0x61, 0x61, 0x61, 0x61, 0x61, 0x77, 0x7E, 0x7E, 0x7E, 0x7E, 
+    0x61, 0x77, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
     0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
     0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
-    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x8D, 
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x8D, 0x9B, 0x9B, 0x9B, 0x9B, 
     0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 
     0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 
     0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9E, 0x9F, 0x9F, 0x9F, 
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 
+    0x9B, 0x9B, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 
+    0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 
     0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 
     0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 
-    0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x92, 0x7E, 0x7E, 0x7E, 0x7E, 
+    0x9E, 0x92, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
     0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
     0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
     0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
-    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7A, 0x72, 
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7A, 0x72, 0x6E, 0x6E, 0x6E, 0x6E, 
     0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 
     0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 
     0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 
     0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 
-    0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x77, 0x80, 0x80, 0x80, 
+    0x6E, 0x6E, 0x77, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
     0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
     0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
     0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
     0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x84, 
-    0x8C, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x84, 0x8C, 0x90, 0x90, 0x90, 
     0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 
     0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 
     0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 
     0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 
     0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 
-    0x8E, 0x88, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 
+    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8E, 0x88, 0x84, 0x84, 
     0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 
     0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 
     0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 
     0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 
     0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 
     0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 
-    0x84, 0x84, 0x84, 0x82, 0x7F, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x82, 
+    0x7F, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 
     0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 
     0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 
     0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 
@@ -2853,8 +2203,7 @@ unsigned char res_data[] = {
     0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 
     0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 
     0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 
-    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7D, 0x7F, 0x81, 0x82, 0x82, 
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 
+    0x7C, 0x7D, 0x7F, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 
     0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 
     0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 
     0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 
@@ -2867,10 +2216,11 @@ unsigned char res_data[] = {
     0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 
     0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 
     0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 
-    0x82, 0x84, 0x86, 0x8A, 0x8F, 0x91, 0x93, 0x93, 0x93, 0x93, 
+    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x84, 0x86, 0x8A, 
+    0x8F, 0x91, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 
     0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 
     0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 
-    0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 
+    0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x92, 0x92, 0x92, 
     0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 
     0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 
     0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 
@@ -2882,8 +2232,7 @@ unsigned char res_data[] = {
     0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 
     0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 
     0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 
-    0x92, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x91, 0x91, 0x91, 
     0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 
     0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 
     0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 
@@ -2895,8 +2244,8 @@ unsigned char res_data[] = {
     0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 
     0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 
     0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x90, 0x90, 0x90, 0x90, 0x90, 
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 
+    0x91, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 
     0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 
     0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 
     0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 
@@ -2908,7 +2257,7 @@ unsigned char res_data[] = {
     0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 
     0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 
     0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 
-    0x90, 0x90, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 
+    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8F, 0x8F, 
     0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 
     0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 
     0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 
@@ -2920,7 +2269,8 @@ unsigned char res_data[] = {
     0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 
     0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 
     0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 
-    0x8F, 0x8F, 0x8F, 0x8B, 0x89, 0x86, 0x83, 0x81, 0x81, 0x81, 
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8B, 
+    0x89, 0x86, 0x83, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
     0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
     0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
     0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
@@ -2939,8 +2289,7 @@ unsigned char res_data[] = {
     0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
     0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
     0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7F, 
-    0x7D, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 
+    0x81, 0x81, 0x81, 0x81, 0x80, 0x7F, 0x7D, 0x7C, 0x7C, 0x7C, 
     0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 
     0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 
     0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 
@@ -2955,22 +2304,22 @@ unsigned char res_data[] = {
     0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 
     0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 
     0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 
-    0x7C, 0x7F, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7F, 0x82, 0x82, 
+    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 
     0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 
     0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 
     0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 
     0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 
     0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 
+    0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
     0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
     0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
     0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
     0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
     0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
     0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x83, 0x88, 0x89, 0x89, 0x89, 
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
+    0x81, 0x83, 0x88, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 
+    0x89, 0x89, 0x89, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
     0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
     0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
     0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
@@ -2981,7 +2330,7 @@ unsigned char res_data[] = {
     0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
     0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
     0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x87, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x80, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
@@ -2993,8 +2342,9 @@ unsigned char res_data[] = {
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7A, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x77, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7A, 0x76, 0x76, 0x76, 
+    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
+    0x76, 0x76, 0x76, 0x76, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 
     0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
     0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
     0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
@@ -3004,9 +2354,8 @@ unsigned char res_data[] = {
     0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
     0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
     0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
-    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7B, 0x7E, 0x7E, 0x7E, 
-    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
-    0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x77, 0x77, 0x7B, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
@@ -3016,8 +2365,8 @@ unsigned char res_data[] = {
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x80, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x8B, 
-    0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x8C, 0x8C, 0x8C, 
+    0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 
     0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 
     0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 
     0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 
@@ -3027,19 +2376,19 @@ unsigned char res_data[] = {
     0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 
     0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 
     0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 
-    0x8B, 0x8A, 0x8A, 0x8A, 0x8A, 0x89, 0x89, 0x89, 0x89, 0x89, 
+    0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8A, 0x8A, 0x8A, 
+    0x8A, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 
     0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 
     0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 
     0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 
     0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 
     0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 
     0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 
-    0x89, 0x89, 0x89, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
     0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
     0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
     0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x82, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
+    0x88, 0x88, 0x88, 0x88, 0x82, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
@@ -3050,18 +2399,19 @@ unsigned char res_data[] = {
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x78, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x78, 
     0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
     0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
     0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
+    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x77, 
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
     0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
     0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
     0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
     0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
     0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
     0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
-    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x7E, 0x7E, 0x7E, 0x7E, 
     0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
     0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
     0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
@@ -3073,9 +2423,9 @@ unsigned char res_data[] = {
     0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
     0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
     0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
-    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7C, 0x78, 
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7C, 0x78, 0x78, 0x78, 0x78, 0x78, 
     0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 
-    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x79, 
+    0x78, 0x78, 0x78, 0x78, 0x78, 0x79, 0x79, 0x79, 0x79, 0x79, 
     0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 
     0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 
     0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 
@@ -3085,8 +2435,7 @@ unsigned char res_data[] = {
     0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 
     0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 
     0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 
-    0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 
-    0x7D, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
+    0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7D, 0x7E, 0x7E, 0x7E, 
     0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
     0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
     0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
@@ -3095,13 +2444,13 @@ unsigned char res_data[] = {
     0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
     0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
     0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7A, 0x7A, 0x7A, 0x7A, 
-    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 
+    0x7F, 0x7F, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 
     0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 
-    0x7A, 0x7A, 0x7A, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7B, 
     0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 
     0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 
     0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 
@@ -3111,8 +2460,8 @@ unsigned char res_data[] = {
     0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 
     0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 
     0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 
-    0x7B, 0x7B, 0x7B, 0x7C, 0x7C, 0x7C, 0x7D, 0x7D, 0x7D, 0x7D, 
-    0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 
+    0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7C, 
+    0x7C, 0x7C, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 
     0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 
     0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 
     0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 
@@ -3124,8 +2473,8 @@ unsigned char res_data[] = {
     0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 
     0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 
     0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 
-    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 
-    0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7E, 0x7E, 0x7E, 0x7E, 
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
@@ -3152,27 +2501,1739 @@ unsigned char res_data[] = {
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
     0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 
-};
-const char * res_data_name_list[] = {
-    "shaders.glsl",
-    "bit.png",
-    "bit.fnt",
-    "click.wav",
-    "hurt.wav",
-};
-const int res_data_offset_list[] = {
-    0,
-    2320,
-    4138,
-    15266,
-    23953,
-};
-const int res_data_size_list[] = {
-    2320,
-    1818,
-    11128,
-    8687,
-    7576,
-};
-const int res_data_count = 5;
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x42, 0x54, 0x45, 0x58, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 
+    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+const char * const res_data_name_list[] = {
+    "shaders.glsl",
+    "bit.bfnt",
+    "click.wav",
+    "hurt.wav",
+    "atlas.tex",
+};
+const int res_data_offset_list[] = {
+    0,
+    5008,
+    8768,
+    17456,
+    25040,
+};
+const int res_data_size_list[] = {
+    5006,
+    3748,
+    8687,
+    7576,
+    16416,
+};
+const int res_data_count = 5;
+const unsigned int res_data_hash_list[] = {
+    0xC0EEE619u,
+    0x722E7B68u,
+    0xEEF417D3u,
+    0x19713694u,
+    0x68F1AB03u,
+};
+const int res_data_disp_list[] = {
+    0,
+    0,
+    0,
+    0,
+};
+const int res_data_disp_count = 4;
+const int res_data_slot_list[] = {
+    -1,
+    -1,
+    -1,
+    -1,
+    4,
+    -1,
+    -1,
+    2,
+    3,
+    -1,
+    -1,
+    0,
+    -1,
+    1,
+    -1,
+    -1,
+};
+const int res_data_slot_count = 16;
+const char * const res_atlas_name_list[] = {
+    "bit.png",
+};
+const int res_atlas_x_list[] = {
+    0,
+};
+const int res_atlas_y_list[] = {
+    0,
+};
+const int res_atlas_w_list[] = {
+    510,
+};
+const int res_atlas_h_list[] = {
+    13,
+};
+const int res_atlas_trim_x_list[] = {
+    0,
+};
+const int res_atlas_trim_y_list[] = {
+    0,
+};
+const int res_atlas_count = 1;
+const unsigned int res_atlas_hash_list[] = {
+    0x58A13EF5u,
+};
+const int res_atlas_disp_list[] = {
+    0,
+};
+const int res_atlas_disp_count = 1;
+const int res_atlas_slot_list[] = {
+    0,
+    -1,
+};
+const int res_atlas_slot_count = 2;
+const int res_atlas_width = 512;
+const int res_atlas_height = 16;
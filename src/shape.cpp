@@ -73,6 +73,12 @@ int rect_t::contains( float ox, float oy ) const
     return ox >= x && ox <= x + w && oy >= y && oy <= y + h;
 }
 
+int rect_t::overlaps( rect_t other ) const
+{
+    return other.x <= x + w && other.x + other.w >= x && other.y <= y + h &&
+           other.y + other.h >= y;
+}
+
 void ngon_vertices( float * out_data, int n )
 {
     out_data[ 0 ] = 0.0f;
@@ -28,6 +28,7 @@ struct rect_t {
     }
 
     int contains( float x, float y ) const;
+    int overlaps( rect_t other ) const;
 };
 
 int intersect_line_and_rect(
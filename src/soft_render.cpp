@@ -0,0 +1,903 @@
+#include "soft_render.hpp"
+
+#include "loader.hpp"
+#include "logging.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <math.h>
+#include <mutex>
+#include <string.h>
+#include <thread>
+
+#if defined( __SSE2__ ) || defined( _M_X64 )
+#include <emmintrin.h>
+#define SOFT_SSE 1
+#else
+#define SOFT_SSE 0
+#endif
+
+// tile based rasterizer for the render command buffer. triangles are binned
+// into tiles, every tile is then filled on its own, which is what lets tiles
+// run on several threads without locking. coverage and blending follow gl
+// (pixel centers, top left fill rule, src alpha over) closely enough that
+// frames match the gl backend up to rounding, and the sse and scalar paths
+// do the same float operations in the same order so their output is
+// identical
+
+static const int k_tile_size = 64;
+static const int k_max_workers = 15; // besides the submitting thread
+
+/// screen space triangle, wound so its area is positive
+struct soft_tri_t {
+    float x[ 3 ];
+    float y[ 3 ];
+    float u[ 3 ];
+    float v[ 3 ];
+    float color[ 4 ]; // clamped like a unorm target
+    int textured;
+    uint32_t opaque; // the packed color when it replaces the target, or 0
+
+    // covered pixel centers, not clipped to the target
+    int x0;
+    int y0;
+    int x1;
+    int y1;
+};
+
+static struct {
+    // the atlas is the only texture commands refer to
+    unsigned char * atlas;
+    int atlas_w;
+    int atlas_h;
+
+    soft_tri_t * tri_list;
+    int tri_count;
+    int tri_cap;
+
+    // command expansion scratch
+    float * pos_data;
+    float * uv_data;
+    float * color_data;
+    int vertex_cap;
+
+    // bins of tile t are bin_list[ tile_start_list[ t ] ..
+    // tile_start_list[ t + 1 ] ]
+    int * tile_start_list;
+    int tile_cap;
+    int * bin_list;
+    int bin_cap;
+    int tile_x_count;
+    int tile_y_count;
+
+    uint32_t * scratch; // copy of the target for the world effect
+    int scratch_size;
+
+    soft_stats_t stats;
+
+    // workers live as long as the renderer and sleep between passes. every
+    // pass bumps pass_index, they take tiles until none are left and the
+    // last one out wakes the submitting thread
+    struct {
+        std::thread worker_list[ k_max_workers ];
+        int worker_count;
+
+        std::mutex mutex;
+        std::condition_variable start_cond;
+        std::condition_variable done_cond;
+        uint64_t pass_index;
+        int busy_count;
+        int quit;
+
+        soft_target_t * target;
+        int tile_count;
+        std::atomic< int > next_tile;
+    } pool;
+} intern;
+
+void soft_target_t::init( int new_width, int new_height )
+{
+    pixels = new uint32_t[ new_width * new_height ];
+    width = new_width;
+    height = new_height;
+}
+
+void soft_target_t::destroy()
+{
+    delete[] pixels;
+    pixels = nullptr;
+    width = 0;
+    height = 0;
+}
+
+static void raster_tile( int tile, soft_target_t * target );
+
+/// takes tiles of the current pass until there are none left
+static void raster_tiles()
+{
+    for ( ;; ) {
+        int t = intern.pool.next_tile.fetch_add( 1 );
+        if ( t >= intern.pool.tile_count ) break;
+        raster_tile( t, intern.pool.target );
+    }
+}
+
+static void worker_main()
+{
+    uint64_t seen = 0;
+
+    std::unique_lock< std::mutex > lock( intern.pool.mutex );
+
+    for ( ;; ) {
+        intern.pool.start_cond.wait( lock, [ & ] {
+            return intern.pool.quit || intern.pool.pass_index != seen;
+        } );
+        if ( intern.pool.quit ) break;
+
+        seen = intern.pool.pass_index;
+        lock.unlock();
+
+        raster_tiles();
+
+        lock.lock();
+        if ( --intern.pool.busy_count == 0 ) {
+            intern.pool.done_cond.notify_one();
+        }
+    }
+}
+
+int soft_render_init( int thread_count )
+{
+
+    image_t atlas = load_image( "atlas.tex" ).get();
+
+    if ( !atlas.pixels ) {
+        ERROR_LOG( "failed to decode the atlas" );
+        return 1;
+    }
+
+    // kept past loader_flush(), as rgba8 whatever the baked format
+    int pixel_count = atlas.width * atlas.height;
+    intern.atlas = new unsigned char[ pixel_count * 4 ];
+    intern.atlas_w = atlas.width;
+    intern.atlas_h = atlas.height;
+
+    if ( atlas.format == IMAGE_RGBA4444 ) {
+        for ( int i = 0; i < pixel_count; i++ ) {
+            uint16_t p;
+            memcpy( &p, atlas.pixels + i * 2, 2 );
+            intern.atlas[ i * 4 + 0 ] = ( ( p >> 12 ) & 15 ) * 17;
+            intern.atlas[ i * 4 + 1 ] = ( ( p >> 8 ) & 15 ) * 17;
+            intern.atlas[ i * 4 + 2 ] = ( ( p >> 4 ) & 15 ) * 17;
+            intern.atlas[ i * 4 + 3 ] = ( p & 15 ) * 17;
+        }
+    } else {
+        memcpy( intern.atlas, atlas.pixels, pixel_count * 4 );
+    }
+
+    int worker_count = thread_count - 1;
+    if ( worker_count < 0 ) worker_count = 0;
+    if ( worker_count > k_max_workers ) worker_count = k_max_workers;
+
+    intern.pool.quit = 0;
+    intern.pool.worker_count = worker_count;
+    for ( int i = 0; i < worker_count; i++ ) {
+        intern.pool.worker_list[ i ] = std::thread( worker_main );
+    }
+
+    return 0;
+}
+
+void soft_render_destroy()
+{
+    {
+        std::lock_guard< std::mutex > lock( intern.pool.mutex );
+        intern.pool.quit = 1;
+    }
+    intern.pool.start_cond.notify_all();
+    for ( int i = 0; i < intern.pool.worker_count; i++ ) {
+        intern.pool.worker_list[ i ].join();
+    }
+    intern.pool.worker_count = 0;
+
+    delete[] intern.atlas;
+    delete[] intern.tri_list;
+    delete[] intern.pos_data;
+    delete[] intern.uv_data;
+    delete[] intern.color_data;
+    delete[] intern.tile_start_list;
+    delete[] intern.bin_list;
+    delete[] intern.scratch;
+
+    intern.atlas = nullptr;
+    intern.tri_list = nullptr;
+    intern.tri_cap = 0;
+    intern.pos_data = nullptr;
+    intern.uv_data = nullptr;
+    intern.color_data = nullptr;
+    intern.vertex_cap = 0;
+    intern.tile_start_list = nullptr;
+    intern.tile_cap = 0;
+    intern.bin_list = nullptr;
+    intern.bin_cap = 0;
+    intern.scratch = nullptr;
+    intern.scratch_size = 0;
+}
+
+const soft_stats_t & soft_render_stats()
+{
+    return intern.stats;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// command expansion
+////////////////////////////////////////////////////////////////////////////////
+
+static void reserve_vertices( int count )
+{
+    if ( count <= intern.vertex_cap ) return;
+
+    int cap = intern.vertex_cap ? intern.vertex_cap : 1024;
+    while ( cap < count ) {
+        cap *= 2;
+    }
+
+    delete[] intern.pos_data;
+    delete[] intern.uv_data;
+    delete[] intern.color_data;
+    intern.pos_data = new float[ cap * 2 ];
+    intern.uv_data = new float[ cap * 2 ];
+    intern.color_data = new float[ cap * 4 ];
+    intern.vertex_cap = cap;
+}
+
+static soft_tri_t * push_tri()
+{
+    if ( intern.tri_count >= intern.tri_cap ) {
+        int cap = intern.tri_cap ? intern.tri_cap * 2 : 4096;
+        soft_tri_t * list = new soft_tri_t[ cap ];
+        if ( intern.tri_count > 0 ) {
+            memcpy(
+                list,
+                intern.tri_list,
+                sizeof( soft_tri_t ) * intern.tri_count
+            );
+        }
+        delete[] intern.tri_list;
+        intern.tri_list = list;
+        intern.tri_cap = cap;
+    }
+
+    soft_tri_t * tri = intern.tri_list + intern.tri_count;
+    intern.tri_count++;
+    return tri;
+}
+
+static void blend_pixel( uint32_t * dst, const float * src );
+
+static float clamp01( float x )
+{
+    return x < 0.0f ? 0.0f : ( x > 1.0f ? 1.0f : x );
+}
+
+/// pos in target pixels. color_stride 0 uses one color for every triangle,
+/// 4 takes the color of the first vertex of each
+static void push_triangles(
+    int vertex_count,
+    const float * pos,
+    const float * uv,
+    const float * color,
+    int color_stride
+)
+{
+    for ( int t = 0; t + 2 < vertex_count; t += 3 ) {
+        float x[ 3 ];
+        float y[ 3 ];
+        for ( int k = 0; k < 3; k++ ) {
+            x[ k ] = pos[ ( t + k ) * 2 + 0 ];
+            y[ k ] = pos[ ( t + k ) * 2 + 1 ];
+        }
+
+        float area = ( y[ 1 ] - y[ 2 ] ) * x[ 0 ] +
+                     ( x[ 2 ] - x[ 1 ] ) * y[ 0 ] +
+                     ( x[ 1 ] * y[ 2 ] - x[ 2 ] * y[ 1 ] );
+        if ( area == 0.0f ) continue;
+
+        // vertex order with a positive area
+        int order[ 3 ] = { 0, 1, 2 };
+        if ( area < 0.0f ) {
+            order[ 1 ] = 2;
+            order[ 2 ] = 1;
+        }
+
+        soft_tri_t * tri = push_tri();
+        for ( int k = 0; k < 3; k++ ) {
+            int v = t + order[ k ];
+            tri->x[ k ] = x[ order[ k ] ];
+            tri->y[ k ] = y[ order[ k ] ];
+            tri->u[ k ] = uv ? uv[ v * 2 + 0 ] : 0.0f;
+            tri->v[ k ] = uv ? uv[ v * 2 + 1 ] : 0.0f;
+        }
+
+        const float * c = color + t * color_stride;
+        for ( int k = 0; k < 4; k++ ) {
+            tri->color[ k ] = clamp01( c[ k ] );
+        }
+        tri->textured = uv != nullptr;
+
+        // blending over anything gives the same pixel, packed once here
+        tri->opaque = 0;
+        if ( !tri->textured && tri->color[ 3 ] == 1.0f ) {
+            blend_pixel( &tri->opaque, tri->color );
+        }
+
+        float min_x = fminf( fminf( x[ 0 ], x[ 1 ] ), x[ 2 ] );
+        float min_y = fminf( fminf( y[ 0 ], y[ 1 ] ), y[ 2 ] );
+        float max_x = fmaxf( fmaxf( x[ 0 ], x[ 1 ] ), x[ 2 ] );
+        float max_y = fmaxf( fmaxf( y[ 0 ], y[ 1 ] ), y[ 2 ] );
+
+        // pixel i is covered when its center i + 0.5 is inside
+        tri->x0 = (int) ceilf( min_x - 0.5f );
+        tri->y0 = (int) ceilf( min_y - 0.5f );
+        tri->x1 = (int) floorf( max_x - 0.5f ) + 1;
+        tri->y1 = (int) floorf( max_y - 0.5f ) + 1;
+    }
+}
+
+static affine_t
+make_camera( const render_cmd_t & cmd, const soft_target_t * target )
+{
+    rect_t pixels;
+    pixels.x = 0.0f;
+    pixels.y = 0.0f;
+    pixels.w = target->width;
+    pixels.h = target->height;
+    return affine_rect_to_rect( cmd.camera.view, pixels );
+}
+
+static void expand_commands(
+    const render_cmd_buffer_t * buffer,
+    int first,
+    int last,
+    const soft_target_t * target
+)
+{
+    affine_t cam = affine_identity();
+
+    for ( int i = first; i < last; i++ ) {
+        const render_cmd_t & cmd = buffer->sorted( i );
+
+        switch ( cmd.type ) {
+        case CMD_CAMERA:
+            cam = make_camera( cmd, target );
+            break;
+
+        case CMD_LEVEL: {
+            int count = level_vertex_count( cmd );
+            reserve_vertices( count );
+            level_vertices( cmd, intern.pos_data, intern.color_data );
+            affine_apply( cam, intern.pos_data, intern.pos_data, count );
+            push_triangles(
+                count,
+                intern.pos_data,
+                nullptr,
+                intern.color_data,
+                4
+            );
+        } break;
+
+        case CMD_SHAPE:
+        case CMD_RECT: {
+            reserve_vertices( solid_vertex_count( cmd ) );
+            int count = solid_vertices( cmd, cam, intern.pos_data );
+
+            int shape = cmd.type == CMD_SHAPE;
+            color_t c = shape ? cmd.shape.color : cmd.rect.color;
+            float alpha = shape ? cmd.shape.alpha : cmd.rect.alpha;
+            float color[ 4 ] = { c.r, c.g, c.b, alpha };
+            push_triangles( count, intern.pos_data, nullptr, color, 0 );
+        } break;
+
+        case CMD_POLYGON: {
+            // tessellated, the edges are not antialiased here
+            reserve_vertices( polygon_vertex_count( cmd ) );
+            int count = polygon_vertices( cmd, cam, intern.pos_data );
+
+            color_t c = cmd.polygon.color;
+            float color[ 4 ] = { c.r, c.g, c.b, cmd.polygon.alpha };
+            push_triangles( count, intern.pos_data, nullptr, color, 0 );
+        } break;
+
+        case CMD_GLYPHS: {
+            color_t c = cmd.glyphs.color;
+            float color[ 4 ] = { c.r, c.g, c.b, cmd.glyphs.alpha };
+            reserve_vertices( 6 );
+
+            for ( int g = 0; g < cmd.glyphs.glyph_count; g++ ) {
+                glyph_vertices(
+                    cmd,
+                    g,
+                    cam,
+                    intern.pos_data,
+                    intern.uv_data
+                );
+                push_triangles(
+                    6,
+                    intern.pos_data,
+                    intern.uv_data,
+                    color,
+                    0
+                );
+            }
+        } break;
+
+        case CMD_LINE_BULLETS: {
+            color_t c = cmd.line_bullets.color;
+            float color[ 4 ] = { c.r, c.g, c.b, 1.0f };
+            reserve_vertices( k_line_bullet_vertex_count );
+
+            for ( int b = 0; b < cmd.line_bullets.count; b++ ) {
+                line_bullet_vertices( cmd, b, intern.pos_data );
+                affine_apply(
+                    cam,
+                    intern.pos_data,
+                    intern.pos_data,
+                    k_line_bullet_vertex_count
+                );
+                push_triangles(
+                    k_line_bullet_vertex_count,
+                    intern.pos_data,
+                    nullptr,
+                    color,
+                    0
+                );
+            }
+        } break;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// binning
+////////////////////////////////////////////////////////////////////////////////
+
+/// clipped tile range of a triangle, false when it covers no pixel
+static int
+tile_range( const soft_tri_t & tri, int width, int height, int * out )
+{
+    int x0 = tri.x0 < 0 ? 0 : tri.x0;
+    int y0 = tri.y0 < 0 ? 0 : tri.y0;
+    int x1 = tri.x1 > width ? width : tri.x1;
+    int y1 = tri.y1 > height ? height : tri.y1;
+
+    if ( x0 >= x1 || y0 >= y1 ) return 0;
+
+    out[ 0 ] = x0 / k_tile_size;
+    out[ 1 ] = y0 / k_tile_size;
+    out[ 2 ] = ( x1 - 1 ) / k_tile_size + 1;
+    out[ 3 ] = ( y1 - 1 ) / k_tile_size + 1;
+    return 1;
+}
+
+/// counting sort of the triangles into tiles, keeping submission order
+/// within each tile
+static void bin_triangles( int first, int last, int width, int height )
+{
+    int tile_x_count = ( width + k_tile_size - 1 ) / k_tile_size;
+    int tile_y_count = ( height + k_tile_size - 1 ) / k_tile_size;
+    int tile_count = tile_x_count * tile_y_count;
+
+    if ( tile_count + 1 > intern.tile_cap ) {
+        delete[] intern.tile_start_list;
+        intern.tile_start_list = new int[ tile_count + 1 ];
+        intern.tile_cap = tile_count + 1;
+    }
+
+    intern.tile_x_count = tile_x_count;
+    intern.tile_y_count = tile_y_count;
+
+    int * start = intern.tile_start_list;
+    memset( start, 0, sizeof( int ) * ( tile_count + 1 ) );
+
+    int bin_count = 0;
+    for ( int i = first; i < last; i++ ) {
+        int r[ 4 ];
+        if ( !tile_range( intern.tri_list[ i ], width, height, r ) ) continue;
+
+        for ( int ty = r[ 1 ]; ty < r[ 3 ]; ty++ ) {
+            for ( int tx = r[ 0 ]; tx < r[ 2 ]; tx++ ) {
+                start[ ty * tile_x_count + tx + 1 ]++;
+                bin_count++;
+            }
+        }
+    }
+
+    for ( int t = 0; t < tile_count; t++ ) {
+        start[ t + 1 ] += start[ t ];
+    }
+
+    if ( bin_count > intern.bin_cap ) {
+        delete[] intern.bin_list;
+        intern.bin_cap = bin_count * 2;
+        intern.bin_list = new int[ intern.bin_cap ];
+    }
+
+    // start[ t ] is advanced while filling and ends up at the next tile's
+    // start, shifted back below
+    for ( int i = first; i < last; i++ ) {
+        int r[ 4 ];
+        if ( !tile_range( intern.tri_list[ i ], width, height, r ) ) continue;
+
+        for ( int ty = r[ 1 ]; ty < r[ 3 ]; ty++ ) {
+            for ( int tx = r[ 0 ]; tx < r[ 2 ]; tx++ ) {
+                intern.bin_list[ start[ ty * tile_x_count + tx ]++ ] = i;
+            }
+        }
+    }
+
+    for ( int t = tile_count; t > 0; t-- ) {
+        start[ t ] = start[ t - 1 ];
+    }
+    start[ 0 ] = 0;
+
+    intern.stats.binned_count += bin_count;
+    intern.stats.tile_count = tile_count;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// rasterization
+////////////////////////////////////////////////////////////////////////////////
+
+/// src alpha over, the target stays opaque
+static void blend_pixel( uint32_t * dst, const float * src )
+{
+#if SOFT_SSE
+    __m128i zero = _mm_setzero_si128();
+    __m128 one = _mm_set1_ps( 1.0f );
+    __m128 s = _mm_loadu_ps( src );
+    __m128 a = _mm_set1_ps( src[ 3 ] );
+
+    __m128i d8 = _mm_cvtsi32_si128( (int) *dst );
+    __m128i d32 = _mm_unpacklo_epi16( _mm_unpacklo_epi8( d8, zero ), zero );
+    __m128 d = _mm_mul_ps(
+        _mm_cvtepi32_ps( d32 ),
+        _mm_set1_ps( 1.0f / 255.0f )
+    );
+
+    __m128 o = _mm_add_ps(
+        _mm_mul_ps( s, a ),
+        _mm_mul_ps( d, _mm_sub_ps( one, a ) )
+    );
+    o = _mm_add_ps(
+        _mm_mul_ps( o, _mm_set1_ps( 255.0f ) ),
+        _mm_set1_ps( 0.5f )
+    );
+
+    __m128i o32 = _mm_cvttps_epi32( o );
+    __m128i o16 = _mm_packs_epi32( o32, o32 );
+    __m128i o8 = _mm_packus_epi16( o16, o16 );
+    *dst = (uint32_t) _mm_cvtsi128_si32( o8 ) | 0xff000000;
+#else
+    float a = src[ 3 ];
+    uint32_t out = 0xff000000;
+
+    for ( int c = 0; c < 3; c++ ) {
+        float d = ( ( *dst >> ( c * 8 ) ) & 0xff ) * ( 1.0f / 255.0f );
+        float o = src[ c ] * a + d * ( 1.0f - a );
+        int v = (int) ( o * 255.0f + 0.5f );
+        v = v < 0 ? 0 : ( v > 255 ? 255 : v );
+        out |= (uint32_t) v << ( c * 8 );
+    }
+
+    *dst = out;
+#endif
+}
+
+static void
+shade_pixel( uint32_t * dst, const soft_tri_t & tri, float u, float v )
+{
+    if ( tri.opaque ) {
+        *dst = tri.opaque;
+        return;
+    }
+
+    if ( !tri.textured ) {
+        blend_pixel( dst, tri.color );
+        return;
+    }
+
+    // nearest, clamped to the edge
+    int tx = (int) floorf( u * intern.atlas_w );
+    int ty = (int) floorf( v * intern.atlas_h );
+    tx = tx < 0 ? 0 : ( tx >= intern.atlas_w ? intern.atlas_w - 1 : tx );
+    ty = ty < 0 ? 0 : ( ty >= intern.atlas_h ? intern.atlas_h - 1 : ty );
+
+    const unsigned char * texel =
+        intern.atlas + ( ty * intern.atlas_w + tx ) * 4;
+    if ( texel[ 3 ] == 0 ) return;
+
+    float color[ 4 ];
+    for ( int c = 0; c < 4; c++ ) {
+        color[ c ] = tri.color[ c ] * ( texel[ c ] * ( 1.0f / 255.0f ) );
+    }
+
+    blend_pixel( dst, color );
+}
+
+/// fills the part of tri inside [x0, x1) x [y0, y1)
+static void raster_triangle(
+    const soft_tri_t & tri,
+    soft_target_t * target,
+    int x0,
+    int y0,
+    int x1,
+    int y1
+)
+{
+    if ( tri.x0 > x0 ) x0 = tri.x0;
+    if ( tri.y0 > y0 ) y0 = tri.y0;
+    if ( tri.x1 < x1 ) x1 = tri.x1;
+    if ( tri.y1 < y1 ) y1 = tri.y1;
+    if ( x0 >= x1 || y0 >= y1 ) return;
+
+    // edge k is opposite vertex k, positive inside
+    float a[ 3 ];
+    float b[ 3 ];
+    float c[ 3 ];
+    int top_left[ 3 ];
+
+    for ( int k = 0; k < 3; k++ ) {
+        float ax = tri.x[ ( k + 1 ) % 3 ];
+        float ay = tri.y[ ( k + 1 ) % 3 ];
+        float bx = tri.x[ ( k + 2 ) % 3 ];
+        float by = tri.y[ ( k + 2 ) % 3 ];
+        a[ k ] = ay - by;
+        b[ k ] = bx - ax;
+        c[ k ] = ax * by - bx * ay;
+
+        // pixels exactly on a shared edge belong to one triangle only
+        top_left[ k ] = a[ k ] > 0.0f || ( a[ k ] == 0.0f && b[ k ] > 0.0f );
+    }
+
+    float area = a[ 0 ] * tri.x[ 0 ] + b[ 0 ] * tri.y[ 0 ] + c[ 0 ];
+    float inv_area = 1.0f / area;
+
+#if SOFT_SSE
+    __m128 zero = _mm_setzero_ps();
+    __m128 lane = _mm_set_ps( 3.5f, 2.5f, 1.5f, 0.5f );
+    __m128 edge_a[ 3 ];
+    __m128 edge_b[ 3 ];
+    __m128 edge_c[ 3 ];
+    __m128 edge_tl[ 3 ];
+    for ( int k = 0; k < 3; k++ ) {
+        edge_a[ k ] = _mm_set1_ps( a[ k ] );
+        edge_b[ k ] = _mm_set1_ps( b[ k ] );
+        edge_c[ k ] = _mm_set1_ps( c[ k ] );
+        edge_tl[ k ] =
+            _mm_castsi128_ps( _mm_set1_epi32( top_left[ k ] ? -1 : 0 ) );
+    }
+#endif
+
+    for ( int y = y0; y < y1; y++ ) {
+        uint32_t * row = target->pixels + y * target->width;
+        float py = y + 0.5f;
+
+#if SOFT_SSE
+        __m128 py4 = _mm_set1_ps( py );
+
+        for ( int x = x0; x < x1; x += 4 ) {
+            __m128 px4 = _mm_add_ps( _mm_set1_ps( (float) x ), lane );
+            __m128 mask = _mm_castsi128_ps( _mm_set1_epi32( -1 ) );
+            __m128 e[ 3 ];
+
+            for ( int k = 0; k < 3; k++ ) {
+                e[ k ] = _mm_add_ps(
+                    _mm_add_ps(
+                        _mm_mul_ps( edge_a[ k ], px4 ),
+                        _mm_mul_ps( edge_b[ k ], py4 )
+                    ),
+                    edge_c[ k ]
+                );
+                __m128 inside = _mm_or_ps(
+                    _mm_cmpgt_ps( e[ k ], zero ),
+                    _mm_and_ps( _mm_cmpeq_ps( e[ k ], zero ), edge_tl[ k ] )
+                );
+                mask = _mm_and_ps( mask, inside );
+            }
+
+            int bits = _mm_movemask_ps( mask );
+            if ( x1 - x < 4 ) bits &= ( 1 << ( x1 - x ) ) - 1;
+            if ( !bits ) continue;
+
+            if ( tri.opaque && bits == 0xf ) {
+                _mm_storeu_si128(
+                    (__m128i *) ( row + x ),
+                    _mm_set1_epi32( (int) tri.opaque )
+                );
+                continue;
+            }
+
+            float u[ 4 ] = {};
+            float v[ 4 ] = {};
+            if ( tri.textured ) {
+                __m128 inv = _mm_set1_ps( inv_area );
+                __m128 l0 = _mm_mul_ps( e[ 0 ], inv );
+                __m128 l1 = _mm_mul_ps( e[ 1 ], inv );
+                __m128 l2 = _mm_mul_ps( e[ 2 ], inv );
+                __m128 u4 = _mm_add_ps(
+                    _mm_add_ps(
+                        _mm_mul_ps( l0, _mm_set1_ps( tri.u[ 0 ] ) ),
+                        _mm_mul_ps( l1, _mm_set1_ps( tri.u[ 1 ] ) )
+                    ),
+                    _mm_mul_ps( l2, _mm_set1_ps( tri.u[ 2 ] ) )
+                );
+                __m128 v4 = _mm_add_ps(
+                    _mm_add_ps(
+                        _mm_mul_ps( l0, _mm_set1_ps( tri.v[ 0 ] ) ),
+                        _mm_mul_ps( l1, _mm_set1_ps( tri.v[ 1 ] ) )
+                    ),
+                    _mm_mul_ps( l2, _mm_set1_ps( tri.v[ 2 ] ) )
+                );
+                _mm_storeu_ps( u, u4 );
+                _mm_storeu_ps( v, v4 );
+            }
+
+            for ( int i = 0; i < 4; i++ ) {
+                if ( bits & ( 1 << i ) ) {
+                    shade_pixel( row + x + i, tri, u[ i ], v[ i ] );
+                }
+            }
+        }
+#else
+        for ( int x = x0; x < x1; x++ ) {
+            float px = (float) x + 0.5f;
+            float e[ 3 ];
+            int inside = 1;
+
+            for ( int k = 0; k < 3; k++ ) {
+                e[ k ] = ( a[ k ] * px + b[ k ] * py ) + c[ k ];
+                inside &= e[ k ] > 0.0f || ( e[ k ] == 0.0f && top_left[ k ] );
+            }
+
+            if ( !inside ) continue;
+
+            float u = 0.0f;
+            float v = 0.0f;
+            if ( tri.textured ) {
+                float l0 = e[ 0 ] * inv_area;
+                float l1 = e[ 1 ] * inv_area;
+                float l2 = e[ 2 ] * inv_area;
+                u = ( l0 * tri.u[ 0 ] + l1 * tri.u[ 1 ] ) + l2 * tri.u[ 2 ];
+                v = ( l0 * tri.v[ 0 ] + l1 * tri.v[ 1 ] ) + l2 * tri.v[ 2 ];
+            }
+
+            shade_pixel( row + x, tri, u, v );
+        }
+#endif
+    }
+}
+
+static void raster_tile( int tile, soft_target_t * target )
+{
+    int tx = tile % intern.tile_x_count;
+    int ty = tile / intern.tile_x_count;
+
+    int x0 = tx * k_tile_size;
+    int y0 = ty * k_tile_size;
+    int x1 = x0 + k_tile_size;
+    int y1 = y0 + k_tile_size;
+    if ( x1 > target->width ) x1 = target->width;
+    if ( y1 > target->height ) y1 = target->height;
+
+    int first = intern.tile_start_list[ tile ];
+    int last = intern.tile_start_list[ tile + 1 ];
+
+    for ( int i = first; i < last; i++ ) {
+        const soft_tri_t & tri = intern.tri_list[ intern.bin_list[ i ] ];
+        raster_triangle( tri, target, x0, y0, x1, y1 );
+    }
+}
+
+static void raster_pass( int first, int last, soft_target_t * target )
+{
+    bin_triangles( first, last, target->width, target->height );
+
+    int tile_count = intern.tile_x_count * intern.tile_y_count;
+
+    if ( intern.pool.worker_count == 0 ) {
+        for ( int t = 0; t < tile_count; t++ ) {
+            raster_tile( t, target );
+        }
+        return;
+    }
+
+    // tiles never share pixels, so workers only have to agree on who takes
+    // which tile
+    {
+        std::lock_guard< std::mutex > lock( intern.pool.mutex );
+        intern.pool.target = target;
+        intern.pool.tile_count = tile_count;
+        intern.pool.next_tile = 0;
+        intern.pool.busy_count = intern.pool.worker_count;
+        intern.pool.pass_index++;
+    }
+    intern.pool.start_cond.notify_all();
+
+    raster_tiles();
+
+    std::unique_lock< std::mutex > lock( intern.pool.mutex );
+    intern.pool.done_cond.wait( lock, [] {
+        return intern.pool.busy_count == 0;
+    } );
+}
+
+/// the chromatic split shader2 applies when compositing the world, red and
+/// blue sampled 0.003 of the target apart in opposite directions
+static void apply_world_effect( soft_target_t * target, float amount )
+{
+    int dx = (int) roundf( 0.003f * amount * target->width );
+    int dy = (int) roundf( 0.003f * amount * target->height );
+    if ( dx == 0 && dy == 0 ) return;
+
+    int size = target->width * target->height;
+    if ( size > intern.scratch_size ) {
+        delete[] intern.scratch;
+        intern.scratch = new uint32_t[ size ];
+        intern.scratch_size = size;
+    }
+    memcpy( intern.scratch, target->pixels, sizeof( uint32_t ) * size );
+
+    int w = target->width;
+    int h = target->height;
+
+    for ( int y = 0; y < h; y++ ) {
+        // texture rows run bottom up, screen rows top down
+        int ry = y - dy < 0 ? 0 : ( y - dy >= h ? h - 1 : y - dy );
+        int by = y + dy < 0 ? 0 : ( y + dy >= h ? h - 1 : y + dy );
+
+        for ( int x = 0; x < w; x++ ) {
+            int rx = x + dx < 0 ? 0 : ( x + dx >= w ? w - 1 : x + dx );
+            int bx = x - dx < 0 ? 0 : ( x - dx >= w ? w - 1 : x - dx );
+
+            uint32_t r = intern.scratch[ ry * w + rx ] & 0x0000ff;
+            uint32_t g = intern.scratch[ y * w + x ] & 0x00ff00;
+            uint32_t b = intern.scratch[ by * w + bx ] & 0xff0000;
+            target->pixels[ y * w + x ] = 0xff000000 | r | g | b;
+        }
+    }
+}
+
+void soft_render_submit( render_cmd_buffer_t * buffer, soft_target_t * target )
+{
+    memset( &intern.stats, 0, sizeof( intern.stats ) );
+    intern.tri_count = 0;
+
+    for ( int i = 0; i < target->width * target->height; i++ ) {
+        target->pixels[ i ] = 0xff000000;
+    }
+
+    buffer->sort();
+
+    int i = 0;
+    while ( i < buffer->cmd_count ) {
+        int layer = buffer->sorted_layer( i );
+
+        int end = i + 1;
+        while ( end < buffer->cmd_count &&
+                buffer->sorted_layer( end ) == layer ) {
+            end++;
+        }
+
+        int first_tri = intern.tri_count;
+        expand_commands( buffer, i, end, target );
+        raster_pass( first_tri, intern.tri_count, target );
+
+        if ( layer == LAYER_WORLD ) {
+            apply_world_effect( target, buffer->effect_amount );
+        }
+
+        i = end;
+    }
+
+    intern.stats.triangle_count = intern.tri_count;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "render_cmd.hpp"
+
+#include <stdint.h>
+
+/// rgba8 image in memory, rows top to bottom
+struct soft_target_t {
+    uint32_t * pixels;
+    int width;
+    int height;
+
+    void init( int new_width, int new_height );
+    void destroy();
+};
+
+struct soft_stats_t {
+    int triangle_count; // after expanding every command
+    int binned_count;   // triangle and tile pairs
+    int tile_count;
+};
+
+/// copies the atlas for text. thread_count > 1 starts thread_count - 1
+/// workers that rasterize tiles alongside the submitting thread until
+/// soft_render_destroy()
+int soft_render_init( int thread_count );
+
+/// stops the workers and frees everything init and submit allocated
+void soft_render_destroy();
+
+/// draws the frame in buffer into target, the cpu counterpart of submitting
+/// it to gl. the world layer is drawn at full resolution whatever its scale
+void soft_render_submit( render_cmd_buffer_t * buffer, soft_target_t * target );
+
+const soft_stats_t & soft_render_stats();
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "grid.hpp"
 #include "shape.hpp"
 
 #include <cglm/types.h>
@@ -27,11 +28,14 @@ struct state_t {
 
     rect_t * room_rect_list;
     int room_count;
+    int level_version; // bumped whenever the rooms or the exit change
 
     vec2 * bullet_old_pos_list;
     vec2 * bullet_pos_list;
     int bullet_count;
 
+    grid_t bullet_grid; // rebuilt every tick
+
     vec2 * line_bullet_pos1_list;
     vec2 * line_bullet_pos2_list;
     vec2 * line_bullet_vel_list;
@@ -1,107 +1,148 @@
-#include "logging.hpp"
+#include "wav.hpp"
 
-#include <AL/al.h>
+#include "logging.hpp"
 
 #include <stdint.h>
 #include <string.h>
 
-struct wav_header_t {
-    uint8_t chunk_id[ 4 ];
-    uint8_t chunk_size[ 4 ];
-    uint8_t format[ 4 ];
-    uint8_t subchunk1_id[ 4 ];
-    uint8_t subchunk1_size[ 4 ];
-    uint8_t audio_format[ 2 ];
-    uint8_t num_channels[ 2 ];
-    uint8_t sample_rate[ 4 ];
-    uint8_t byte_rate[ 4 ];
-    uint8_t block_align[ 2 ];
-    uint8_t bits_per_sample[ 2 ];
-    uint8_t subchunk2_id[ 4 ];
-    uint8_t subchunk2_size[ 4 ];
-};
-
-static int to_int( uint8_t ( &d )[ 4 ] )
+// riff layout: "RIFF", size, "WAVE", then chunks of a four character id, a
+// little endian size and the data, padded to an even length. only "fmt "
+// and "data" matter here, anything else (LIST, fact, cue ...) is skipped
+
+#define WAV_FORMAT_PCM        1
+#define WAV_FORMAT_EXTENSIBLE 0xfffe
+
+static int read_u16( const unsigned char * d )
 {
-    int x;
-    memcpy( &x, d, 4 );
-    return x;
+    return d[ 0 ] | ( d[ 1 ] << 8 );
 }
 
-static short to_short( uint8_t ( &d )[ 2 ] )
+static uint32_t read_u32( const unsigned char * d )
 {
-    short x;
-    memcpy( &x, d, 2 );
-    return x;
+    return d[ 0 ] | ( d[ 1 ] << 8 ) | ( d[ 2 ] << 16 ) |
+           ( (uint32_t) d[ 3 ] << 24 );
 }
 
-static const char * to_string( uint8_t ( &d )[ 4 ] )
+static int is_id( const unsigned char * d, const char * id )
 {
-    static char buffer[ 5 ];
-    buffer[ 4 ] = '\0';
-    memcpy( buffer, d, 4 );
-    return buffer;
+    return memcmp( d, id, 4 ) == 0;
 }
 
-static void print_header( wav_header_t header )
+static void print_wav( const wav_t & wav )
 {
     INFO_LOG( "audio description" );
-    INFO_LOG( "  chunk id:        %s", to_string( header.chunk_id ) );
-    INFO_LOG( "  chunk size:      %d", to_int( header.chunk_size ) );
-    INFO_LOG( "  format:          %s", to_string( header.format ) );
-    INFO_LOG( "  subchunk 1 id:   %s", to_string( header.subchunk1_id ) );
-    INFO_LOG( "  subchunk 1 size: %d", to_int( header.subchunk1_size ) );
-    INFO_LOG( "  audio format:    %d", to_short( header.audio_format ) );
-    INFO_LOG( "  num channels:    %d", to_short( header.num_channels ) );
-    INFO_LOG( "  sample rate:     %d", to_int( header.sample_rate ) );
-    INFO_LOG( "  byte rate:       %d", to_int( header.byte_rate ) );
-    INFO_LOG( "  block align:     %d", to_short( header.block_align ) );
-    INFO_LOG( "  bits per sample: %d", to_short( header.bits_per_sample ) );
-    INFO_LOG( "  subchunk 2 id:   %s", to_string( header.subchunk2_id ) );
-    INFO_LOG( "  subchunk 2 size: %d", to_int( header.subchunk2_size ) );
+    INFO_LOG( "  num channels:    %d", wav.channels );
+    INFO_LOG( "  sample rate:     %d", wav.sample_rate );
+    INFO_LOG( "  bits per sample: %d", wav.bits_per_sample );
+    INFO_LOG( "  size:            %d", wav.size );
 }
 
-int load_wav( unsigned char * data, int data_len )
+/// the "fmt " chunk, 1 when it is not something we can play
+static int parse_format( const unsigned char * d, uint32_t size, wav_t * out )
 {
-    wav_header_t header;
-    memcpy( &header, data, sizeof( wav_header_t ) );
-
-    // print_header( header );
-
-    int waveform_size = to_int( header.subchunk2_size );
-    uint8_t * waveform_data = new uint8_t[ waveform_size ];
+    if ( size < 16 ) {
+        ERROR_LOG( "failed to parse wav, %d byte format chunk", (int) size );
+        return 1;
+    }
 
-    memcpy( waveform_data, data + sizeof( wav_header_t ), waveform_size );
+    int format = read_u16( d );
+    int channels = read_u16( d + 2 );
+    uint32_t sample_rate = read_u32( d + 4 );
+    int block_align = read_u16( d + 12 );
+    int bits_per_sample = read_u16( d + 14 );
 
-    bool stereo = ( to_short( header.num_channels ) > 1 );
-    short bits_per_sample = to_short( header.bits_per_sample );
+    // extensible headers name the real format in the first two bytes of
+    // the sub format guid
+    if ( format == WAV_FORMAT_EXTENSIBLE && size >= 40 ) {
+        format = read_u16( d + 24 );
+    }
 
-    ALenum format;
+    if ( format != WAV_FORMAT_PCM ) {
+        ERROR_LOG( "failed to parse wav, format %d is not pcm", format );
+        return 1;
+    }
 
-    if ( stereo && bits_per_sample == 8 ) {
-        format = AL_FORMAT_STEREO8;
+    if ( ( channels != 1 && channels != 2 ) ||
+         ( bits_per_sample != 8 && bits_per_sample != 16 ) ) {
+        ERROR_LOG(
+            "failed to parse wav, %d channel %d bit samples",
+            channels,
+            bits_per_sample
+        );
+        return 1;
     }
-    if ( stereo && bits_per_sample == 16 ) {
-        format = AL_FORMAT_STEREO16;
+
+    if ( sample_rate == 0 || sample_rate > 384000 ||
+         block_align != channels * bits_per_sample / 8 ) {
+        ERROR_LOG(
+            "failed to parse wav, %u hz with %d byte frames",
+            sample_rate,
+            block_align
+        );
+        return 1;
     }
-    if ( !stereo && bits_per_sample == 8 ) {
-        format = AL_FORMAT_MONO8;
+
+    out->channels = channels;
+    out->bits_per_sample = bits_per_sample;
+    out->sample_rate = (int) sample_rate;
+
+    return 0;
+}
+
+int parse_wav( const unsigned char * data, int data_len, wav_t * out )
+{
+    if ( !data || data_len < 12 || !is_id( data, "RIFF" ) ||
+         !is_id( data + 8, "WAVE" ) ) {
+        ERROR_LOG( "failed to parse wav, not a riff wave file" );
+        return 1;
     }
-    if ( !stereo && bits_per_sample == 16 ) {
-        format = AL_FORMAT_MONO16;
+
+    // the riff size is often wrong in files written by streaming tools,
+    // the chunks are walked against the real length instead
+    wav_t wav = {};
+    int has_format = 0;
+    int at = 12;
+
+    while ( data_len - at >= 8 ) {
+        const unsigned char * chunk = data + at;
+        const unsigned char * body = chunk + 8;
+        uint32_t size = read_u32( chunk + 4 );
+        uint32_t left = (uint32_t) ( data_len - at - 8 );
+
+        if ( is_id( chunk, "fmt " ) ) {
+            if ( size > left || parse_format( body, size, &wav ) ) return 1;
+            has_format = 1;
+        } else if ( is_id( chunk, "data" ) ) {
+            if ( !has_format ) {
+                ERROR_LOG( "failed to parse wav, data before format" );
+                return 1;
+            }
+
+            // a truncated last chunk still plays what is there
+            if ( size > left ) size = left;
+
+            int frame_size = wav.channels * wav.bits_per_sample / 8;
+            wav.samples = body;
+            wav.size = (int) ( size - size % frame_size );
+            break;
+        }
+
+        if ( size > left ) break;
+        at += 8 + (int) size + (int) ( size & 1 );
     }
 
-    unsigned int buffer;
+    if ( !has_format ) {
+        ERROR_LOG( "failed to parse wav, no format chunk" );
+        return 1;
+    }
 
-    alGenBuffers( 1, &buffer );
+    if ( !wav.samples ) {
+        ERROR_LOG( "failed to parse wav, no data chunk" );
+        return 1;
+    }
 
-    alBufferData(
-        buffer,
-        format,
-        waveform_data,
-        waveform_size,
-        to_int( header.sample_rate )
-    );
+    // print_wav( wav );
 
-    return (int) buffer;
+    *out = wav;
+    return 0;
 }
@@ -1,3 +1,15 @@
 #pragma once
 
-int load_wav( unsigned char * data, int data_len );
+/// pcm samples of a wav resource, pointing into the resource
+struct wav_t {
+    const unsigned char * samples;
+    int size; // bytes
+    int channels;
+    int bits_per_sample;
+    int sample_rate;
+};
+
+/// walks the riff chunks and checks the format is 8 or 16 bit pcm, mono or
+/// stereo. samples point into data, no copy and no audio calls so it can
+/// run on any thread
+int parse_wav( const unsigned char * data, int data_len, wav_t * out );
@@ -1,34 +1,532 @@
 #include <assert.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
-int write_file( const char * filename, int index )
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+#define ATLAS_IMAGE_CAP 64
+#define ATLAS_PADDING   1
+#define ATLAS_NAME      "atlas.tex"
+
+// binary fonts, the layout matches font_header_t in src/font.hpp
+#define FONT_STR_LEN     64
+#define FONT_CHAR_COUNT  128
+#define FONT_KERNING_CAP 4096
+#define FONT_MAGIC       0x544e4642 // "BFNT"
+#define FONT_VERSION     1
+
+// pre-decoded textures, the layout matches tex_header_t in src/loader.hpp
+#define TEX_MAGIC    0x58455442 // "BTEX"
+#define TEX_VERSION  1
+#define TEX_RGBA8    0
+#define TEX_RGBA4444 1
+
+// resources start on this boundary so the runtime can use them in place
+#define RES_ALIGN 16
+
+// external pack, the layout matches src/pack.hpp
+#define PACK_MAGIC    0x4b415042 // "BPAK"
+#define PACK_VERSION  1
+#define PACK_NAME_LEN 44
+#define PACK_LZ4      1
+
+typedef struct {
+    const char * path;
+    unsigned char * pixels; // rgba
+    int width;
+    int height;
+
+    // the part of the image that is not fully transparent
+    int trim_x;
+    int trim_y;
+    int trim_w;
+    int trim_h;
+
+    // placement of the trimmed part in the atlas
+    int x;
+    int y;
+} atlas_image_t;
+
+typedef struct {
+    int x;
+    int y;
+    int width;
+    int height;
+    int x_offset;
+    int y_offset;
+    int x_advance;
+} font_char_t;
+
+typedef struct {
+    int first;
+    int second;
+    int amount;
+} font_kerning_t;
+
+typedef struct {
+    int magic;
+    int version;
+
+    char face[ FONT_STR_LEN ];
+    char file[ FONT_STR_LEN ];
+
+    int size;
+    int line_height;
+    int base;
+    int scale_w;
+    int scale_h;
+    int char_count;
+    int kerning_count;
+} font_header_t;
+
+typedef struct {
+    unsigned int magic;
+    unsigned int version;
+    int width;
+    int height;
+    int format;
+    unsigned int reserved[ 3 ];
+} tex_header_t;
+
+typedef struct {
+    unsigned int magic;
+    unsigned int version;
+    unsigned int entry_count;
+    unsigned int atlas_count;
+    int atlas_w;
+    int atlas_h;
+    unsigned int reserved[ 2 ];
+} pack_header_t;
+
+typedef struct {
+    unsigned int hash;
+    unsigned int flags;
+    unsigned int offset;
+    unsigned int size;
+    unsigned int raw_size;
+    char name[ PACK_NAME_LEN ];
+} pack_entry_t;
+
+typedef struct {
+    unsigned int hash;
+    int x;
+    int y;
+    int w;
+    int h;
+    int trim_x;
+    int trim_y;
+    char name[ PACK_NAME_LEN - 8 ];
+} pack_atlas_t;
+
+void write_byte( unsigned char c, int n )
+{
+    if ( n % 10 == 0 ) printf( "\n    " );
+
+    printf( "0x%.2X", (int) c );
+    printf( ", " );
+}
+
+int write_bytes( const unsigned char * data, int len )
+{
+    for ( int i = 0; i < len; i++ ) {
+        write_byte( data[ i ], i );
+    }
+
+    return len;
+}
+
+int is_image( const char * path )
+{
+    int len = strlen( path );
+    return len > 4 && strcmp( path + len - 4, ".png" ) == 0;
+}
+
+int is_font( const char * path )
+{
+    int len = strlen( path );
+    return len > 4 && strcmp( path + len - 4, ".fnt" ) == 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// atlas packing
+////////////////////////////////////////////////////////////////////////////////
+
+int next_pow2( int x )
+{
+    int p = 1;
+    while ( p < x ) {
+        p *= 2;
+    }
+    return p;
+}
+
+void load_atlas_image( atlas_image_t * image, const char * path )
+{
+    int channels;
+
+    image->path = path;
+    image->pixels =
+        stbi_load( path, &image->width, &image->height, &channels, 4 );
+
+    if ( !image->pixels ) {
+        fprintf( stderr, "failed to load image: %s\n", path );
+        exit( 1 );
+    }
+
+    // bounding box of every pixel with some alpha
+    int x1 = image->width;
+    int y1 = image->height;
+    int x2 = 0;
+    int y2 = 0;
+
+    for ( int y = 0; y < image->height; y++ ) {
+        for ( int x = 0; x < image->width; x++ ) {
+            if ( image->pixels[ ( y * image->width + x ) * 4 + 3 ] == 0 ) {
+                continue;
+            }
+            if ( x < x1 ) x1 = x;
+            if ( y < y1 ) y1 = y;
+            if ( x + 1 > x2 ) x2 = x + 1;
+            if ( y + 1 > y2 ) y2 = y + 1;
+        }
+    }
+
+    if ( x2 <= x1 || y2 <= y1 ) {
+        x1 = 0;
+        y1 = 0;
+        x2 = 0;
+        y2 = 0;
+    }
+
+    image->trim_x = x1;
+    image->trim_y = y1;
+    image->trim_w = x2 - x1;
+    image->trim_h = y2 - y1;
+}
+
+/// shelf packing, tallest images first. returns the atlas size
+void pack_atlas(
+    atlas_image_t * image_list,
+    int image_count,
+    int * out_width,
+    int * out_height
+)
+{
+    int order[ ATLAS_IMAGE_CAP ];
+    int width = 64;
+
+    for ( int i = 0; i < image_count; i++ ) {
+        order[ i ] = i;
+        width = next_pow2( image_list[ i ].trim_w ) > width
+                    ? next_pow2( image_list[ i ].trim_w )
+                    : width;
+    }
+
+    // insertion sort by height
+    for ( int i = 1; i < image_count; i++ ) {
+        int j = i;
+        while ( j > 0 && image_list[ order[ j - 1 ] ].trim_h <
+                             image_list[ order[ j ] ].trim_h ) {
+            int t = order[ j - 1 ];
+            order[ j - 1 ] = order[ j ];
+            order[ j ] = t;
+            j--;
+        }
+    }
+
+    int cursor_x = 0;
+    int cursor_y = 0;
+    int shelf_h = 0;
+
+    for ( int i = 0; i < image_count; i++ ) {
+        atlas_image_t * image = image_list + order[ i ];
+
+        if ( image->trim_w == 0 ) {
+            image->x = 0;
+            image->y = 0;
+            continue;
+        }
+
+        if ( cursor_x + image->trim_w > width ) {
+            cursor_x = 0;
+            cursor_y += shelf_h + ATLAS_PADDING;
+            shelf_h = 0;
+        }
+
+        image->x = cursor_x;
+        image->y = cursor_y;
+
+        cursor_x += image->trim_w + ATLAS_PADDING;
+        if ( image->trim_h > shelf_h ) shelf_h = image->trim_h;
+    }
+
+    *out_width = width;
+    *out_height = next_pow2( cursor_y + shelf_h );
+}
+
+unsigned char * compose_atlas(
+    const atlas_image_t * image_list,
+    int image_count,
+    int width,
+    int height
+)
+{
+    unsigned char * pixels = calloc( width * height, 4 );
+
+    for ( int i = 0; i < image_count; i++ ) {
+        const atlas_image_t * image = image_list + i;
+
+        for ( int y = 0; y < image->trim_h; y++ ) {
+            memcpy(
+                pixels + ( ( image->y + y ) * width + image->x ) * 4,
+                image->pixels +
+                    ( ( image->trim_y + y ) * image->width + image->trim_x ) *
+                        4,
+                image->trim_w * 4
+            );
+        }
+    }
+
+    return pixels;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// byte buffers
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+    unsigned char * data;
+    int size;
+    int cap;
+} byte_buffer_t;
+
+void push_byte( byte_buffer_t * buffer, unsigned char c )
+{
+    if ( buffer->size >= buffer->cap ) {
+        buffer->cap = buffer->cap ? buffer->cap * 2 : 4096;
+        buffer->data = realloc( buffer->data, buffer->cap );
+    }
+    buffer->data[ buffer->size ] = c;
+    buffer->size++;
+}
+
+void push_bytes( byte_buffer_t * buffer, const void * data, int len )
+{
+    if ( buffer->size + len > buffer->cap ) {
+        while ( buffer->size + len > buffer->cap ) {
+            buffer->cap = buffer->cap ? buffer->cap * 2 : 4096;
+        }
+        buffer->data = realloc( buffer->data, buffer->cap );
+    }
+
+    memcpy( buffer->data + buffer->size, data, len );
+    buffer->size += len;
+}
+
+/// zeros up to the next resource boundary
+void push_padding( byte_buffer_t * buffer )
+{
+    while ( buffer->size % RES_ALIGN != 0 ) {
+        push_byte( buffer, 0 );
+    }
+}
+
+void push_file( byte_buffer_t * buffer, const char * path )
+{
+    FILE * file = fopen( path, "rb" );
+
+    if ( !file ) {
+        fprintf( stderr, "failed to open: %s\n", path );
+        exit( 1 );
+    }
+
+    unsigned char chunk[ 65536 ];
+    size_t len;
+    while ( ( len = fread( chunk, 1, sizeof( chunk ), file ) ) > 0 ) {
+        push_bytes( buffer, chunk, (int) len );
+    }
+
+    fclose( file );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// font conversion, angelcode text .fnt to the binary layout
+////////////////////////////////////////////////////////////////////////////////
+
+/// start of the value of key=value in a line, NULL when the key is missing.
+/// fields can come in any order
+const char * find_field( const char * line, const char * key )
+{
+    int len = strlen( key );
+
+    for ( const char * p = strchr( line, ' ' ); p; p = strchr( p + 1, ' ' ) ) {
+        if ( strncmp( p + 1, key, len ) == 0 && p[ len + 1 ] == '=' ) {
+            return p + len + 2;
+        }
+    }
+
+    return NULL;
+}
+
+int read_int_field(
+    const char * path,
+    int line_number,
+    const char * line,
+    const char * key
+)
 {
+    const char * value = find_field( line, key );
+
+    if ( !value ) {
+        fprintf(
+            stderr,
+            "%s:%d: missing field: %s\n",
+            path,
+            line_number,
+            key
+        );
+        exit( 1 );
+    }
+
+    return (int) strtol( value, NULL, 10 );
+}
+
+void read_string_field(
+    char * out,
+    const char * path,
+    int line_number,
+    const char * line,
+    const char * key
+)
+{
+    const char * value = find_field( line, key );
+
+    if ( !value || value[ 0 ] != '"' ) {
+        fprintf(
+            stderr,
+            "%s:%d: missing field: %s\n",
+            path,
+            line_number,
+            key
+        );
+        exit( 1 );
+    }
+
     int i = 0;
-    FILE * file = fopen( filename, "rb" );
+    for ( value++; *value && *value != '"'; value++ ) {
+        if ( i < FONT_STR_LEN - 1 ) out[ i++ ] = *value;
+    }
+    out[ i ] = '\0';
+}
+
+/// the first word of a line names its block
+int is_tag( const char * line, const char * tag )
+{
+    int len = strlen( tag );
+    return strncmp( line, tag, len ) == 0 &&
+           ( line[ len ] == ' ' || line[ len ] == '\t' );
+}
+
+int compare_kerning( const void * a, const void * b )
+{
+    const font_kerning_t * ka = a;
+    const font_kerning_t * kb = b;
+    if ( ka->first != kb->first ) return ka->first - kb->first;
+    return ka->second - kb->second;
+}
+
+/// header, every char slot and the kerning pairs sorted by first then second
+byte_buffer_t convert_font( const char * path )
+{
+    static font_char_t char_list[ FONT_CHAR_COUNT ];
+    static font_kerning_t kerning_list[ FONT_KERNING_CAP ];
+
+    font_header_t header;
+    memset( &header, 0, sizeof( header ) );
+    memset( char_list, 0, sizeof( char_list ) );
+
+    header.magic = FONT_MAGIC;
+    header.version = FONT_VERSION;
+
+    FILE * file = fopen( path, "r" );
 
     if ( !file ) {
-        fprintf( stderr, "failed to open: %s\n", filename );
+        fprintf( stderr, "failed to open: %s\n", path );
         exit( 1 );
     }
 
-    int n = 0;
-    while ( !feof( file ) ) {
-        unsigned char c;
-        if ( fread( &c, 1, 1, file ) == 0 ) break;
+    char line[ 1024 ];
+    int line_number = 0;
+
+    while ( fgets( line, sizeof( line ), file ) ) {
+        line_number++;
 
-        if ( n % 10 == 0 ) printf( "\n    " );
-        n++;
+        if ( is_tag( line, "info" ) ) {
+            read_string_field( header.face, path, line_number, line, "face" );
+            header.size = read_int_field( path, line_number, line, "size" );
+        } else if ( is_tag( line, "common" ) ) {
+            header.line_height =
+                read_int_field( path, line_number, line, "lineHeight" );
+            header.base = read_int_field( path, line_number, line, "base" );
+            header.scale_w =
+                read_int_field( path, line_number, line, "scaleW" );
+            header.scale_h =
+                read_int_field( path, line_number, line, "scaleH" );
+        } else if ( is_tag( line, "page" ) ) {
+            read_string_field( header.file, path, line_number, line, "file" );
+        } else if ( is_tag( line, "char" ) ) {
+            int id = read_int_field( path, line_number, line, "id" );
+            if ( id < 0 || id >= FONT_CHAR_COUNT ) continue;
 
-        printf( "0x%.2X", (int) c );
-        printf( ", " );
-        i++;
+            font_char_t * c = char_list + id;
+            c->x = read_int_field( path, line_number, line, "x" );
+            c->y = read_int_field( path, line_number, line, "y" );
+            c->width = read_int_field( path, line_number, line, "width" );
+            c->height = read_int_field( path, line_number, line, "height" );
+            c->x_offset =
+                read_int_field( path, line_number, line, "xoffset" );
+            c->y_offset =
+                read_int_field( path, line_number, line, "yoffset" );
+            c->x_advance =
+                read_int_field( path, line_number, line, "xadvance" );
+            header.char_count++;
+        } else if ( is_tag( line, "kerning" ) ) {
+            int first = read_int_field( path, line_number, line, "first" );
+            int second = read_int_field( path, line_number, line, "second" );
+            if ( first < 0 || first >= FONT_CHAR_COUNT ) continue;
+            if ( second < 0 || second >= FONT_CHAR_COUNT ) continue;
+
+            assert( header.kerning_count < FONT_KERNING_CAP );
+            font_kerning_t * k = kerning_list + header.kerning_count;
+            k->first = first;
+            k->second = second;
+            k->amount = read_int_field( path, line_number, line, "amount" );
+            header.kerning_count++;
+        }
     }
 
     fclose( file );
 
-    return i;
+    qsort(
+        kerning_list,
+        header.kerning_count,
+        sizeof( font_kerning_t ),
+        compare_kerning
+    );
+
+    byte_buffer_t buffer = { 0 };
+    push_bytes( &buffer, &header, sizeof( header ) );
+    push_bytes( &buffer, char_list, sizeof( char_list ) );
+    push_bytes(
+        &buffer,
+        kerning_list,
+        header.kerning_count * sizeof( font_kerning_t )
+    );
+
+    return buffer;
 }
 
 const char * path_stem( const char * path )
@@ -47,31 +545,635 @@ const char * path_stem( const char * path )
     return buffer;
 }
 
+/// fonts are looked up as name.bfnt once converted
+const char * res_name( const char * path )
+{
+    static char buffer[ 256 ];
+
+    snprintf( buffer, sizeof( buffer ), "%s", path_stem( path ) );
+
+    if ( is_font( path ) ) {
+        buffer[ strlen( buffer ) - 4 ] = '\0';
+        strncat( buffer, ".bfnt", sizeof( buffer ) - strlen( buffer ) - 1 );
+    }
+
+    return buffer;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// name lookup, perfect hash over the resource names
+////////////////////////////////////////////////////////////////////////////////
+
+/// fnv-1a, the same as res_hash() in src/res.hpp
+unsigned int res_hash( const char * name )
+{
+    unsigned int hash = 2166136261u;
+    for ( ; *name; name++ ) {
+        hash ^= (unsigned char) *name;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/// murmur3 finalizer, the same as res_mix() in src/res.cpp
+unsigned int res_mix( unsigned int h )
+{
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+typedef struct {
+    unsigned int hash_list[ 128 ];
+    int count;
+
+    int disp_list[ 128 ];
+    int disp_count;
+    int slot_list[ 256 ];
+    int slot_count;
+} hash_table_t;
+
+/// hash and displace over the names the table was filled with. names are put
+/// in buckets by hash, then the fullest buckets first each get the smallest
+/// displacement that moves all of their names into free slots. a lookup is
+/// then one probe: slot = mix( hash + disp[ hash % disp_count ] ) % slot_count
+void add_hash_name( hash_table_t * table, const char * name )
+{
+    assert( table->count < 128 );
+
+    unsigned int hash = res_hash( name );
+
+    for ( int i = 0; i < table->count; i++ ) {
+        if ( table->hash_list[ i ] != hash ) continue;
+        fprintf( stderr, "resource name hash collision: %s\n", name );
+        exit( 1 );
+    }
+
+    table->hash_list[ table->count ] = hash;
+    table->count++;
+}
+
+void build_hash_table( hash_table_t * table )
+{
+    int count = table->count;
+
+    table->slot_count = next_pow2( count ) * 2;
+    table->disp_count = table->slot_count / 4 > 0 ? table->slot_count / 4 : 1;
+
+    if ( count == 0 ) table->hash_list[ 0 ] = 0;
+
+    for ( int i = 0; i < table->disp_count; i++ ) {
+        table->disp_list[ i ] = 0;
+    }
+    for ( int i = 0; i < table->slot_count; i++ ) {
+        table->slot_list[ i ] = -1;
+    }
+
+    int bucket_size[ 128 ] = { 0 };
+    int disp_mask = table->disp_count - 1;
+    int slot_mask = table->slot_count - 1;
+
+    for ( int i = 0; i < count; i++ ) {
+        bucket_size[ table->hash_list[ i ] & disp_mask ]++;
+    }
+
+    for ( ;; ) {
+        // fullest bucket left
+        int bucket = -1;
+        for ( int b = 0; b < table->disp_count; b++ ) {
+            if ( bucket_size[ b ] == 0 ) continue;
+            if ( bucket == -1 || bucket_size[ b ] > bucket_size[ bucket ] ) {
+                bucket = b;
+            }
+        }
+        if ( bucket == -1 ) break;
+        bucket_size[ bucket ] = 0;
+
+        for ( int disp = 0;; disp++ ) {
+            assert( disp < ( 1 << 24 ) );
+
+            int slot_list[ 128 ];
+            int slot_count = 0;
+            int fits = 1;
+
+            for ( int i = 0; i < count && fits; i++ ) {
+                if ( (int) ( table->hash_list[ i ] & disp_mask ) != bucket ) {
+                    continue;
+                }
+
+                int slot = res_mix( table->hash_list[ i ] + disp ) & slot_mask;
+                if ( table->slot_list[ slot ] != -1 ) fits = 0;
+                for ( int k = 0; k < slot_count; k++ ) {
+                    if ( slot_list[ k ] == slot ) fits = 0;
+                }
+                slot_list[ slot_count++ ] = slot;
+            }
+
+            if ( !fits ) continue;
+
+            table->disp_list[ bucket ] = disp;
+            for ( int i = 0; i < count; i++ ) {
+                if ( (int) ( table->hash_list[ i ] & disp_mask ) != bucket ) {
+                    continue;
+                }
+                int slot = res_mix( table->hash_list[ i ] + disp ) & slot_mask;
+                table->slot_list[ slot ] = i;
+            }
+            break;
+        }
+    }
+}
+
+void write_int_list( const char * name, const int * list, int count )
+{
+    printf( "const int %s[] = {\n", name );
+
+    for ( int i = 0; i < count; i++ ) {
+        printf( "    %d,\n", list[ i ] );
+    }
+
+    printf( "};\n" );
+}
+
+void write_hash_table( const char * prefix, const hash_table_t * table )
+{
+    char name[ 256 ];
+
+    printf( "const unsigned int %s_hash_list[] = {\n", prefix );
+    for ( int i = 0; i < ( table->count > 0 ? table->count : 1 ); i++ ) {
+        printf( "    0x%.8Xu,\n", table->hash_list[ i ] );
+    }
+    printf( "};\n" );
+
+    snprintf( name, sizeof( name ), "%s_disp_list", prefix );
+    write_int_list( name, table->disp_list, table->disp_count );
+    printf( "const int %s_disp_count = %d;\n", prefix, table->disp_count );
+
+    snprintf( name, sizeof( name ), "%s_slot_list", prefix );
+    write_int_list( name, table->slot_list, table->slot_count );
+    printf( "const int %s_slot_count = %d;\n", prefix, table->slot_count );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// lz4 block compression
+////////////////////////////////////////////////////////////////////////////////
+
+#define LZ4_HASH_BITS 14
+
+unsigned int read_u32( const unsigned char * p )
+{
+    unsigned int v;
+    memcpy( &v, p, 4 );
+    return v;
+}
+
+void push_lz4_length( byte_buffer_t * out, int len )
+{
+    while ( len >= 255 ) {
+        push_byte( out, 255 );
+        len -= 255;
+    }
+    push_byte( out, len );
+}
+
+/// one sequence, match_len 0 for the last one which is literals only
+void push_lz4_sequence(
+    byte_buffer_t * out,
+    const unsigned char * literal_list,
+    int literal_len,
+    int offset,
+    int match_len
+)
+{
+    int match_code = match_len ? match_len - 4 : 0;
+    int token = ( literal_len < 15 ? literal_len : 15 ) << 4;
+    token |= match_code < 15 ? match_code : 15;
+    push_byte( out, token );
+
+    if ( literal_len >= 15 ) push_lz4_length( out, literal_len - 15 );
+    push_bytes( out, literal_list, literal_len );
+
+    if ( !match_len ) return;
+
+    push_byte( out, offset & 0xff );
+    push_byte( out, offset >> 8 );
+    if ( match_code >= 15 ) push_lz4_length( out, match_code - 15 );
+}
+
+/// greedy, one candidate per hash of the next 4 bytes. keeps to the end of
+/// block rules: the last 5 bytes are literals and no match starts in the
+/// last 12
+byte_buffer_t lz4_compress( const unsigned char * src, int len )
+{
+    static int table[ 1 << LZ4_HASH_BITS ];
+    for ( int i = 0; i < ( 1 << LZ4_HASH_BITS ); i++ ) {
+        table[ i ] = -1;
+    }
+
+    byte_buffer_t out = { 0 };
+    int anchor = 0;
+    int i = 0;
+
+    while ( i < len - 12 ) {
+        unsigned int seq = read_u32( src + i );
+        int h = ( seq * 2654435761u ) >> ( 32 - LZ4_HASH_BITS );
+        int ref = table[ h ];
+        table[ h ] = i;
+
+        if ( ref < 0 || i - ref > 65535 || read_u32( src + ref ) != seq ) {
+            i++;
+            continue;
+        }
+
+        int match_len = 4;
+        while ( i + match_len < len - 5 &&
+                src[ ref + match_len ] == src[ i + match_len ] ) {
+            match_len++;
+        }
+
+        push_lz4_sequence( &out, src + anchor, i - anchor, i - ref, match_len );
+        i += match_len;
+        anchor = i;
+    }
+
+    push_lz4_sequence( &out, src + anchor, len - anchor, 0, 0 );
+
+    return out;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// external pack
+////////////////////////////////////////////////////////////////////////////////
+
+int compare_pack_entry( const void * a, const void * b )
+{
+    unsigned int ha = ( (const pack_entry_t *) a )->hash;
+    unsigned int hb = ( (const pack_entry_t *) b )->hash;
+    return ha < hb ? -1 : ( ha > hb ? 1 : 0 );
+}
+
+int compare_pack_atlas( const void * a, const void * b )
+{
+    unsigned int ha = ( (const pack_atlas_t *) a )->hash;
+    unsigned int hb = ( (const pack_atlas_t *) b )->hash;
+    return ha < hb ? -1 : ( ha > hb ? 1 : 0 );
+}
+
+void copy_pack_name( char * out, int cap, const char * name )
+{
+    if ( (int) strlen( name ) >= cap ) {
+        fprintf( stderr, "resource name too long for the pack: %s\n", name );
+        exit( 1 );
+    }
+    memset( out, 0, cap );
+    strcpy( out, name );
+}
+
+/// the same resources as the embedded data, entries that shrink by at least
+/// an eighth are stored lz4 compressed
+void write_pack(
+    const char * path,
+    const byte_buffer_t * blob,
+    const char ** name_list,
+    const int * offset_list,
+    const int * len_list,
+    int file_count,
+    const atlas_image_t * image_list,
+    int image_count,
+    int atlas_width,
+    int atlas_height
+)
+{
+    static pack_entry_t entry_list[ 128 ];
+    static pack_atlas_t atlas_list[ ATLAS_IMAGE_CAP ];
+    byte_buffer_t data = { 0 };
+
+    int index_size = sizeof( pack_header_t ) +
+                     file_count * sizeof( pack_entry_t ) +
+                     image_count * sizeof( pack_atlas_t );
+
+    for ( int i = 0; i < file_count; i++ ) {
+        pack_entry_t * entry = entry_list + i;
+        const char * name = res_name( name_list[ i ] );
+        const unsigned char * raw = blob->data + offset_list[ i ];
+        int raw_size = len_list[ i ];
+
+        copy_pack_name( entry->name, PACK_NAME_LEN, name );
+        entry->hash = res_hash( name );
+        entry->raw_size = raw_size;
+
+        while ( ( index_size + data.size ) % RES_ALIGN != 0 ) {
+            push_byte( &data, 0 );
+        }
+        entry->offset = index_size + data.size;
+
+        byte_buffer_t packed = lz4_compress( raw, raw_size );
+        if ( packed.size <= raw_size - raw_size / 8 ) {
+            entry->flags = PACK_LZ4;
+            entry->size = packed.size;
+            push_bytes( &data, packed.data, packed.size );
+        } else {
+            entry->flags = 0;
+            entry->size = raw_size;
+            push_bytes( &data, raw, raw_size );
+        }
+        free( packed.data );
+
+        fprintf(
+            stderr,
+            "pack: %-16s %7d -> %7d%s\n",
+            entry->name,
+            raw_size,
+            entry->size,
+            entry->flags & PACK_LZ4 ? " lz4" : ""
+        );
+    }
+
+    for ( int i = 0; i < image_count; i++ ) {
+        pack_atlas_t * atlas = atlas_list + i;
+        const atlas_image_t * image = image_list + i;
+        const char * name = path_stem( image->path );
+
+        copy_pack_name( atlas->name, PACK_NAME_LEN - 8, name );
+        atlas->hash = res_hash( name );
+        atlas->x = image->x;
+        atlas->y = image->y;
+        atlas->w = image->trim_w;
+        atlas->h = image->trim_h;
+        atlas->trim_x = image->trim_x;
+        atlas->trim_y = image->trim_y;
+    }
+
+    qsort( entry_list, file_count, sizeof( pack_entry_t ), compare_pack_entry );
+    qsort(
+        atlas_list,
+        image_count,
+        sizeof( pack_atlas_t ),
+        compare_pack_atlas
+    );
+
+    pack_header_t header;
+    memset( &header, 0, sizeof( header ) );
+    header.magic = PACK_MAGIC;
+    header.version = PACK_VERSION;
+    header.entry_count = file_count;
+    header.atlas_count = image_count;
+    header.atlas_w = atlas_width;
+    header.atlas_h = atlas_height;
+
+    FILE * file = fopen( path, "wb" );
+    if ( !file ) {
+        fprintf( stderr, "failed to write: %s\n", path );
+        exit( 1 );
+    }
+
+    fwrite( &header, sizeof( header ), 1, file );
+    fwrite( entry_list, sizeof( pack_entry_t ), file_count, file );
+    fwrite( atlas_list, sizeof( pack_atlas_t ), image_count, file );
+    fwrite( data.data, 1, data.size, file );
+
+    if ( fclose( file ) != 0 ) {
+        fprintf( stderr, "failed to write: %s\n", path );
+        exit( 1 );
+    }
+
+    free( data.data );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// textures
+////////////////////////////////////////////////////////////////////////////////
+
+/// header and the pixels ready for glTexImage2D, rows top to bottom. when
+/// every channel is a multiple of 17 the image fits rgba4444 without loss and
+/// is stored at half the size, otherwise it stays rgba8
+byte_buffer_t encode_texture(
+    const unsigned char * pixels,
+    int width,
+    int height
+)
+{
+    int pixel_count = width * height;
+
+    int packable = 1;
+    for ( int i = 0; i < pixel_count * 4 && packable; i++ ) {
+        if ( pixels[ i ] % 17 != 0 ) packable = 0;
+    }
+
+    tex_header_t header;
+    memset( &header, 0, sizeof( header ) );
+    header.magic = TEX_MAGIC;
+    header.version = TEX_VERSION;
+    header.width = width;
+    header.height = height;
+    header.format = packable ? TEX_RGBA4444 : TEX_RGBA8;
+
+    byte_buffer_t buffer = { 0 };
+    push_bytes( &buffer, &header, sizeof( header ) );
+
+    if ( !packable ) {
+        push_bytes( &buffer, pixels, pixel_count * 4 );
+        return buffer;
+    }
+
+    // gl unpacks each pixel as one native short, red in the top bits
+    for ( int i = 0; i < pixel_count; i++ ) {
+        const unsigned char * p = pixels + i * 4;
+        unsigned short packed = ( p[ 0 ] >> 4 ) << 12 | ( p[ 1 ] >> 4 ) << 8 |
+                                ( p[ 2 ] >> 4 ) << 4 | ( p[ 3 ] >> 4 );
+        push_bytes( &buffer, &packed, 2 );
+    }
+
+    return buffer;
+}
+
+void write_atlas_table(
+    const char * name,
+    const atlas_image_t * image_list,
+    int image_count,
+    int field_offset
+)
+{
+    printf( "const int %s[] = {\n", name );
+
+    for ( int i = 0; i < image_count; i++ ) {
+        const char * image = (const char *) ( image_list + i );
+        printf( "    %d,\n", *(const int *) ( image + field_offset ) );
+    }
+
+    if ( image_count == 0 ) printf( "    0,\n" );
+
+    printf( "};\n" );
+}
+
+/// the path as a c string literal that is itself an assembler string once
+/// the compiler is done with it, so quotes, backslashes and anything outside
+/// printable ascii are escaped twice
+static void write_asm_string( const char * s )
+{
+    putchar( '"' );
+
+    for ( ; *s; s++ ) {
+        unsigned char c = (unsigned char) *s;
+
+        if ( c == '"' || c == '\\' ) {
+            printf( "\\\\\\%c", c );
+        } else if ( c < 0x20 || c >= 0x7f ) {
+            printf( "\\\\%03o", c );
+        } else {
+            putchar( c );
+        }
+    }
+
+    putchar( '"' );
+}
+
+/// images (.png) are packed into one pre-decoded atlas texture, fonts (.fnt)
+/// are converted to the binary font layout, everything else is embedded as
+/// is.
+///
+/// usage: bake [-o header] [-b blob] [-p pack] files...
+///
+/// the header (stdout by default) gets the lookup tables and the data as one
+/// array. with -b the data goes to the blob file instead, for the assembler
+/// to pull in with .incbin, and the header only has the tables and the blob
+/// path. -p also writes everything to an external pack desktop builds map at
+/// startup
 int main( int argc, char ** argv )
 {
-    int file_count = argc - 1;
+    const char * header_path = NULL;
+    const char * blob_path = NULL;
+    const char * pack_path = NULL;
 
+    const char * path_list[ 128 ];
+    int path_count = 0;
+
+    for ( int i = 1; i < argc; i++ ) {
+        if ( strcmp( argv[ i ], "-o" ) == 0 && i + 1 < argc ) {
+            header_path = argv[ ++i ];
+        } else if ( strcmp( argv[ i ], "-b" ) == 0 && i + 1 < argc ) {
+            blob_path = argv[ ++i ];
+        } else if ( strcmp( argv[ i ], "-p" ) == 0 && i + 1 < argc ) {
+            pack_path = argv[ ++i ];
+        } else {
+            assert( path_count < 128 );
+            path_list[ path_count++ ] = argv[ i ];
+        }
+    }
+
+    const char * name_list[ 128 ];
     int offset_list[ 128 ];
     int len_list[ 128 ];
+    int file_count = 0;
 
-    assert( file_count > 0 );
+    static atlas_image_t image_list[ ATLAS_IMAGE_CAP ];
+    int image_count = 0;
 
-    printf( "unsigned char res_data[] = {" );
+    assert( path_count > 0 );
 
-    int pos = 0;
-    for ( int i = 0; i < file_count; i++ ) {
-        int len = write_file( argv[ i + 1 ], i );
-        len_list[ i ] = len;
-        offset_list[ i ] = pos;
-        pos += len;
+    for ( int i = 0; i < path_count; i++ ) {
+        if ( !is_image( path_list[ i ] ) ) continue;
+        assert( image_count < ATLAS_IMAGE_CAP );
+        load_atlas_image( image_list + image_count, path_list[ i ] );
+        image_count++;
+    }
+
+    byte_buffer_t blob = { 0 };
+
+    for ( int i = 0; i < path_count; i++ ) {
+        if ( is_image( path_list[ i ] ) ) continue;
+
+        push_padding( &blob );
+        int pos = blob.size;
+
+        if ( is_font( path_list[ i ] ) ) {
+            byte_buffer_t font = convert_font( path_list[ i ] );
+            push_bytes( &blob, font.data, font.size );
+            free( font.data );
+        } else {
+            push_file( &blob, path_list[ i ] );
+        }
+
+        name_list[ file_count ] = path_list[ i ];
+        len_list[ file_count ] = blob.size - pos;
+        offset_list[ file_count ] = pos;
+        file_count++;
+    }
+
+    int atlas_width = 0;
+    int atlas_height = 0;
+
+    if ( image_count > 0 ) {
+        pack_atlas( image_list, image_count, &atlas_width, &atlas_height );
+
+        unsigned char * pixels =
+            compose_atlas( image_list, image_count, atlas_width, atlas_height );
+        byte_buffer_t texture =
+            encode_texture( pixels, atlas_width, atlas_height );
+
+        push_padding( &blob );
+        name_list[ file_count ] = ATLAS_NAME;
+        len_list[ file_count ] = texture.size;
+        offset_list[ file_count ] = blob.size;
+        file_count++;
+        push_bytes( &blob, texture.data, texture.size );
+
+        free( texture.data );
+        free( pixels );
     }
 
-    printf( "\n};\n" );
+    if ( pack_path ) {
+        write_pack(
+            pack_path,
+            &blob,
+            name_list,
+            offset_list,
+            len_list,
+            file_count,
+            image_list,
+            image_count,
+            atlas_width,
+            atlas_height
+        );
+    }
 
-    printf( "const char * res_data_name_list[] = {\n" );
+    if ( header_path && !freopen( header_path, "w", stdout ) ) {
+        fprintf( stderr, "failed to open: %s\n", header_path );
+        exit( 1 );
+    }
+
+    if ( blob_path ) {
+        FILE * file = fopen( blob_path, "wb" );
+
+        if ( !file || fwrite( blob.data, 1, blob.size, file ) !=
+                          (size_t) blob.size ) {
+            fprintf( stderr, "failed to write: %s\n", blob_path );
+            exit( 1 );
+        }
+
+        fclose( file );
+
+        printf( "#define RES_BLOB_PATH " );
+        write_asm_string( blob_path );
+        printf( "\n" );
+    } else {
+        printf(
+            "alignas( %d ) const unsigned char res_data[] = {",
+            RES_ALIGN
+        );
+        write_bytes( blob.data, blob.size );
+        printf( "\n};\n" );
+    }
+
+    free( blob.data );
+
+    printf( "const char * const res_data_name_list[] = {\n" );
 
     for ( int i = 0; i < file_count; i++ ) {
-        printf( "    \"%s\",\n", path_stem( argv[ i + 1 ] ) );
+        printf( "    \"%s\",\n", res_name( name_list[ i ] ) );
     }
 
     printf( "};\n" );
@@ -94,5 +1196,76 @@ int main( int argc, char ** argv )
 
     printf( "const int res_data_count = %d;\n", file_count );
 
-    assert( argc >= 2 );
+    static hash_table_t data_table;
+    for ( int i = 0; i < file_count; i++ ) {
+        add_hash_name( &data_table, res_name( name_list[ i ] ) );
+    }
+    build_hash_table( &data_table );
+    write_hash_table( "res_data", &data_table );
+
+    // uv table, in atlas pixels
+
+    printf( "const char * const res_atlas_name_list[] = {\n" );
+
+    for ( int i = 0; i < image_count; i++ ) {
+        printf( "    \"%s\",\n", path_stem( image_list[ i ].path ) );
+    }
+
+    if ( image_count == 0 ) printf( "    \"\",\n" );
+
+    printf( "};\n" );
+
+    write_atlas_table(
+        "res_atlas_x_list",
+        image_list,
+        image_count,
+        offsetof( atlas_image_t, x )
+    );
+    write_atlas_table(
+        "res_atlas_y_list",
+        image_list,
+        image_count,
+        offsetof( atlas_image_t, y )
+    );
+    write_atlas_table(
+        "res_atlas_w_list",
+        image_list,
+        image_count,
+        offsetof( atlas_image_t, trim_w )
+    );
+    write_atlas_table(
+        "res_atlas_h_list",
+        image_list,
+        image_count,
+        offsetof( atlas_image_t, trim_h )
+    );
+    write_atlas_table(
+        "res_atlas_trim_x_list",
+        image_list,
+        image_count,
+        offsetof( atlas_image_t, trim_x )
+    );
+    write_atlas_table(
+        "res_atlas_trim_y_list",
+        image_list,
+        image_count,
+        offsetof( atlas_image_t, trim_y )
+    );
+
+    printf( "const int res_atlas_count = %d;\n", image_count );
+
+    static hash_table_t atlas_table;
+    for ( int i = 0; i < image_count; i++ ) {
+        add_hash_name( &atlas_table, path_stem( image_list[ i ].path ) );
+    }
+    build_hash_table( &atlas_table );
+    write_hash_table( "res_atlas", &atlas_table );
+    printf( "const int res_atlas_width = %d;\n", atlas_width );
+    printf( "const int res_atlas_height = %d;\n", atlas_height );
+
+    for ( int i = 0; i < image_count; i++ ) {
+        stbi_image_free( image_list[ i ].pixels );
+    }
+
+    return 0;
 }